@@ -65,6 +65,9 @@
     # include "common-stdap.h"
     # include "common-file.h"
     # include "common-timestamp.h"
+    # include "common-stream.h"
+    # include "common-manifest.h"
+    # include "common-pose.h"
 
 /* 
     Header - Preprocessor definitions
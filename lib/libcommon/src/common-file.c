@@ -41,6 +41,14 @@
     Source - Includes
  */
 
+    /* Required by copy_file_range */
+    # define _GNU_SOURCE
+
+    # include <errno.h>
+    # include <fcntl.h>
+    # include <unistd.h>
+    # include <libgen.h>
+    # include <sys/stat.h>
     # include "common-file.h"
 
 /*
@@ -181,3 +189,473 @@
 
     }
 
+/*
+    Source - File range copy
+ */
+
+    size_t lc_file_range( 
+
+        char const * const lcSource, 
+        char const * const lcDestination, 
+        size_t       const lcOffset, 
+        size_t       const lcLength 
+
+    ) {
+
+        /* Copied bytes variables */
+        size_t lcCopy = 0;
+
+        /* Chunk size variables */
+        ssize_t lcChunk = 0;
+
+        /* Source offset variables */
+        loff_t lcSeek = lcOffset;
+
+        /* Descriptors variables */
+        int lciFile = -1;
+        int lcoFile = -1;
+
+        /* Copy buffer variables */
+        char * lcBuffer = NULL;
+
+        /* Create and check source descriptor */
+        if ( ( lciFile = open( lcSource, O_RDONLY ) ) < 0 ) return( 0 );
+
+        /* Create and check destination descriptor */
+        if ( ( lcoFile = open( lcDestination, O_WRONLY | O_CREAT | O_TRUNC, 0644 ) ) < 0 ) {
+
+            /* Delete source descriptor */
+            close( lciFile );
+
+            /* Return copied bytes */
+            return( 0 );
+
+        }
+
+        /* Kernel space copy */
+        while ( lcCopy < lcLength ) {
+
+            /* Copy range chunk */
+            if ( ( lcChunk = copy_file_range( lciFile, & lcSeek, lcoFile, NULL, lcLength - lcCopy, 0 ) ) <= 0 ) break;
+
+            /* Update copied bytes */
+            lcCopy += lcChunk;
+
+        }
+
+        /* Check kernel space copy failure */
+        if ( ( lcCopy < lcLength ) && ( lcChunk < 0 ) && ( lcCopy == 0 ) ) {
+
+            /* Check unsupported copy */
+            if ( ( errno == ENOSYS ) || ( errno == EXDEV ) || ( errno == EINVAL ) || ( errno == EOPNOTSUPP ) ) {
+
+                /* Allocate and check copy buffer */
+                if ( ( lcBuffer = ( char * ) malloc( LC_COPY ) ) != NULL ) {
+
+                    /* User space copy */
+                    while ( lcCopy < lcLength ) {
+
+                        /* Read range chunk */
+                        if ( ( lcChunk = pread( lciFile, lcBuffer, ( lcLength - lcCopy ) < LC_COPY ? lcLength - lcCopy : LC_COPY, lcOffset + lcCopy ) ) <= 0 ) break;
+
+                        /* Write range chunk */
+                        if ( write( lcoFile, lcBuffer, lcChunk ) != lcChunk ) break;
+
+                        /* Update copied bytes */
+                        lcCopy += lcChunk;
+
+                    }
+
+                    /* Release copy buffer */
+                    free( lcBuffer );
+
+                }
+
+            }
+
+        }
+
+        /* Delete descriptors */
+        close( lcoFile );
+        close( lciFile );
+
+        /* Return copied bytes */
+        return( lcCopy );
+
+    }
+
+/*
+    Source - File content comparison
+ */
+
+    int lc_file_same(
+
+        char const * const lcFirst,
+        char const * const lcSecond
+
+    ) {
+
+        /* Returned variables */
+        int lcSame = LC_FALSE;
+
+        /* Read size variables */
+        size_t lcRead = 0;
+
+        /* Stream variables */
+        FILE * lcfStream = NULL;
+        FILE * lcsStream = NULL;
+
+        /* Comparison buffers variables */
+        char * lcfBuffer = NULL;
+        char * lcsBuffer = NULL;
+
+        /* Check files size */
+        if ( lc_file_size( lcFirst ) != lc_file_size( lcSecond ) ) return( LC_FALSE );
+
+        /* Create and check streams */
+        if ( ( lcfStream = fopen( lcFirst , "rb" ) ) == NULL ) return( LC_FALSE );
+        if ( ( lcsStream = fopen( lcSecond, "rb" ) ) == NULL ) { fclose( lcfStream ); return( LC_FALSE ); }
+
+        /* Allocate comparison buffers */
+        lcfBuffer = ( char * ) malloc( LC_COPY );
+        lcsBuffer = ( char * ) malloc( LC_COPY );
+
+        /* Check comparison buffers */
+        if ( ( lcfBuffer != NULL ) && ( lcsBuffer != NULL ) ) {
+
+            /* Update comparison state */
+            lcSame = LC_TRUE;
+
+            /* Compare streams by blocks */
+            while ( ( lcSame == LC_TRUE ) && ( ( lcRead = fread( lcfBuffer, 1, LC_COPY, lcfStream ) ) > 0 ) ) {
+
+                /* Compare block */
+                if ( ( fread( lcsBuffer, 1, lcRead, lcsStream ) != lcRead ) || ( memcmp( lcfBuffer, lcsBuffer, lcRead ) != 0 ) ) lcSame = LC_FALSE;
+
+            }
+
+        }
+
+        /* Release comparison buffers */
+        free( lcfBuffer );
+        free( lcsBuffer );
+
+        /* Close streams */
+        fclose( lcfStream );
+        fclose( lcsStream );
+
+        /* Return comparison state */
+        return( lcSame );
+
+    }
+
+/*
+    Source - Atomic file creation
+ */
+
+    FILE * lc_file_atomic_open(
+
+        char const * const lcFile,
+        char       * const lcTemp
+
+    ) {
+
+        /* Descriptor variables */
+        int lcDesc = -1;
+
+        /* Status variables */
+        struct stat lcStat;
+
+        /* Permissions variables */
+        mode_t lcMode = 0;
+
+        /* Stream variables */
+        FILE * lcStream = NULL;
+
+        /* Compose temporary file path */
+        sprintf( lcTemp, "%s" LC_ATOMIC, lcFile );
+
+        /* Create and check temporary file */
+        if ( ( lcDesc = mkstemp( lcTemp ) ) < 0 ) return( NULL );
+
+        /* Check replaced file status */
+        if ( stat( lcFile, & lcStat ) == 0 ) {
+
+            /* Keep replaced file permissions */
+            lcMode = lcStat.st_mode & 07777;
+
+        } else {
+
+            /* Retrieve and restore creation mask */
+            umask( lcMode = umask( 0 ) );
+
+            /* Apply creation mask on default permissions */
+            lcMode = 0666 & ~ lcMode;
+
+        }
+
+        /* Apply file permissions */
+        fchmod( lcDesc, lcMode );
+
+        /* Create and check stream */
+        if ( ( lcStream = fdopen( lcDesc, "wb" ) ) == NULL ) {
+
+            /* Delete descriptor */
+            close( lcDesc );
+
+            /* Remove temporary file */
+            unlink( lcTemp );
+
+        }
+
+        /* Return stream */
+        return( lcStream );
+
+    }
+
+/*
+    Source - Atomic file commitment
+ */
+
+    int lc_file_atomic_close(
+
+        FILE       * const lcStream,
+        char const * const lcTemp,
+        char const * const lcFile,
+        int          const lcCommit
+
+    ) {
+
+        /* Directory path variables */
+        char lcPath[256] = { 0 };
+
+        /* Descriptor variables */
+        int lcDesc = -1;
+
+        /* Status variables */
+        int lcStatus = ( lcCommit == LC_TRUE ) ? LC_TRUE : LC_FALSE;
+
+        /* Push stream content to the system */
+        if ( ( fflush( lcStream ) != 0 ) || ( ferror( lcStream ) != 0 ) ) lcStatus = LC_FALSE;
+
+        /* Check replacement necessity */
+        if ( ( lcStatus == LC_FALSE ) || ( lc_file_same( lcTemp, lcFile ) == LC_TRUE ) ) {
+
+            /* Close stream */
+            fclose( lcStream );
+
+            /* Remove temporary file */
+            unlink( lcTemp );
+
+            /* Return status */
+            return( lcStatus );
+
+        }
+
+        /* Synchronise temporary file on storage */
+        if ( fsync( fileno( lcStream ) ) != 0 ) lcStatus = LC_FALSE;
+
+        /* Close stream */
+        if ( fclose( lcStream ) != 0 ) lcStatus = LC_FALSE;
+
+        /* Check temporary file state */
+        if ( lcStatus == LC_FALSE ) {
+
+            /* Remove temporary file */
+            unlink( lcTemp );
+
+            /* Return failure */
+            return( LC_FALSE );
+
+        }
+
+        /* Replace file */
+        if ( rename( lcTemp, lcFile ) != 0 ) {
+
+            /* Remove temporary file */
+            unlink( lcTemp );
+
+            /* Return failure */
+            return( LC_FALSE );
+
+        }
+
+        /* Compose directory path */
+        strncpy( lcPath, lcFile, sizeof( lcPath ) - 1 );
+
+        /* Create and check directory descriptor */
+        if ( ( lcDesc = open( dirname( lcPath ), O_RDONLY ) ) >= 0 ) {
+
+            /* Synchronise directory on storage */
+            fsync( lcDesc );
+
+            /* Delete descriptor */
+            close( lcDesc );
+
+        }
+
+        /* Return success */
+        return( LC_TRUE );
+
+    }
+
+/*
+    Source - Data hash
+ */
+
+    uint64_t lc_file_hash(
+
+        uint64_t             lcHash,
+        void   const * const lcData,
+        size_t         const lcSize
+
+    ) {
+
+        /* Parsing variables */
+        size_t lcParse = 0;
+
+        /* Hash bytes */
+        for ( lcParse = 0; lcParse < lcSize; lcParse ++ ) {
+
+            /* Update hash */
+            lcHash = ( lcHash ^ ( ( unsigned char const * ) lcData )[lcParse] ) * LC_HASH_PRIME;
+
+        }
+
+        /* Return updated hash */
+        return( lcHash );
+
+    }
+
+/*
+    Source - File content hash
+ */
+
+    uint64_t lc_file_hash_file(
+
+        char const * const lcFile
+
+    ) {
+
+        /* Returned variables */
+        uint64_t lcHash = LC_HASH;
+
+        /* Read size variables */
+        size_t lcRead = 0;
+
+        /* Reading buffer variables */
+        char lcBuffer[4096];
+
+        /* Stream variables */
+        FILE * lcStream = NULL;
+
+        /* Create and check stream */
+        if ( ( lcStream = fopen( lcFile, "rb" ) ) == NULL ) return( 0 );
+
+        /* Hash file content */
+        while ( ( lcRead = fread( lcBuffer, 1, sizeof( lcBuffer ), lcStream ) ) > 0 ) lcHash = lc_file_hash( lcHash, lcBuffer, lcRead );
+
+        /* Close stream */
+        fclose( lcStream );
+
+        /* Return file content hash */
+        return( lcHash );
+
+    }
+
+/*
+    Source - Directory signature
+ */
+
+    uint64_t lc_file_signature(
+
+        char const *         const lcDirectory,
+        char const * const * const lcIgnore
+
+    ) {
+
+        /* Return directory signature */
+        return( lc_file_signature_walk( lcDirectory, strlen( lcDirectory ), lcIgnore ) );
+
+    }
+
+/*
+    Source - Directory signature walk
+ */
+
+    uint64_t lc_file_signature_walk(
+
+        char const *         const lcDirectory,
+        size_t               const lcOffset,
+        char const * const * const lcIgnore
+
+    ) {
+
+        /* Returned variables */
+        uint64_t lcSignature = 0;
+
+        /* Entity hash variables */
+        uint64_t lcHash = 0;
+
+        /* Ignored entities variables */
+        char const * const * lcSkip = NULL;
+
+        /* Entity path variables */
+        char lcEntity[512] = { 0 };
+
+        /* Directory variables */
+        DIR           * lcDirect = NULL;
+        struct dirent * lcRecord = NULL;
+
+        /* Status variables */
+        struct stat lcStat;
+
+        /* Create and check directory handle */
+        if ( ( lcDirect = opendir( lcDirectory ) ) == NULL ) return( 0 );
+
+        /* Enumerate directory entities */
+        while ( ( lcRecord = readdir( lcDirect ) ) != NULL ) {
+
+            /* Ignore hidden entities */
+            if ( lcRecord->d_name[0] == '.' ) continue;
+
+            /* Search entity in ignored entities */
+            for ( lcSkip = lcIgnore; ( lcSkip != NULL ) && ( * lcSkip != NULL ) && ( strcmp( lcRecord->d_name, * lcSkip ) != 0 ); lcSkip ++ );
+
+            /* Ignore specified entities */
+            if ( ( lcSkip != NULL ) && ( * lcSkip != NULL ) ) continue;
+
+            /* Compose entity path */
+            snprintf( lcEntity, sizeof( lcEntity ), "%s/%s", lcDirectory, lcRecord->d_name );
+
+            /* Query entity status without following links */
+            if ( lstat( lcEntity, & lcStat ) != 0 ) continue;
+
+            /* Check entity type */
+            if ( S_ISREG( lcStat.st_mode ) ) {
+
+                /* Hash relative path, size and modification time */
+                lcHash = lc_file_hash( LC_HASH, lcEntity + lcOffset, strlen( lcEntity + lcOffset ) );
+                lcHash = lc_file_hash( lcHash, & lcStat.st_size, sizeof( lcStat.st_size ) );
+                lcHash = lc_file_hash( lcHash, & lcStat.st_mtim, sizeof( lcStat.st_mtim ) );
+
+                /* Accumulate file contribution */
+                lcSignature += lcHash;
+
+            } else if ( S_ISDIR( lcStat.st_mode ) ) {
+
+                /* Accumulate directory contribution */
+                lcSignature += lc_file_signature_walk( lcEntity, lcOffset, lcIgnore );
+
+            }
+
+        }
+
+        /* Delete directory handle */
+        closedir( lcDirect );
+
+        /* Return directory signature */
+        return( lcSignature );
+
+    }
+
@@ -61,6 +61,7 @@
     Header - Includes
  */
 
+    # include <stdint.h>
     # include "common.h"
 
 /* 
@@ -71,6 +72,16 @@
     # define LC_FILE        0
     # define LC_DIRECTORY   1
 
+    /* Define copy buffer size */
+    # define LC_COPY        1048576
+
+    /* Define temporary file pattern */
+    # define LC_ATOMIC      ".tmp-XXXXXX"
+
+    /* Define FNV-1a hash parameters */
+    # define LC_HASH        UINT64_C(14695981039346656037)
+    # define LC_HASH_PRIME  UINT64_C(1099511628211)
+
 /* 
     Header - Preprocessor macros
  */
@@ -128,6 +139,183 @@
 
     size_t lc_file_size ( char const * const lcFile );
 
+    /*! \brief File range copy
+     *
+     *  This function copies the byte range of the source file in the provided
+     *  destination file, which is created or truncated. The copy is performed
+     *  in kernel space using copy_file_range, avoiding to move the data through
+     *  user space buffers. If the kernel or the file system is not able to do
+     *  so, the function falls back to large buffered reads and writes.
+     *
+     *  \param  lcSource        Path to the source file
+     *  \param  lcDestination   Path to the destination file
+     *  \param  lcOffset        Range offset, in bytes, in the source file
+     *  \param  lcLength        Range length, in bytes
+     *
+     *  \return Returns the amount of bytes copied
+     */
+
+    size_t lc_file_range ( 
+
+        char const * const lcSource, 
+        char const * const lcDestination, 
+        size_t       const lcOffset,
+        size_t       const lcLength
+
+    );
+
+    /*! \brief File content comparison
+     *
+     *  This function compares the content of the two provided files by large
+     *  blocks. Files of different sizes are considered as different without
+     *  reading their content.
+     *
+     *  \param  lcFirst     Path to the first file
+     *  \param  lcSecond    Path to the second file
+     *
+     *  \return Returns true if both files are readable and identical, false
+     *          otherwise
+     */
+
+    int lc_file_same (
+
+        char const * const lcFirst,
+        char const * const lcSecond
+
+    );
+
+    /*! \brief Atomic file creation
+     *
+     *  This function creates a temporary file in the directory of the provided
+     *  file and returns a stream on it. The content written in the stream only
+     *  replaces the provided file when lc_file_atomic_close is called, so that
+     *  an interrupted writing never leaves a truncated file behind. The
+     *  temporary file takes the permissions of the replaced file, or the
+     *  default permissions filtered by the creation mask if it does not exist.
+     *
+     *  \param  lcFile      Path to the file to write
+     *  \param  lcTemp      String that recieve the temporary file path, at
+     *                      least strlen( lcFile ) + 16 bytes long
+     *
+     *  \return Returns the temporary file stream, NULL on failure
+     */
+
+    FILE * lc_file_atomic_open (
+
+        char const * const lcFile,
+        char       * const lcTemp
+
+    );
+
+    /*! \brief Atomic file commitment
+     *
+     *  This function closes the stream created by lc_file_atomic_open. If
+     *  lcCommit is true, the temporary file is synchronised on the storage and
+     *  renamed over the provided file, and the directory is synchronised. If
+     *  the provided file already holds the exact same content, it is left
+     *  untouched and the temporary file is removed. If lcCommit is false, the
+     *  temporary file is removed.
+     *
+     *  \param  lcStream    Stream returned by lc_file_atomic_open
+     *  \param  lcTemp      Temporary file path
+     *  \param  lcFile      Path to the file to write
+     *  \param  lcCommit    Replacement flag
+     *
+     *  \return Returns true if the provided file holds the written content,
+     *          false otherwise
+     */
+
+    int lc_file_atomic_close (
+
+        FILE       * const lcStream,
+        char const * const lcTemp,
+        char const * const lcFile,
+        int          const lcCommit
+
+    );
+
+    /*! \brief Data hash
+     *
+     *  This function updates the provided FNV-1a hash with the provided bytes.
+     *  A new hash is started by providing LC_HASH as initial value.
+     *
+     *  \param  lcHash      Hash to update
+     *  \param  lcData      Pointer to the bytes to hash
+     *  \param  lcSize      Number of bytes to hash
+     *
+     *  \return Returns the updated hash
+     */
+
+    uint64_t lc_file_hash (
+
+        uint64_t             lcHash,
+        void   const * const lcData,
+        size_t         const lcSize
+
+    );
+
+    /*! \brief File content hash
+     *
+     *  This function computes the FNV-1a hash of the content of the provided
+     *  file. It is intended to small files, such as configuration files.
+     *
+     *  \param  lcFile      Path to the file
+     *
+     *  \return Returns the file content hash, zero if the file is not readable
+     */
+
+    uint64_t lc_file_hash_file (
+
+        char const * const lcFile
+
+    );
+
+    /*! \brief Directory signature
+     *
+     *  This function computes a signature of the content of the provided
+     *  directory and of its sub-directories without reading the files. Each
+     *  regular file contributes through its path relative to the directory,
+     *  its size and its modification time, so that adding, removing, renaming
+     *  or modifying a file changes the signature. The contributions are summed
+     *  so that the signature does not depend on the enumeration order. The
+     *  hidden entities and the entities named in lcIgnore are not considered.
+     *
+     *  \param  lcDirectory Path to the directory
+     *  \param  lcIgnore    NULL terminated array of the names of the entities
+     *                      to ignore, NULL for none
+     *
+     *  \return Returns the directory signature
+     */
+
+    uint64_t lc_file_signature (
+
+        char const *         const lcDirectory,
+        char const * const * const lcIgnore
+
+    );
+
+    /*! \brief Directory signature walk
+     *
+     *  This function is the recursive part of lc_file_signature. The provided
+     *  offset gives the length of the root directory path that is removed from
+     *  the paths before hashing.
+     *
+     *  \param  lcDirectory Path to the directory
+     *  \param  lcOffset    Length of the root directory path
+     *  \param  lcIgnore    NULL terminated array of the names of the entities
+     *                      to ignore, NULL for none
+     *
+     *  \return Returns the directory signature
+     */
+
+    uint64_t lc_file_signature_walk (
+
+        char const *         const lcDirectory,
+        size_t               const lcOffset,
+        char const * const * const lcIgnore
+
+    );
+
 /* 
     Header - C/C++ compatibility
  */
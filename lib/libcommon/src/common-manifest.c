@@ -0,0 +1,110 @@
+/*
+ * csps-suite libcommon - csps-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "common-manifest.h"
+
+/*
+    Source - Manifest entry exportation
+ */
+
+    void lc_manifest_write( 
+
+        FILE         * const lcStream, 
+        char   const * const lcName, 
+        char   const * const lcSource, 
+        size_t         const lcOffset, 
+        size_t         const lcLength 
+
+    ) {
+
+        /* Export manifest entry */
+        fprintf( lcStream, "%s %zu %zu %s\n", lcName, lcOffset, lcLength, lcSource );
+
+    }
+
+/*
+    Source - Manifest entries enumeration
+ */
+
+    int lc_manifest_enum( 
+
+        char   const * const lcManifest, 
+        char         * const lcName, 
+        char         * const lcSource, 
+        size_t       * const lcOffset, 
+        size_t       * const lcLength 
+
+    ) {
+
+        /* Manifest stream variables */
+        static FILE * lcStream = NULL;
+
+        /* Verify enumeration mode */
+        if ( lcStream == NULL ) {
+
+            /* Create and check manifest stream */
+            if ( ( lcStream = fopen( lcManifest, "r" ) ) == NULL ) return( LC_FALSE );
+
+        }
+
+        /* Read manifest entry */
+        if ( fscanf( lcStream, "%255s %zu %zu %255[^\n]\n", lcName, lcOffset, lcLength, lcSource ) == 4 ) {
+
+            /* Returns entry message */
+            return( LC_TRUE );
+
+        } else {
+
+            /* Delete manifest stream */
+            fclose( lcStream );
+
+            /* Reset stream pointer */
+            lcStream = NULL;
+
+            /* Returns no entry message */
+            return( LC_FALSE );
+
+        }
+
+    }
+
@@ -0,0 +1,156 @@
+/*
+ * csps-suite libcommon - csps-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   common-manifest.h
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *
+     *  Decomposition manifest operations
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __LC_MANIFEST__
+    # define __LC_MANIFEST__
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    extern "C" {
+    # endif
+
+/* 
+    Header - Includes
+ */
+
+    # include "common.h"
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define manifest file name */
+    # define LC_MANIFEST    "log-container.manifest"
+
+    /* Define manifest source path maximum size, including terminal zero */
+    # define LC_MANIFEST_PATH 256
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Manifest entry exportation
+     *
+     *  This function writes a manifest entry in the provided stream. An entry
+     *  describes a virtual logs-file through its name and the byte range it
+     *  covers in its source logs-file. Each entry takes a single line of the
+     *  manifest with the form "name offset length source". The source path
+     *  has to be shorter than LC_MANIFEST_PATH.
+     *
+     *  \param  lcStream    Manifest stream
+     *  \param  lcName      Virtual logs-file name
+     *  \param  lcSource    Path to the source logs-file
+     *  \param  lcOffset    Range offset, in bytes, in the source logs-file
+     *  \param  lcLength    Range length, in bytes
+     */
+
+    void lc_manifest_write ( 
+
+        FILE         * const lcStream, 
+        char   const * const lcName, 
+        char   const * const lcSource, 
+        size_t         const lcOffset, 
+        size_t         const lcLength 
+
+    );
+
+    /*! \brief Manifest entries enumeration
+     *
+     *  Enumerates the entries of the provided manifest file. As for directory
+     *  enumeration, the function detects automatically if an enumeration is
+     *  under way and returns, one by one, the found entries. When enumeration
+     *  is terminated, the function closes itself the manifest stream.
+     *
+     *  \param  lcManifest  Path to the manifest file
+     *  \param  lcName      String that recieve the virtual logs-file name
+     *  \param  lcSource    String that recieve the source logs-file path
+     *  \param  lcOffset    Pointer to the variable that recieve range offset
+     *  \param  lcLength    Pointer to the variable that recieve range length
+     *
+     *  \return Returns code indicating enumeration status
+     */
+
+    int lc_manifest_enum ( 
+
+        char   const * const lcManifest, 
+        char         * const lcName, 
+        char         * const lcSource, 
+        size_t       * const lcOffset, 
+        size_t       * const lcLength 
+
+    );
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    } 
+    # endif
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
@@ -0,0 +1,326 @@
+/*
+ * csps-suite libcommon - csps-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include <fcntl.h>
+    # include <unistd.h>
+    # include <inttypes.h>
+    # include <sys/mman.h>
+    # include <sys/stat.h>
+    # include "common-pose.h"
+
+/*
+    Source - Pose cache opening
+ */
+
+    int lc_pose_open( 
+
+        lc_Cache_t         * const lcCache, 
+        char const         * const lcPath, 
+        char const * const * const lcDevice 
+
+    ) {
+
+        /* Streams path variables */
+        char lcStreams[512] = { 0 };
+
+        /* Devices hash variables */
+        uint64_t lcHash = LC_HASH;
+
+        /* Parsing variables */
+        int lcParse = 0;
+
+        /* File descriptor variables */
+        int lcHandle = -1;
+
+        /* Status variables */
+        struct stat lcStat;
+
+        /* Header variables */
+        lc_Pose_Header_t const * lcHeader = NULL;
+
+        /* Reset cache descriptor */
+        memset( lcCache, 0, sizeof( lc_Cache_t ) );
+
+        /* Hash devices tags and modules, including terminal characters */
+        for ( lcParse = 0; lcParse < 6; lcParse ++ ) lcHash = lc_file_hash( lcHash, lcDevice[lcParse], strlen( lcDevice[lcParse] ) + 1 );
+
+        /* Compose cache and streams paths */
+        snprintf( lcCache->caPath, sizeof( lcCache->caPath ), "%s/" LC_POSE_PREFIX "%016" PRIx64 LC_POSE_SUFFIX, lcPath, lcHash );
+        snprintf( lcStreams, sizeof( lcStreams ), "%s/" LC_POSE_STREAMS, lcPath );
+
+        /* Compute streams signature */
+        if ( ( lcCache->caSignature = lc_file_signature( lcStreams, NULL ) ) == 0 ) return( LC_FALSE );
+
+        /* Open and check cache file */
+        if ( ( lcHandle = open( lcCache->caPath, O_RDONLY ) ) < 0 ) return( LC_FALSE );
+
+        /* Query and check cache file size */
+        if ( ( fstat( lcHandle, & lcStat ) != 0 ) || ( ( size_t ) lcStat.st_size < sizeof( lc_Pose_Header_t ) ) ) {
+
+            /* Close cache file */
+            close( lcHandle );
+
+            /* Return failure */
+            return( LC_FALSE );
+
+        }
+
+        /* Map cache file */
+        lcCache->caSize = lcStat.st_size;
+        lcCache->caMap  = mmap( NULL, lcCache->caSize, PROT_READ, MAP_PRIVATE, lcHandle, 0 );
+
+        /* Close cache file, the mapping remaining valid */
+        close( lcHandle );
+
+        /* Check mapping */
+        if ( lcCache->caMap == MAP_FAILED ) {
+
+            /* Invalidate mapping */
+            lcCache->caMap = NULL;
+
+            /* Return failure */
+            return( LC_FALSE );
+
+        }
+
+        /* Retrieve cache header */
+        lcHeader = ( lc_Pose_Header_t const * ) lcCache->caMap;
+
+        /* Check cache header and streams signature */
+        if ( 
+
+            ( strncmp( lcHeader->phMagic, LC_POSE_MAGIC, sizeof( lcHeader->phMagic ) ) != 0 ) ||
+            ( lcHeader->phVersion != LC_POSE_VERSION ) ||
+            ( lcHeader->phRecord != sizeof( lc_Pose_t ) ) ||
+            ( lcHeader->phSignature != lcCache->caSignature ) ||
+            ( lcCache->caSize != sizeof( lc_Pose_Header_t ) + lcHeader->phCount * sizeof( lc_Pose_t ) )
+
+        ) {
+
+            /* Unmap cache file */
+            lc_pose_close( lcCache );
+
+            /* Return failure */
+            return( LC_FALSE );
+
+        }
+
+        /* Assign cache content */
+        lcCache->caStill = lcHeader->phStill;
+        lcCache->caPose  = ( lc_Pose_t const * ) ( lcHeader + 1 );
+        lcCache->caCount = lcHeader->phCount;
+
+        /* Return success */
+        return( LC_TRUE );
+
+    }
+
+/*
+    Source - Pose cache closing
+ */
+
+    void lc_pose_close( 
+
+        lc_Cache_t * const lcCache 
+
+    ) {
+
+        /* Unmap cache file */
+        if ( lcCache->caMap != NULL ) munmap( lcCache->caMap, lcCache->caSize );
+
+        /* Reset cache content */
+        lcCache->caMap   = NULL;
+        lcCache->caSize  = 0;
+        lcCache->caPose  = NULL;
+        lcCache->caCount = 0;
+
+    }
+
+/*
+    Source - Pose cache exportation
+ */
+
+    int lc_pose_write( 
+
+        lc_Cache_t const * const lcCache, 
+        lc_Pose_t  const * const lcPose, 
+        long               const lcCount, 
+        uint64_t           const lcStill 
+
+    ) {
+
+        /* Temporary file path variables */
+        char lcTemp[528] = { 0 };
+
+        /* Header variables */
+        lc_Pose_Header_t lcHeader;
+
+        /* Stream variables */
+        FILE * lcStream = NULL;
+
+        /* Check streams signature */
+        if ( lcCache->caSignature == 0 ) return( LC_FALSE );
+
+        /* Compose cache header */
+        memset( & lcHeader, 0, sizeof( lc_Pose_Header_t ) );
+        strncpy( lcHeader.phMagic, LC_POSE_MAGIC, sizeof( lcHeader.phMagic ) );
+        lcHeader.phVersion   = LC_POSE_VERSION;
+        lcHeader.phRecord    = sizeof( lc_Pose_t );
+        lcHeader.phSignature = lcCache->caSignature;
+        lcHeader.phStill     = lcStill;
+        lcHeader.phCount     = lcCount;
+
+        /* Create and check cache stream */
+        if ( ( lcStream = lc_file_atomic_open( lcCache->caPath, lcTemp ) ) == NULL ) return( LC_FALSE );
+
+        /* Export cache header and poses records */
+        if ( 
+
+            ( fwrite( & lcHeader, sizeof( lc_Pose_Header_t ), 1, lcStream ) != 1 ) ||
+            ( fwrite( lcPose, sizeof( lc_Pose_t ), lcCount, lcStream ) != ( size_t ) lcCount )
+
+        ) {
+
+            /* Discard cache stream */
+            lc_file_atomic_close( lcStream, lcTemp, lcCache->caPath, LC_FALSE );
+
+            /* Return failure */
+            return( LC_FALSE );
+
+        }
+
+        /* Commit cache stream */
+        return( lc_file_atomic_close( lcStream, lcTemp, lcCache->caPath, LC_TRUE ) );
+
+    }
+
+/*
+    Source - Still range device signature
+ */
+
+    uint64_t lc_pose_still( 
+
+        char const * const lcTag, 
+        char const * const lcModule 
+
+    ) {
+
+        /* Returned variables */
+        uint64_t lcHash = LC_HASH;
+
+        /* Hash tag and module, including terminal characters */
+        lcHash = lc_file_hash( lcHash, lcTag   , strlen( lcTag    ) + 1 );
+        lcHash = lc_file_hash( lcHash, lcModule, strlen( lcModule ) + 1 );
+
+        /* Return signature, avoiding the no still range value */
+        return( ( lcHash == LC_POSE_NOSTILL ) ? lcHash + 1 : lcHash );
+
+    }
+
+/*
+    Source - Pose query
+ */
+
+    void lc_pose_query( 
+
+        lc_Pose_t     * const lcPose, 
+        lp_Trigger_t  * const lcTrigger, 
+        lp_Position_t * const lcPosition, 
+        lp_Orient_t   * const lcOrient, 
+        lp_Still_t    * const lcStill, 
+        lp_Size_t       const lcIndex 
+
+    ) {
+
+        /* Reset pose record, padding included */
+        memset( lcPose, 0, sizeof( lc_Pose_t ) );
+
+        /* Query trigger by index */
+        lp_query_trigger_byindex( lcTrigger, lcIndex );
+
+        /* Query position and orientation */
+        lp_query_position   ( lcPosition, lcTrigger->qrSynch );
+        lp_query_orientation( lcOrient  , lcTrigger->qrSynch );
+
+        /* Assign trigger timestamps */
+        lcPose->pcMaster = lcTrigger->qrMaster;
+        lcPose->pcSynch  = lcTrigger->qrSynch;
+
+        /* Assign position */
+        lcPose->pcLocated     = lp_query_position_status( lcPosition );
+        lcPose->pcPosition[0] = lcPosition->qrLongitude;
+        lcPose->pcPosition[1] = lcPosition->qrLatitude;
+        lcPose->pcPosition[2] = lcPosition->qrAltitude;
+        lcPose->pcPosition[3] = lcPosition->qrWeak;
+
+        /* Assign orientation */
+        lcPose->pcOriented = lp_query_orientation_status( lcOrient );
+        lcPose->pcFrame[0] = lcOrient->qrfxx;
+        lcPose->pcFrame[1] = lcOrient->qrfxy;
+        lcPose->pcFrame[2] = lcOrient->qrfxz;
+        lcPose->pcFrame[3] = lcOrient->qrfyx;
+        lcPose->pcFrame[4] = lcOrient->qrfyy;
+        lcPose->pcFrame[5] = lcOrient->qrfyz;
+        lcPose->pcFrame[6] = lcOrient->qrfzx;
+        lcPose->pcFrame[7] = lcOrient->qrfzy;
+        lcPose->pcFrame[8] = lcOrient->qrfzz;
+        lcPose->pcFrame[9] = lcOrient->qrWeak;
+
+        /* Check still range query */
+        if ( lcStill == NULL ) {
+
+            /* Assign undetermined still range */
+            lcPose->pcStill = LC_FALSE;
+
+        } else {
+
+            /* Query still range */
+            lp_query_still( lcStill, lcTrigger->qrSynch );
+
+            /* Assign still range */
+            lcPose->pcStill = ( lcStill->qrStill == LP_TRUE ) ? LC_TRUE : LC_FALSE;
+
+        }
+
+    }
+
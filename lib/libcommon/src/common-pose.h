@@ -0,0 +1,323 @@
+/*
+ * csps-suite libcommon - csps-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   common-pose.h
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *
+     *  Camera poses cache operations
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __LC_POSE__
+    # define __LC_POSE__
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    extern "C" {
+    # endif
+
+/* 
+    Header - Includes
+ */
+
+    # include <stdint.h>
+    # include "common.h"
+    # include "common-file.h"
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define cache file name prefix and suffix */
+    # define LC_POSE_PREFIX     ".csps-pose-"
+    # define LC_POSE_SUFFIX     ".cache"
+
+    /* Define cache file magic and version */
+    # define LC_POSE_MAGIC      "csps-pose-cache"
+    # define LC_POSE_VERSION    1
+
+    /* Define CSPS processing output directory */
+    # define LC_POSE_STREAMS    "streams"
+
+    /* Define still range signature of caches without still range */
+    # define LC_POSE_NOSTILL    UINT64_C(0)
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+    /*! \struct lc_Pose_struct
+     *  \brief Cached camera pose
+     *
+     *  This structure is the on-disk record of the pose cache. It stores the
+     *  raw results of the CSPS queries performed for one camera trigger, the
+     *  interpretation of the statuses being left to the software using them.
+     *
+     *  \var lc_Pose_struct::pcMaster
+     *  Master timestamp of the camera trigger
+     *  \var lc_Pose_struct::pcSynch
+     *  Synchronization timestamp of the camera trigger
+     *  \var lc_Pose_struct::pcPosition
+     *  Longitude, latitude, altitude and weak factor of the position
+     *  \var lc_Pose_struct::pcFrame
+     *  Orientation frame, xx, xy, xz, yx, yy, yz, zx, zy, zz, and weak factor
+     *  \var lc_Pose_struct::pcLocated
+     *  Position query status
+     *  \var lc_Pose_struct::pcOriented
+     *  Orientation query status
+     *  \var lc_Pose_struct::pcStill
+     *  Still range flag
+     *  \var lc_Pose_struct::pcReserved
+     *  Padding, always zero
+     */
+
+    typedef struct lc_Pose_struct {
+
+        lp_Time_t pcMaster;
+        lp_Time_t pcSynch;
+        double    pcPosition[4];
+        double    pcFrame[10];
+        int32_t   pcLocated;
+        int32_t   pcOriented;
+        int32_t   pcStill;
+        int32_t   pcReserved;
+
+    } lc_Pose_t;
+
+    /*! \struct lc_Pose_Header_struct
+     *  \brief Pose cache header
+     *
+     *  This structure is the header of the pose cache file, directly followed
+     *  by the array of poses records.
+     *
+     *  \var lc_Pose_Header_struct::phMagic
+     *  Cache file magic, zero padded
+     *  \var lc_Pose_Header_struct::phVersion
+     *  Cache file version
+     *  \var lc_Pose_Header_struct::phRecord
+     *  Size, in bytes, of a pose record
+     *  \var lc_Pose_Header_struct::phSignature
+     *  Signature of the CSPS streams the poses are computed from
+     *  \var lc_Pose_Header_struct::phStill
+     *  Signature of the still range device, LC_POSE_NOSTILL if not queried
+     *  \var lc_Pose_Header_struct::phCount
+     *  Number of poses records
+     */
+
+    typedef struct lc_Pose_Header_struct {
+
+        char     phMagic[16];
+        uint32_t phVersion;
+        uint32_t phRecord;
+        uint64_t phSignature;
+        uint64_t phStill;
+        uint64_t phCount;
+
+    } lc_Pose_Header_t;
+
+    /*! \struct lc_Cache_struct
+     *  \brief Pose cache descriptor
+     *
+     *  This structure describes a pose cache file of a CSPS directory. The
+     *  poses records of a valid cache are mapped in memory.
+     *
+     *  \var lc_Cache_struct::caPath
+     *  Path to the cache file
+     *  \var lc_Cache_struct::caSignature
+     *  Signature of the CSPS streams at cache opening
+     *  \var lc_Cache_struct::caStill
+     *  Signature of the still range device of the cache
+     *  \var lc_Cache_struct::caMap
+     *  Memory mapping of the cache file, NULL if not mapped
+     *  \var lc_Cache_struct::caSize
+     *  Size, in bytes, of the memory mapping
+     *  \var lc_Cache_struct::caPose
+     *  Mapped poses records
+     *  \var lc_Cache_struct::caCount
+     *  Number of mapped poses records
+     */
+
+    typedef struct lc_Cache_struct {
+
+        char              caPath[512];
+        uint64_t          caSignature;
+        uint64_t          caStill;
+        void            * caMap;
+        size_t            caSize;
+        lc_Pose_t const * caPose;
+        long              caCount;
+
+    } lc_Cache_t;
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Pose cache opening
+     *
+     *  This function composes the path of the pose cache of the provided CSPS
+     *  directory and devices, and computes the signature of the CSPS streams
+     *  of the directory. If the cache file exists and was computed from the
+     *  same streams, its poses records are mapped in memory. Otherwise, the
+     *  descriptor can still be used to write the cache.
+     *
+     *  \param  lcCache     Cache descriptor to initialize
+     *  \param  lcPath      CSPS directory path
+     *  \param  lcDevice    Camera, GPS and IMU tags and modules, in this order
+     *
+     *  \return Returns true if the poses records are mapped, false otherwise
+     */
+
+    int lc_pose_open ( 
+
+        lc_Cache_t         * const lcCache, 
+        char const         * const lcPath, 
+        char const * const * const lcDevice 
+
+    );
+
+    /*! \brief Pose cache closing
+     *
+     *  This function unmaps the poses records of the provided cache. The
+     *  descriptor can still be used to write the cache.
+     *
+     *  \param  lcCache     Cache descriptor
+     */
+
+    void lc_pose_close ( 
+
+        lc_Cache_t * const lcCache 
+
+    );
+
+    /*! \brief Pose cache exportation
+     *
+     *  This function atomically writes the provided poses records in the cache
+     *  file of the provided descriptor. The records are tagged with the CSPS
+     *  streams signature computed at cache opening, so that streams modified
+     *  in the meantime invalidate the written cache.
+     *
+     *  \param  lcCache     Cache descriptor
+     *  \param  lcPose      Poses records array
+     *  \param  lcCount     Number of poses records
+     *  \param  lcStill     Signature of the still range device
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    int lc_pose_write ( 
+
+        lc_Cache_t const * const lcCache, 
+        lc_Pose_t  const * const lcPose, 
+        long               const lcCount, 
+        uint64_t           const lcStill 
+
+    );
+
+    /*! \brief Still range device signature
+     *
+     *  This function computes the signature of the still range device stored
+     *  in the pose caches.
+     *
+     *  \param  lcTag       Still range device tag
+     *  \param  lcModule    Still range device module
+     *
+     *  \return Returns the still range device signature
+     */
+
+    uint64_t lc_pose_still ( 
+
+        char const * const lcTag, 
+        char const * const lcModule 
+
+    );
+
+    /*! \brief Pose query
+     *
+     *  This function queries the provided camera trigger and the position,
+     *  orientation and still range at its synchronization timestamp, and
+     *  stores the results in the provided pose record.
+     *
+     *  \param  lcPose      Pose record
+     *  \param  lcTrigger   CSPS camera trigger query structure
+     *  \param  lcPosition  CSPS position query structure
+     *  \param  lcOrient    CSPS orientation query structure
+     *  \param  lcStill     CSPS still range query structure, NULL to skip the
+     *                      still range query
+     *  \param  lcIndex     Camera trigger index
+     */
+
+    void lc_pose_query ( 
+
+        lc_Pose_t     * const lcPose, 
+        lp_Trigger_t  * const lcTrigger, 
+        lp_Position_t * const lcPosition, 
+        lp_Orient_t   * const lcOrient, 
+        lp_Still_t    * const lcStill, 
+        lp_Size_t       const lcIndex 
+
+    );
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    } 
+    # endif
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
@@ -0,0 +1,127 @@
+/*
+ * csps-suite libcommon - csps-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "common-stream.h"
+
+/*
+    Source - Stream creation
+ */
+
+    int lc_stream_open( 
+
+        lc_Stream_t       * const lcStream, 
+        char        const * const lcFile, 
+        size_t              const lcOffset, 
+        size_t              const lcLength 
+
+    ) {
+
+        /* Source size variables */
+        size_t lcSize = lc_file_size( lcFile );
+
+        /* Check range offset */
+        if ( lcOffset > lcSize ) return( LC_FALSE );
+
+        /* Create and check source stream */
+        if ( ( lcStream->smHandle = fopen( lcFile, "rb" ) ) == NULL ) return( LC_FALSE );
+
+        /* Assign range */
+        lcStream->smOffset = lcOffset;
+        lcStream->smLength = ( lcLength == 0 ) ? lcSize - lcOffset : lcLength;
+
+        /* Position stream at range begining */
+        lc_stream_rewind( lcStream );
+
+        /* Return positive answer */
+        return( LC_TRUE );
+
+    }
+
+/*
+    Source - Stream record reader
+ */
+
+    int lc_stream_read( lc_Stream_t * const lcStream, lp_Byte_t * const lcBuffer ) {
+
+        /* Check range limit */
+        if ( ( lcStream->smRead + LC_RECORD ) > lcStream->smLength ) return( LC_FALSE );
+
+        /* Read record */
+        if ( fread( lcBuffer, 1, LC_RECORD, lcStream->smHandle ) != LC_RECORD ) return( LC_FALSE );
+
+        /* Update range consumption */
+        lcStream->smRead += LC_RECORD;
+
+        /* Return positive answer */
+        return( LC_TRUE );
+
+    }
+
+/*
+    Source - Stream rewind
+ */
+
+    void lc_stream_rewind( lc_Stream_t * const lcStream ) {
+
+        /* Update source stream offset */
+        fseek( lcStream->smHandle, lcStream->smOffset, SEEK_SET );
+
+        /* Reset range consumption */
+        lcStream->smRead = 0;
+
+    }
+
+/*
+    Source - Stream deletion
+ */
+
+    void lc_stream_close( lc_Stream_t * const lcStream ) {
+
+        /* Close source stream */
+        if ( lcStream->smHandle != NULL ) fclose( lcStream->smHandle );
+
+        /* Reset handle */
+        lcStream->smHandle = NULL;
+
+    }
+
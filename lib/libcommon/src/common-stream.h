@@ -0,0 +1,182 @@
+/*
+ * csps-suite libcommon - csps-suite common library
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   common-stream.h
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *
+     *  Logs-file records reader
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __LC_STREAM__
+    # define __LC_STREAM__
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    extern "C" {
+    # endif
+
+/* 
+    Header - Includes
+ */
+
+    # include "common.h"
+    # include "common-file.h"
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+    /*! \struct lc_Stream_struct
+     *  \brief Logs-file records stream
+     *
+     *  This structure describes a records stream opened on a byte range of a
+     *  logs-file. A physical logs-file is read through a range covering the
+     *  entire file, while virtual logs-files, as described by decomposition
+     *  manifests, are read through the range they cover in their source file.
+     *
+     *  \var lc_Stream_struct::smHandle
+     *  Source file stream handle
+     *  \var lc_Stream_struct::smOffset
+     *  Range offset, in bytes, in the source file
+     *  \var lc_Stream_struct::smLength
+     *  Range length, in bytes
+     *  \var lc_Stream_struct::smRead
+     *  Bytes already consumed in the range
+     */
+
+    typedef struct lc_Stream_struct {
+
+        FILE * smHandle;
+        size_t smOffset;
+        size_t smLength;
+        size_t smRead;
+
+    } lc_Stream_t;
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Stream creation
+     *
+     *  This function opens the provided source file and positions the stream
+     *  at the begining of the provided range. If the provided length is zero,
+     *  the range extends up to the end of the source file. A range offset
+     *  beyond the end of the source file is rejected.
+     *
+     *  \param  lcStream    Stream structure to initialize
+     *  \param  lcFile      Path to the source file
+     *  \param  lcOffset    Range offset, in bytes
+     *  \param  lcLength    Range length, in bytes
+     *
+     *  \return Returns true on success, false otherwise
+     */
+
+    int lc_stream_open ( 
+
+        lc_Stream_t       * const lcStream, 
+        char        const * const lcFile, 
+        size_t              const lcOffset, 
+        size_t              const lcLength 
+
+    );
+
+    /*! \brief Stream record reader
+     *
+     *  This function reads the next record of the stream range in the provided
+     *  buffer. The buffer has to be at least LC_RECORD bytes long.
+     *
+     *  \param  lcStream    Stream structure
+     *  \param  lcBuffer    Record buffer
+     *
+     *  \return Returns true if a record was read, false at end of range
+     */
+
+    int lc_stream_read ( lc_Stream_t * const lcStream, lp_Byte_t * const lcBuffer );
+
+    /*! \brief Stream rewind
+     *
+     *  This function positions the stream back at the begining of its range.
+     *
+     *  \param  lcStream    Stream structure
+     */
+
+    void lc_stream_rewind ( lc_Stream_t * const lcStream );
+
+    /*! \brief Stream deletion
+     *
+     *  This function closes the source file handle of the stream.
+     *
+     *  \param  lcStream    Stream structure
+     */
+
+    void lc_stream_close ( lc_Stream_t * const lcStream );
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    } 
+    # endif
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
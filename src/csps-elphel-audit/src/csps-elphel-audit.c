@@ -52,12 +52,19 @@
         /* Paths variables */
         char csPath[256] = { 0 };
         char csFile[256] = { 0 };
+        char csName[256] = { 0 };
+        char csMani[256] = { 0 };
+
+        /* Range variables */
+        size_t csOffset = 0;
+        size_t csLength = 0;
 
         /* Stream variables */
-        FILE * csStream = NULL;
+        lc_Stream_t csStream;
 
         /* Search in parameters */
-        lc_stdp( lc_stda( argc, argv, "--path", "-p" ), argv, csPath, LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--path"    , "-p" ), argv, csPath, LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--manifest", "-m" ), argv, csMani, LC_STRING );
 
         /* Execution switch */
         if ( lc_stda( argc, argv, "--help", "-h" ) || ( argc <= 1 ) ) {
@@ -65,6 +72,26 @@
             /* Display help summary */
             printf( CS_HELP );
 
+        } else
+        if ( strlen( csMani ) > 0 ) {
+
+            /* Manifest entries enumeration */
+            while ( lc_manifest_enum( csMani, csName, csFile, & csOffset, & csLength ) != LC_FALSE ) {
+
+                /* Create virtual logs-file stream */
+                if ( lc_stream_open( & csStream, csFile, csOffset, csLength ) == LC_TRUE ) {
+
+                    /* Audit virtual logs-file */
+                    cs_elphel_audit( csName, & csStream );
+
+                    /* Delete stream */
+                    lc_stream_close( & csStream );
+
+                /* Display message */
+                } else { fprintf( LC_ERR, "Error : unable to access %s\n", basename( csFile ) ); }
+
+            }
+
         } else {
 
             /* Directory entity enumeration */
@@ -77,10 +104,13 @@
                     if ( strstr( csFile, LC_PATTERN ) != 0 ) {
 
                         /* Create stream handle */
-                        if ( ( csStream = fopen( csFile, "rb" ) ) != NULL ) {
+                        if ( lc_stream_open( & csStream, csFile, 0, 0 ) == LC_TRUE ) {
 
                             /* Audit logs-file */
-                            cs_elphel_audit( csFile, csStream );
+                            cs_elphel_audit( csFile, & csStream );
+
+                            /* Delete stream */
+                            lc_stream_close( & csStream );
 
                         /* Display message */
                         } else { fprintf( LC_ERR, "Error : unable to access %s\n", basename( csFile ) ); }
@@ -104,14 +134,13 @@
 
     void cs_elphel_audit ( 
 
-        char const * const csFile, 
-        FILE       * const csStream 
+        char        const * const csFile, 
+        lc_Stream_t       * const csStream 
 
     ) {
 
         /* Logs-file size variables */
-        long csRead = 0;
-        long csSize = 0;
+        long csSize = csStream->smLength;
 
         /* Records buffer variables */
         lp_Byte_t csBuffer[LC_RECORD] = { 0 };
@@ -137,13 +166,10 @@
         lp_Time_t csGPSstpm = lp_Time_s( 0 );
 
         /* Reset initial position */
-        rewind( csStream );
+        lc_stream_rewind( csStream );
 
         /* Parse file */
-        while ( ( csRead = fread( csBuffer, 1, LC_RECORD, csStream ) ) == LC_RECORD ) {
-
-            /* Compute logs-file size */
-            csSize += csRead;
+        while ( lc_stream_read( csStream, csBuffer ) == LC_TRUE ) {
 
             /* Event type detection */
             if ( LC_EDM( csBuffer, LC_IMU ) ) {
@@ -233,9 +259,6 @@
 
         }
 
-        /* Finalize logs-file size computation */
-        csSize += csRead;
-
         /* Display information */
         fprintf( LC_OUT, "Auditing file %s\n", basename( ( char * ) csFile ) );
 
@@ -106,11 +106,12 @@
  */
 
     /* Standard help */
-    # define CS_HELP "Usage summary :\n\n"                  \
-    "\tcsps-elphel-audit [Arguments] [Parameters] ...\n\n"  \
-    "Short arguments and parameters summary :\n\n"          \
-    "\t-p\tDirectory containing the logs-files to audit\n\n" \
-    "csps-elphel-audit - csps-suite\n"                      \
+    # define CS_HELP "Usage summary :\n\n"                                \
+    "\tcsps-elphel-audit [Arguments] [Parameters] ...\n\n"                \
+    "Short arguments and parameters summary :\n\n"                        \
+    "\t-p\tDirectory containing the logs-files to audit\n"                \
+    "\t-m\tDecomposition manifest describing the logs-files to audit\n\n" \
+    "csps-elphel-audit - csps-suite\n"                                    \
     "Copyright (c) 2013-2015 FOXEL SA\n"
 
 /* 
@@ -135,6 +136,9 @@
      *  The logs-files are then openned and audited by a specific function. The
      *  audit results are printed using standard output.
      *  
+     *  If a decomposition manifest is provided, the virtual logs-files it
+     *  describes are audited instead of the input directory content.
+     *  
      *  \param  argc Standard main parameter
      *  \param  argv Standard main parameter
      *
@@ -150,13 +154,13 @@
      *  types.
      * 
      *  \param csFile   Path to logs-file to audit
-     *  \param csStream Handle to openned logs-file
+     *  \param csStream Openned logs-file records stream
      */
 
     void cs_elphel_audit ( 
 
-        char const * const csFile, 
-        FILE       * const csStream 
+        char        const * const csFile, 
+        lc_Stream_t       * const csStream 
 
     );
 
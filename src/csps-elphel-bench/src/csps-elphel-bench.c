@@ -0,0 +1,738 @@
+/*
+ * csps-suite - CSPS library front-end suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "csps-elphel-bench.h"
+
+/*
+    Source - Software main function
+ */
+
+    int main ( int argc, char ** argv ) {
+
+        /* Structure path variables */
+        char csBin[256] = { 0 };
+        char csWrk[256] = { 0 };
+        char csOut[256] = { 0 };
+        char csBas[256] = { 0 };
+
+        /* Corpora parameters variables */
+        char csSiz[256] = CS_SIZES;
+        char csSed[32]  = "1";
+
+        /* Corpora size variables */
+        char        * csToken = NULL;
+        unsigned long csSize  = 0;
+
+        /* Regression tolerance variables */
+        double csTolerance = 10.0;
+
+        /* Measures variables */
+        cs_Bench_t    csBench[CS_MEASURES];
+        unsigned long csCount = 0;
+        unsigned long csParse = 0;
+
+        /* Regressions count variables */
+        long csRegression = 0;
+
+        /* Stream variables */
+        FILE * csStream = NULL;
+
+        /* Returned variables */
+        int csReturn = EXIT_SUCCESS;
+
+        /* Search in parameters */
+        lc_stdp( lc_stda( argc, argv, "--binaries" , "-b" ), argv,   csBin      , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--work"     , "-w" ), argv,   csWrk      , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--sizes"    , "-z" ), argv,   csSiz      , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--seed"     , "-r" ), argv,   csSed      , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--output"   , "-o" ), argv,   csOut      , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--compare"  , "-c" ), argv,   csBas      , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--tolerance", "-t" ), argv, & csTolerance, LC_DOUBLE );
+
+        /* Execution switch */
+        if ( lc_stda( argc, argv, "--help", "-h" ) || ( argc <= 1 ) ) {
+
+            /* Display help summary */
+            printf( CS_HELP );
+
+        } else {
+
+            /* Check mandatory parameters */
+            if ( ( strlen( csBin ) == 0 ) || ( strlen( csWrk ) == 0 ) || ( strlen( csOut ) == 0 ) ) {
+
+                /* Display message */
+                fprintf( LC_ERR, "Error : softwares, working directory and results file are required\n" );
+
+                /* Return to system */
+                return( EXIT_FAILURE );
+
+            }
+
+            /* Create working directory */
+            mkdir( csWrk, 0755 );
+
+            /* Check working directory */
+            if ( lc_file_detect( csWrk, LC_DIRECTORY ) == LC_FALSE ) {
+
+                /* Display message */
+                fprintf( LC_ERR, "Error : unable to access %s\n", csWrk );
+
+                /* Return to system */
+                return( EXIT_FAILURE );
+
+            }
+
+            /* Parsing corpora sizes */
+            for ( csToken = strtok( csSiz, "," ); ( csToken != NULL ) && ( csReturn == EXIT_SUCCESS ); csToken = strtok( NULL, "," ) ) {
+
+                /* Check corpus size */
+                if ( ( csSize = strtoul( csToken, NULL, 10 ) ) == 0 ) {
+
+                    /* Display message */
+                    fprintf( LC_ERR, "Error : invalid corpus size %s\n", csToken );
+
+                    /* Update returned value */
+                    csReturn = EXIT_FAILURE;
+
+                } else if ( csCount + 6 > CS_MEASURES ) {
+
+                    /* Display message */
+                    fprintf( LC_ERR, "Error : too many corpora sizes, at most %d\n", CS_MEASURES / 6 );
+
+                    /* Update returned value */
+                    csReturn = EXIT_FAILURE;
+
+                } else {
+
+                    /* Corpus benchmark */
+                    if ( cs_elphel_bench( csBin, csWrk, csSize, csSed, csBench, & csCount ) == LC_FALSE ) csReturn = EXIT_FAILURE;
+
+                }
+
+            }
+
+            /* Create and check results stream */
+            if ( ( csStream = fopen( csOut, "w" ) ) == NULL ) {
+
+                /* Display message */
+                fprintf( LC_ERR, "Error : unable to access %s\n", basename( csOut ) );
+
+                /* Update returned value */
+                csReturn = EXIT_FAILURE;
+
+            } else {
+
+                /* Export measures */
+                for ( csParse = 0; csParse < csCount; csParse ++ ) cs_elphel_bench_export( csStream, csBench + csParse );
+
+                /* Close results stream */
+                fclose( csStream );
+
+            }
+
+            /* Check baseline comparison */
+            if ( strlen( csBas ) > 0 ) {
+
+                /* Compare measures to baseline */
+                if ( ( csRegression = cs_elphel_bench_compare( csBas, csBench, csCount, csTolerance ) ) < 0 ) {
+
+                    /* Display message */
+                    fprintf( LC_ERR, "Error : unable to access %s\n", basename( csBas ) );
+
+                    /* Update returned value */
+                    csReturn = EXIT_FAILURE;
+
+                } else if ( csRegression > 0 ) {
+
+                    /* Display message */
+                    fprintf( LC_ERR, "Error : %ld regression(s) detected\n", csRegression );
+
+                    /* Update returned value */
+                    csReturn = EXIT_FAILURE;
+
+                }
+
+            }
+
+        }
+
+        /* Return to system */
+        return( csReturn );
+
+    }
+
+/*
+    Source - Corpus benchmark
+ */
+
+    int cs_elphel_bench(
+
+        char       const * const csBinary,
+        char       const * const csWork,
+        unsigned long      const csSize,
+        char       const * const csSeed,
+        cs_Bench_t       * const csBench,
+        unsigned long    * const csCount
+
+    ) {
+
+        /* Benchmarked softwares */
+        char const * const csTools[6] = { "cat", "audit", "merge", "sort", "repair", "decompose" };
+
+        /* Corpus path variables */
+        char csCorpus[256] = { 0 };
+        char csRaw[320] = { 0 };
+        char csMrg[320] = { 0 };
+        char csSrt[320] = { 0 };
+        char csRep[320] = { 0 };
+        char csDec[320] = { 0 };
+        char csFil[640] = { 0 };
+
+        /* Softwares directories, source, destination and removed after execution */
+        char * const csSource[6] = { csRaw, csRaw, csRaw, csMrg, csSrt, csRep };
+        char * const csTarget[6] = { NULL , NULL , csMrg, csSrt, csRep, csDec };
+        char * const csRemove[6] = { NULL , NULL , csRaw, csMrg, csSrt, csRep };
+
+        /* Software path variables */
+        char csTool[320] = { 0 };
+
+        /* Corpus parameters variables */
+        char csFiles[32]    = { 0 };
+        char csDuration[32] = { 0 };
+        char csGaps[32]     = { 0 };
+
+        /* Command line variables */
+        char * csArgs[32] = { NULL };
+
+        /* Measure variables */
+        cs_Bench_t * csMeasure = NULL;
+
+        /* Parsing variables */
+        int csParse = 0;
+
+        /* Returned variables */
+        int csReturn = LC_TRUE;
+
+        /* Compose corpus directories */
+        sprintf( csCorpus, "%s/corpus-%lu", csWork, csSize );
+        sprintf( csRaw, "%s/raw"       , csCorpus );
+        sprintf( csMrg, "%s/merged"    , csCorpus );
+        sprintf( csSrt, "%s/sorted"    , csCorpus );
+        sprintf( csRep, "%s/repaired"  , csCorpus );
+        sprintf( csDec, "%s/decomposed", csCorpus );
+
+        /* Create corpus directories */
+        mkdir( csCorpus, 0755 );
+        mkdir( csRaw   , 0755 );
+
+        /* Compose corpus parameters */
+        sprintf( csFiles   , "%lu", ( csSize + CS_SPLIT - 1 ) / CS_SPLIT );
+        sprintf( csDuration, "%.6f", ( ( double ) csSize * 1048576.0 ) / ( double ) ( LC_RECORD * CS_FREQUENCY ) );
+        sprintf( csGaps    , "%lu", 1 + csSize / CS_GAPS );
+
+        /* Compose corpus generation command line */
+        sprintf( csTool, "%s/csps-elphel-synth", csBinary );
+
+        /* Assign corpus generation command line */
+        csArgs[ 0] = csTool;
+        csArgs[ 1] = "-d", csArgs[ 2] = csRaw;
+        csArgs[ 3] = "-f", csArgs[ 4] = csFiles;
+        csArgs[ 5] = "-t", csArgs[ 6] = csDuration;
+        csArgs[ 7] = "-r", csArgs[ 8] = ( char * ) csSeed;
+        csArgs[ 9] = "-o", csArgs[10] = CS_DISORDER;
+        csArgs[11] = "-c", csArgs[12] = CS_CORRUPT;
+        csArgs[13] = "-u", csArgs[14] = CS_DUPLICATE;
+        csArgs[15] = "-a", csArgs[16] = csGaps;
+        csArgs[17] = "-l", csArgs[18] = CS_GAP;
+        csArgs[19] = NULL;
+
+        /* Display information */
+        fprintf( LC_OUT, "Generating : corpus-%lu (%lu MB)\n", csSize, csSize );
+
+        /* Corpus generation */
+        if ( cs_elphel_bench_run( NULL, csArgs ) == LC_FALSE ) {
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : unable to generate corpus-%lu\n", csSize );
+
+            /* Update returned value */
+            csReturn = LC_FALSE;
+
+        }
+
+        /* Parsing benchmarked softwares */
+        for ( csParse = 0; ( csParse < 6 ) && ( csReturn == LC_TRUE ); csParse ++ ) {
+
+            /* Compose software path */
+            sprintf( csTool, "%s/csps-elphel-%s", csBinary, csTools[csParse] );
+
+            /* Initialize measure */
+            memset( csMeasure = csBench + ( * csCount ), 0, sizeof( cs_Bench_t ) );
+
+            /* Assign measure software and corpus */
+            strcpy( csMeasure->bnTool, csTools[csParse] ), csMeasure->bnSize = csSize;
+
+            /* Assign measure records count */
+            csMeasure->bnRecords = cs_elphel_bench_size( csSource[csParse] ) / LC_RECORD;
+
+            /* Create destination directory */
+            if ( csTarget[csParse] != NULL ) mkdir( csTarget[csParse], 0755 );
+
+            /* Switch on software command line */
+            if ( csParse == 0 ) {
+
+                /* Directory entity enumeration */
+                while ( lc_file_enum( csSource[csParse], csFil ) != LC_FALSE ) {
+
+                    /* Consider only logs-files */
+                    if ( ( lc_file_detect( csFil, LC_FILE ) == LC_TRUE ) && ( strstr( csFil, LC_PATTERN ) != 0 ) ) {
+
+                        /* Assign command line */
+                        csArgs[0] = csTool, csArgs[1] = "-l", csArgs[2] = csFil, csArgs[3] = "-f", csArgs[4] = "imgo", csArgs[5] = NULL;
+
+                        /* Software execution, continuing enumeration until its end */
+                        if ( cs_elphel_bench_run( csMeasure, csArgs ) == LC_FALSE ) csReturn = LC_FALSE;
+
+                    }
+
+                }
+
+            } else if ( csTarget[csParse] == NULL ) {
+
+                /* Assign command line */
+                csArgs[0] = csTool, csArgs[1] = "-p", csArgs[2] = csSource[csParse], csArgs[3] = NULL;
+
+                /* Software execution */
+                csReturn = cs_elphel_bench_run( csMeasure, csArgs );
+
+            } else {
+
+                /* Assign command line */
+                csArgs[0] = csTool, csArgs[1] = "-s", csArgs[2] = csSource[csParse], csArgs[3] = "-d", csArgs[4] = csTarget[csParse], csArgs[5] = NULL;
+
+                /* Software execution */
+                csReturn = cs_elphel_bench_run( csMeasure, csArgs );
+
+            }
+
+            /* Check software execution */
+            if ( csReturn == LC_FALSE ) {
+
+                /* Display message */
+                fprintf( LC_ERR, "Error : csps-elphel-%s failed on corpus-%lu\n", csTools[csParse], csSize );
+
+            } else {
+
+                /* Validate measure */
+                ( * csCount ) ++;
+
+                /* Display information */
+                fprintf( LC_OUT, "    %-9s : %9.3f s, %12.0f records/s, %8ld kB\n", csTools[csParse], csMeasure->bnWall, ( csMeasure->bnWall > 0.0 ) ? ( double ) csMeasure->bnRecords / csMeasure->bnWall : 0.0, csMeasure->bnPeak );
+
+            }
+
+            /* Remove source directory */
+            if ( csRemove[csParse] != NULL ) cs_elphel_bench_clear( csRemove[csParse] );
+
+        }
+
+        /* Remove corpus directories */
+        cs_elphel_bench_clear( csRaw );
+        cs_elphel_bench_clear( csMrg );
+        cs_elphel_bench_clear( csSrt );
+        cs_elphel_bench_clear( csRep );
+        cs_elphel_bench_clear( csDec );
+
+        /* Remove corpus directory */
+        rmdir( csCorpus );
+
+        /* Return benchmark status */
+        return( csReturn );
+
+    }
+
+/*
+    Source - Software execution measure
+ */
+
+    int cs_elphel_bench_run(
+
+        cs_Bench_t * const csBench,
+        char       * const * const csArgs
+
+    ) {
+
+        /* Time variables */
+        struct timespec csStart;
+        struct timespec csStop;
+
+        /* Resources usage variables */
+        struct rusage csUsage;
+
+        /* Io counters variables */
+        uint64_t csiIO[4] = { 0 };
+        uint64_t csoIO[4] = { 0 };
+
+        /* Process variables */
+        pid_t csPid    = 0;
+        int   csStatus = 0;
+
+        /* Descriptor variables */
+        int csDesc = -1;
+
+        /* Parsing variables */
+        int csParse = 0;
+
+        /* Read initial io counters */
+        cs_elphel_bench_io( csiIO );
+
+        /* Flush standard outputs before fork */
+        fflush( NULL );
+
+        /* Query monotonic clock */
+        clock_gettime( CLOCK_MONOTONIC, & csStart );
+
+        /* Create and check software process */
+        if ( ( csPid = fork() ) < 0 ) {
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : unable to start %s\n", basename( csArgs[0] ) );
+
+            /* Return failure */
+            return( LC_FALSE );
+
+        } else if ( csPid == 0 ) {
+
+            /* Open and check null device */
+            if ( ( csDesc = open( "/dev/null", O_WRONLY ) ) >= 0 ) {
+
+                /* Discard standard output */
+                dup2( csDesc, STDOUT_FILENO );
+
+                /* Delete descriptor */
+                close( csDesc );
+
+            }
+
+            /* Execute software */
+            execv( csArgs[0], csArgs );
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : unable to execute %s\n", csArgs[0] );
+
+            /* Terminate process */
+            _exit( EXIT_FAILURE );
+
+        }
+
+        /* Wait for software termination */
+        if ( wait4( csPid, & csStatus, 0, & csUsage ) < 0 ) return( LC_FALSE );
+
+        /* Query monotonic clock */
+        clock_gettime( CLOCK_MONOTONIC, & csStop );
+
+        /* Read final io counters */
+        cs_elphel_bench_io( csoIO );
+
+        /* Check measure */
+        if ( csBench != NULL ) {
+
+            /* Cumulate times */
+            csBench->bnWall   += ( double ) ( csStop.tv_sec - csStart.tv_sec ) + ( double ) ( csStop.tv_nsec - csStart.tv_nsec ) * 1e-9;
+            csBench->bnUser   += ( double ) csUsage.ru_utime.tv_sec + ( double ) csUsage.ru_utime.tv_usec * 1e-6;
+            csBench->bnSystem += ( double ) csUsage.ru_stime.tv_sec + ( double ) csUsage.ru_stime.tv_usec * 1e-6;
+
+            /* Update peak resident set size */
+            if ( csUsage.ru_maxrss > csBench->bnPeak ) csBench->bnPeak = csUsage.ru_maxrss;
+
+            /* Cumulate io counters */
+            for ( csParse = 0; csParse < 4; csParse ++ ) csoIO[csParse] -= csiIO[csParse];
+
+            /* Assign io counters */
+            csBench->bnRchar += csoIO[0];
+            csBench->bnWchar += csoIO[1];
+            csBench->bnRead  += csoIO[2];
+            csBench->bnWrite += csoIO[3];
+
+        }
+
+        /* Return software status */
+        return( ( WIFEXITED( csStatus ) && ( WEXITSTATUS( csStatus ) == EXIT_SUCCESS ) ) ? LC_TRUE : LC_FALSE );
+
+    }
+
+/*
+    Source - Process io counters
+ */
+
+    void cs_elphel_bench_io(
+
+        uint64_t csIO[4]
+
+    ) {
+
+        /* Io statistics variables */
+        char     csKey[32] = { 0 };
+        uint64_t csValue   = 0;
+
+        /* Stream variables */
+        FILE * csStream = NULL;
+
+        /* Initialise counters */
+        memset( csIO, 0, sizeof( uint64_t ) * 4 );
+
+        /* Create and check io statistics stream */
+        if ( ( csStream = fopen( CS_IO, "r" ) ) != NULL ) {
+
+            /* Read io statistics */
+            while ( fscanf( csStream, "%31s %" SCNu64, csKey, & csValue ) == 2 ) {
+
+                /* Assign io statistics */
+                if ( strcmp( csKey, "rchar:"       ) == 0 ) csIO[0] = csValue;
+                if ( strcmp( csKey, "wchar:"       ) == 0 ) csIO[1] = csValue;
+                if ( strcmp( csKey, "read_bytes:"  ) == 0 ) csIO[2] = csValue;
+                if ( strcmp( csKey, "write_bytes:" ) == 0 ) csIO[3] = csValue;
+
+            }
+
+            /* Delete io statistics stream */
+            fclose( csStream );
+
+        }
+
+    }
+
+/*
+    Source - Logs-files size
+ */
+
+    uint64_t cs_elphel_bench_size(
+
+        char const * const csDirectory
+
+    ) {
+
+        /* Entity path variables */
+        char csFil[640] = { 0 };
+
+        /* Returned size variables */
+        uint64_t csSize = 0;
+
+        /* Check directory */
+        if ( lc_file_detect( csDirectory, LC_DIRECTORY ) == LC_FALSE ) return( 0 );
+
+        /* Directory entity enumeration */
+        while ( lc_file_enum( csDirectory, csFil ) != LC_FALSE ) {
+
+            /* Consider only logs-files */
+            if ( ( lc_file_detect( csFil, LC_FILE ) == LC_TRUE ) && ( strstr( csFil, LC_PATTERN ) != 0 ) ) {
+
+                /* Cumulate logs-file size */
+                csSize += lc_file_size( csFil );
+
+            }
+
+        }
+
+        /* Return logs-files size */
+        return( csSize );
+
+    }
+
+/*
+    Source - Working directory removal
+ */
+
+    void cs_elphel_bench_clear(
+
+        char const * const csDirectory
+
+    ) {
+
+        /* Entity path variables */
+        char csFil[640] = { 0 };
+
+        /* Check directory */
+        if ( lc_file_detect( csDirectory, LC_DIRECTORY ) == LC_FALSE ) return;
+
+        /* Directory entity enumeration */
+        while ( lc_file_enum( csDirectory, csFil ) != LC_FALSE ) {
+
+            /* Remove file entity */
+            if ( lc_file_detect( csFil, LC_FILE ) == LC_TRUE ) remove( csFil );
+
+        }
+
+        /* Remove directory */
+        rmdir( csDirectory );
+
+    }
+
+/*
+    Source - Measure exportation
+ */
+
+    void cs_elphel_bench_export(
+
+        FILE             * const csStream,
+        cs_Bench_t const * const csBench
+
+    ) {
+
+        /* Export measure */
+        fprintf( csStream, "{\"tool\":\"%s\",\"size_mb\":%lu,\"records\":%" PRIu64, csBench->bnTool, csBench->bnSize, csBench->bnRecords );
+        fprintf( csStream, ",\"wall\":%.6f,\"user\":%.6f,\"system\":%.6f", csBench->bnWall, csBench->bnUser, csBench->bnSystem );
+        fprintf( csStream, ",\"records_per_s\":%.1f,\"peak_rss_kb\":%ld", ( csBench->bnWall > 0.0 ) ? ( double ) csBench->bnRecords / csBench->bnWall : 0.0, csBench->bnPeak );
+        fprintf( csStream, ",\"rchar\":%" PRIu64 ",\"wchar\":%" PRIu64 ",\"read_bytes\":%" PRIu64 ",\"write_bytes\":%" PRIu64 "}\n", csBench->bnRchar, csBench->bnWchar, csBench->bnRead, csBench->bnWrite );
+
+    }
+
+/*
+    Source - Measure importation
+ */
+
+    int cs_elphel_bench_import(
+
+        char       const * const csLine,
+        cs_Bench_t       * const csBench
+
+    ) {
+
+        /* Initialize measure */
+        memset( csBench, 0, sizeof( cs_Bench_t ) );
+
+        /* Import measure and check fields count */
+        if ( sscanf( csLine,
+
+            "{\"tool\":\"%31[^\"]\",\"size_mb\":%lu,\"records\":%" SCNu64 ",\"wall\":%lf,\"user\":%lf,\"system\":%lf,\"records_per_s\":%*f,\"peak_rss_kb\":%ld,\"rchar\":%" SCNu64 ",\"wchar\":%" SCNu64 ",\"read_bytes\":%" SCNu64 ",\"write_bytes\":%" SCNu64,
+            csBench->bnTool, & csBench->bnSize, & csBench->bnRecords, & csBench->bnWall, & csBench->bnUser, & csBench->bnSystem, & csBench->bnPeak, & csBench->bnRchar, & csBench->bnWchar, & csBench->bnRead, & csBench->bnWrite
+
+        ) == 11 ) return( LC_TRUE ); else return( LC_FALSE );
+
+    }
+
+/*
+    Source - Baseline comparison
+ */
+
+    long cs_elphel_bench_compare(
+
+        char       const * const csFile,
+        cs_Bench_t const * const csBench,
+        unsigned long      const csCount,
+        double             const csTolerance
+
+    ) {
+
+        /* Line buffer variables */
+        char csLine[1024] = { 0 };
+
+        /* Baseline measure variables */
+        cs_Bench_t csBase;
+
+        /* Parsing variables */
+        unsigned long csParse = 0;
+
+        /* Throughput and memory variations variables */
+        double csThroughput = 0.0;
+        double csMemory     = 0.0;
+
+        /* Regressions count variables */
+        long csRegression = 0;
+
+        /* Stream variables */
+        FILE * csStream = NULL;
+
+        /* Create and check baseline stream */
+        if ( ( csStream = fopen( csFile, "r" ) ) == NULL ) return( -1 );
+
+        /* Display information */
+        fprintf( LC_OUT, "Comparing : %s\n", basename( ( char * ) csFile ) );
+
+        /* Parsing baseline measures */
+        while ( fgets( csLine, sizeof( csLine ), csStream ) != NULL ) {
+
+            /* Import baseline measure */
+            if ( cs_elphel_bench_import( csLine, & csBase ) == LC_FALSE ) continue;
+
+            /* Search corresponding measure */
+            for ( csParse = 0; csParse < csCount; csParse ++ ) {
+
+                /* Check software and corpus size */
+                if ( ( strcmp( csBench[csParse].bnTool, csBase.bnTool ) != 0 ) || ( csBench[csParse].bnSize != csBase.bnSize ) ) continue;
+
+                /* Check measures validity */
+                if ( ( csBench[csParse].bnWall <= 0.0 ) || ( csBase.bnWall <= 0.0 ) || ( csBase.bnRecords == 0 ) || ( csBase.bnPeak <= 0 ) ) continue;
+
+                /* Compute throughput variation, in percents */
+                csThroughput = ( ( ( double ) csBench[csParse].bnRecords / csBench[csParse].bnWall ) / ( ( double ) csBase.bnRecords / csBase.bnWall ) - 1.0 ) * 100.0;
+
+                /* Compute peak memory variation, in percents */
+                csMemory = ( ( double ) csBench[csParse].bnPeak / ( double ) csBase.bnPeak - 1.0 ) * 100.0;
+
+                /* Display comparison */
+                fprintf( LC_OUT, "    %-9s %6lu MB : %+7.1f %% records/s, %+7.1f %% peak memory", csBase.bnTool, csBase.bnSize, csThroughput, csMemory );
+
+                /* Detect regression */
+                if ( ( csThroughput < - csTolerance ) || ( ( csMemory > csTolerance ) && ( csBench[csParse].bnPeak - csBase.bnPeak > CS_MEMORY ) ) ) {
+
+                    /* Display regression */
+                    fprintf( LC_OUT, " - regression\n" );
+
+                    /* Update regressions count */
+                    csRegression ++;
+
+                } else { fprintf( LC_OUT, "\n" ); }
+
+            }
+
+        }
+
+        /* Close baseline stream */
+        fclose( csStream );
+
+        /* Return regressions count */
+        return( csRegression );
+
+    }
+
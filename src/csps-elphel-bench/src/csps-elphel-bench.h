@@ -0,0 +1,418 @@
+/*
+ * csps-suite - CSPS library front-end suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   csps-elphel-bench.h
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *   
+     *  Software main header
+     */
+
+    /*! \mainpage csps-elphel-bench
+     *
+     *  \section csps-suite
+     *  \section _ CSPS library front-end suite
+     *
+     *  The csps-suite is dedicated to CSPS processing using libcsps. It provides 
+     *  a serie of softwares used for camera logs-files preparation and 
+     *  validation according to manufacturers standards. It comes with a main 
+     *  software that is responsible of CSPS processing of the camera logs-files 
+     *  and also offers softwares for CSPS processing results visualization and
+     *  exportation.
+     *
+     *  \section Documentation
+     *
+     *  A detailed documentation can be generated through doxygen. A more general
+     *  documentation can be consulted at https://github.com/FoxelSA/csps-suite/wiki.
+     *
+     *  \section Copyright
+     * 
+     *  Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch \n
+     *  This program is part of the FOXEL project <http://foxel.ch>.
+     *  
+     *  Please read the COPYRIGHT.md file for more information.
+     *
+     *  \section License
+     *
+     *  This program is licensed under the terms of the GNU Affero General Public
+     *  License v3 (GNU AGPL), with two additional terms. The content is licensed
+     *  under the terms of the Creative Commons Attribution-ShareAlike 4.0
+     *  International (CC BY-SA) license.
+     *
+     *  You must read <http://foxel.ch/license> for more information about our
+     *  Licensing terms and our Usage and Attribution guidelines.
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __CS_ELPHEL_BENCH__
+    # define __CS_ELPHEL_BENCH__
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    extern "C" {
+    # endif
+
+/* 
+    Header - Includes
+ */
+
+    # include <stdio.h>
+    # include <stdlib.h>
+    # include <string.h>
+    # include <stdint.h>
+    # include <inttypes.h>
+    # include <unistd.h>
+    # include <fcntl.h>
+    # include <time.h>
+    # include <libgen.h>
+    # include <sys/types.h>
+    # include <sys/stat.h>
+    # include <sys/wait.h>
+    # include <sys/time.h>
+    # include <sys/resource.h>
+    # include <csps-all.h>
+    # include <common-all.h>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Standard help */
+    # define CS_HELP "Usage summary :\n\n"                            \
+    "\tcsps-elphel-bench [Arguments] [Parameters] ...\n\n"            \
+    "Short arguments and parameters summary :\n\n"                    \
+    "\t-b\tDirectory containing the csps-suite softwares\n"           \
+    "\t-w\tWorking directory receiving the generated corpora\n"       \
+    "\t-z\tCorpora sizes, in megabytes, separated by commas\n"        \
+    "\t-r\tCorpora pseudo-random generator seed\n"                    \
+    "\t-o\tBenchmark results JSON file\n"                             \
+    "\t-c\tBaseline results JSON file to compare with\n"              \
+    "\t-t\tTolerance, in percents, before reporting a regression\n\n" \
+    "csps-elphel-bench - csps-suite\n"                                \
+    "Copyright (c) 2013-2015 FOXEL SA\n"
+
+    /* Define default corpora sizes, in megabytes */
+    # define CS_SIZES       "100,1000,5000,20000"
+
+    /* Define maximum number of measures */
+    # define CS_MEASURES    256
+
+    /* Define corpora logs-files size, in megabytes */
+    # define CS_SPLIT       64
+
+    /* Define corpora events frequency (IMU, master and GPS), in hertz */
+    # define CS_FREQUENCY   ( 2460 + 5 + 20 )
+
+    /* Define corpora injection parameters */
+    # define CS_DISORDER    "0.001"
+    # define CS_CORRUPT     "0.00001"
+    # define CS_DUPLICATE   "0.0001"
+    # define CS_GAP         "5"
+
+    /* Define corpora gaps density, in megabytes per gap */
+    # define CS_GAPS        1024
+
+    /* Define smallest reported peak memory increase, in kilobytes */
+    # define CS_MEMORY      1024
+
+    /* Define process io statistics file */
+    # define CS_IO          "/proc/self/io"
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+    /*! \struct cs_Bench_struct
+     *  \brief Benchmark measure
+     *
+     *  This structure holds the resources used by a software of the suite on a
+     *  corpus. When the software is executed more than once on the corpus, the
+     *  times and io counters are cumulated and the peak resident set size is
+     *  the largest one.
+     *
+     *  \var cs_Bench_struct::bnTool
+     *  Software name, without its "csps-elphel-" prefix
+     *  \var cs_Bench_struct::bnSize
+     *  Corpus size, in megabytes
+     *  \var cs_Bench_struct::bnRecords
+     *  Number of records read by the software
+     *  \var cs_Bench_struct::bnWall
+     *  Monotonic wall-clock time, in seconds
+     *  \var cs_Bench_struct::bnUser
+     *  User CPU time, in seconds
+     *  \var cs_Bench_struct::bnSystem
+     *  System CPU time, in seconds
+     *  \var cs_Bench_struct::bnPeak
+     *  Peak resident set size, in kilobytes
+     *  \var cs_Bench_struct::bnRchar
+     *  Bytes read through system calls
+     *  \var cs_Bench_struct::bnWchar
+     *  Bytes written through system calls
+     *  \var cs_Bench_struct::bnRead
+     *  Bytes read from the storage
+     *  \var cs_Bench_struct::bnWrite
+     *  Bytes written to the storage
+     */
+
+    typedef struct cs_Bench_struct {
+
+        char          bnTool[32];
+        unsigned long bnSize;
+        uint64_t      bnRecords;
+        double        bnWall;
+        double        bnUser;
+        double        bnSystem;
+        long          bnPeak;
+        uint64_t      bnRchar;
+        uint64_t      bnWchar;
+        uint64_t      bnRead;
+        uint64_t      bnWrite;
+
+    } cs_Bench_t;
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Software main function
+     *
+     *  The main function generates, for each requested size, a synthetic
+     *  corpus using csps-elphel-synth and runs the logs-files preparation
+     *  softwares on it in the order of a camera logs-files preparation : cat,
+     *  audit, merge, sort, repair and decompose. Each software works on the
+     *  output of the previous one, the intermediate logs-files being removed
+     *  as soon as they are not needed anymore.
+     *
+     *  The measures are exported in the results file as one JSON object per
+     *  line. If a baseline results file is provided, the measures are compared
+     *  to it and the regressions are reported.
+     *
+     *  \param  argc Standard main parameter
+     *  \param  argv Standard main parameter
+     *
+     *  \return Returns exit code, EXIT_FAILURE if a software failed or if a
+     *          regression is detected
+     */
+
+    int main ( int argc, char ** argv );
+
+    /*! \brief Corpus benchmark
+     *
+     *  This function generates the corpus of provided size and runs the
+     *  benchmarked softwares on it. The measures are appended to the provided
+     *  measures array. The measure of a failed software is not appended, so
+     *  that partial runs are neither exported nor compared.
+     *
+     *  \param  csBinary    Directory containing the csps-suite softwares
+     *  \param  csWork      Working directory
+     *  \param  csSize      Corpus size, in megabytes
+     *  \param  csSeed      Corpus pseudo-random generator seed
+     *  \param  csBench     Measures array
+     *  \param  csCount     Pointer to measures count, updated by the function
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE if a software failed
+     */
+
+    int cs_elphel_bench(
+
+        char       const * const csBinary,
+        char       const * const csWork,
+        unsigned long      const csSize,
+        char       const * const csSeed,
+        cs_Bench_t       * const csBench,
+        unsigned long    * const csCount
+
+    );
+
+    /*! \brief Software execution measure
+     *
+     *  This function executes the provided command line and waits for its
+     *  termination. The standard output of the software is discarded. The
+     *  times, peak resident set size and io counters of the execution are
+     *  cumulated in the provided measure. The io counters are obtained from
+     *  the CS_IO file of the calling process, which includes the counters of
+     *  its terminated children, and are left unchanged if it is not available.
+     *
+     *  \param  csBench     Measure structure, NULL to only execute
+     *  \param  csArgs      NULL terminated command line, the first element
+     *                      being the path to the software
+     *
+     *  \return Returns LC_TRUE if the software succeeded, LC_FALSE otherwise
+     */
+
+    int cs_elphel_bench_run(
+
+        cs_Bench_t * const csBench,
+        char       * const * const csArgs
+
+    );
+
+    /*! \brief Process io counters
+     *
+     *  This function reads the io counters of the calling process from the
+     *  CS_IO file. The counters are left to zero if the file is not available.
+     *
+     *  \param  csIO        Array recieving read and written bytes through
+     *                      system calls and read and written bytes from and
+     *                      to the storage
+     */
+
+    void cs_elphel_bench_io(
+
+        uint64_t csIO[4]
+
+    );
+
+    /*! \brief Logs-files size
+     *
+     *  This function computes the size, in bytes, of the logs-files contained
+     *  in the provided directory.
+     *
+     *  \param  csDirectory Path to the directory
+     *
+     *  \return Returns logs-files size, in bytes
+     */
+
+    uint64_t cs_elphel_bench_size(
+
+        char const * const csDirectory
+
+    );
+
+    /*! \brief Working directory removal
+     *
+     *  This function removes the files contained in the provided directory
+     *  and the directory itself.
+     *
+     *  \param  csDirectory Path to the directory
+     */
+
+    void cs_elphel_bench_clear(
+
+        char const * const csDirectory
+
+    );
+
+    /*! \brief Measure exportation
+     *
+     *  This function exports the provided measure in the provided stream as a
+     *  single line JSON object. The throughput is given in records per second.
+     *
+     *  \param  csStream    Output stream
+     *  \param  csBench     Measure to export
+     */
+
+    void cs_elphel_bench_export(
+
+        FILE             * const csStream,
+        cs_Bench_t const * const csBench
+
+    );
+
+    /*! \brief Measure importation
+     *
+     *  This function reads a measure from the provided single line JSON object
+     *  as exported by cs_elphel_bench_export.
+     *
+     *  \param  csLine      JSON object string
+     *  \param  csBench     Measure structure recieving the imported measure
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int cs_elphel_bench_import(
+
+        char       const * const csLine,
+        cs_Bench_t       * const csBench
+
+    );
+
+    /*! \brief Baseline comparison
+     *
+     *  This function compares the provided measures to the ones of the
+     *  provided baseline results file that have the same software and corpus
+     *  size. A regression is reported when the throughput decreases or when
+     *  the peak resident set size increases by more than the provided
+     *  tolerance. Peak resident set size increases below CS_MEMORY are not
+     *  reported, as they are dominated by measure noise on small corpora.
+     *
+     *  \param  csFile      Path to the baseline results file
+     *  \param  csBench     Measures array
+     *  \param  csCount     Measures count
+     *  \param  csTolerance Tolerance, in percents
+     *
+     *  \return Returns the number of detected regressions, -1 if the baseline
+     *          file is not readable
+     */
+
+    long cs_elphel_bench_compare(
+
+        char       const * const csFile,
+        cs_Bench_t const * const csBench,
+        unsigned long      const csCount,
+        double             const csTolerance
+
+    );
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    }
+    # endif
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
@@ -52,7 +52,19 @@
         /* Structure path variables */
         char csSrc[256] = { 0 };
         char csDst[256] = { 0 };
-        char csFil[256] = { 0 };
+        char csMan[256] = { 0 };
+
+        /* Manifest stream variables */
+        FILE * csManifest = NULL;
+
+        /* Logs-files array variables */
+        cs_Log_t * csLogs = NULL;
+
+        /* Logs-files count variables */
+        long csCount = 0;
+
+        /* Parsing variables */
+        long csParse = 0;
 
         /* Decomposition index variables */
         long csIndex = 1;
@@ -60,10 +72,24 @@
         /* Decompostion condition variables */
         double csInterval = 1.0;
 
+        /* Threads count variables */
+        int csThreads = 0;
+
+        /* Devices variables */
+        char csDev[256] = { 0 };
+
+        /* Devices splitting variables */
+        int csDevice = 0;
+
+        /* Camera records condition variables */
+        int csCamera = LC_FALSE;
+
         /* Search in parameters */
         lc_stdp( lc_stda( argc, argv, "--source"     , "-s" ), argv,   csSrc     , LC_STRING );
         lc_stdp( lc_stda( argc, argv, "--destination", "-d" ), argv,   csDst     , LC_STRING );
         lc_stdp( lc_stda( argc, argv, "--interval"   , "-i" ), argv, & csInterval, LC_DOUBLE );
+        lc_stdp( lc_stda( argc, argv, "--threads"    , "-t" ), argv, & csThreads , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--device"     , "-e" ), argv,   csDev     , LC_STRING );
 
         /* Execution switch */
         if ( lc_stda( argc, argv, "--help", "-h" ) || ( argc <= 1 ) ) {
@@ -73,24 +99,105 @@
 
         } else {
 
-            /* Directory entity enumeration */
-            while ( lc_file_enum( csSrc, csFil ) != LC_FALSE ) {
+            /* Check virtual decomposition mode */
+            if ( lc_stda( argc, argv, "--virtual", "-v" ) ) {
 
-                /* Consider only file entity */
-                if ( lc_file_detect( csFil, LC_FILE ) == LC_TRUE ) {
+                /* Compose manifest path */
+                sprintf( csMan, "%s/" LC_MANIFEST, csDst );
 
-                    /* Check log-file tag */
-                    if ( strstr( csFil, LC_PATTERN ) != 0 ) {
+                /* Create and check manifest stream */
+                if ( ( csManifest = fopen( csMan, "w" ) ) == NULL ) {
 
-                        /* Decomposition process */
-                        csIndex = cs_elphel_decompose( csFil, csDst, csIndex, csInterval );
+                    /* Display message */
+                    fprintf( LC_ERR, "Error : unable to access %s\n", basename( csMan ) );
 
-                    }
+                    /* Return to system */
+                    return( EXIT_FAILURE );
+
+                }
+
+            }
+
+            /* Compose devices splitting flags */
+            if ( strchr( csDev, 'i' ) != NULL ) csDevice |= CS_IMU;
+            if ( strchr( csDev, 'm' ) != NULL ) csDevice |= CS_MAS;
+            if ( strchr( csDev, 'g' ) != NULL ) csDevice |= CS_GPS;
+
+            /* Check camera records condition */
+            if ( lc_stda( argc, argv, "--camera", "-c" ) ) csCamera = LC_TRUE;
+
+            # ifdef __OPENMP__
+
+            /* Apply threads count */
+            if ( csThreads > 0 ) omp_set_num_threads( csThreads );
+
+            # endif
+
+            /* Enumerate logs-files */
+            csLogs = cs_elphel_decompose_list( csSrc, & csCount );
+
+            /* Segments detection process */
+            # ifdef __OPENMP__
+            # pragma omp parallel for schedule( dynamic, 1 )
+            # endif
+            for ( csParse = 0; csParse < csCount; csParse ++ ) {
+
+                /* Detect logs-file segments */
+                csLogs[csParse].lgSegment = cs_elphel_decompose_scan( csLogs[csParse].lgPath, csInterval, csDevice, csCamera, & csLogs[csParse].lgCount );
+
+            }
+
+            /* Parsing logs-files */
+            for ( csParse = 0; csParse < csCount; csParse ++ ) {
+
+                /* Assign logs-file first decomposition index */
+                csLogs[csParse].lgIndex = csIndex;
+
+                /* Update decomposition index */
+                csIndex += csLogs[csParse].lgCount;
+
+            }
+
+            /* Check decomposition mode */
+            if ( csManifest == NULL ) {
+
+                /* Decomposition process */
+                # ifdef __OPENMP__
+                # pragma omp parallel for schedule( dynamic, 1 )
+                # endif
+                for ( csParse = 0; csParse < csCount; csParse ++ ) {
+
+                    /* Logs-file decomposition */
+                    cs_elphel_decompose( csLogs + csParse, csDst );
 
                 }
 
+            } else {
+
+                /* Virtual decomposition process */
+                for ( csParse = 0; csParse < csCount; csParse ++ ) {
+
+                    /* Logs-file virtual decomposition */
+                    cs_elphel_decompose_virtual( csLogs + csParse, csManifest );
+
+                }
+
+                /* Close manifest stream */
+                fclose( csManifest );
+
             }
 
+            /* Parsing logs-files */
+            for ( csParse = 0; csParse < csCount; csParse ++ ) {
+
+                /* Release segments array */
+                free( csLogs[csParse].lgSegment );
+
+            }
+
+            /* Release logs-files array */
+            free( csLogs );
+
         }
 
         /* Return to system */
@@ -98,87 +205,400 @@
 
     }
 
+/*
+    Source - Logs-files enumeration
+*/
+
+    cs_Log_t * cs_elphel_decompose_list(
+
+        char const * const csDirectory,
+        long       * const csCount
+
+    ) {
+
+        /* Logs-files array variables */
+        cs_Log_t * csLogs = NULL;
+        cs_Log_t * csSwap = NULL;
+
+        /* Logs-files capacity variables */
+        long csCapacity = 0;
+
+        /* Entity path variables */
+        char csFil[256] = { 0 };
+
+        /* Reset logs-files count */
+        * csCount = 0;
+
+        /* Directory entity enumeration */
+        while ( lc_file_enum( csDirectory, csFil ) != LC_FALSE ) {
+
+            /* Consider only file entity */
+            if ( lc_file_detect( csFil, LC_FILE ) == LC_TRUE ) {
+
+                /* Check log-file tag */
+                if ( strstr( csFil, LC_PATTERN ) != 0 ) {
+
+                    /* Check logs-files capacity */
+                    if ( ( * csCount ) == csCapacity ) {
+
+                        /* Update logs-files capacity */
+                        csCapacity = ( csCapacity == 0 ) ? 16 : csCapacity << 1;
+
+                        /* Reallocate and check logs-files array */
+                        if ( ( csSwap = ( cs_Log_t * ) realloc( csLogs, csCapacity * sizeof( cs_Log_t ) ) ) == NULL ) {
+
+                            /* Display message */
+                            fprintf( LC_ERR, "Error : unable to allocate memory\n" );
+
+                            /* Stop enumeration */
+                            break;
+
+                        }
+
+                        /* Assign reallocated array */
+                        csLogs = csSwap;
+
+                    }
+
+                    /* Initialize logs-file descriptor */
+                    memset( csLogs + ( * csCount ), 0, sizeof( cs_Log_t ) );
+
+                    /* Assign logs-file path */
+                    strcpy( csLogs[( * csCount ) ++].lgPath, csFil );
+
+                }
+
+            }
+
+        }
+
+        /* Return logs-files array */
+        return( csLogs );
+
+    }
+
 /*
     Source - Logs-file decomposer
 */
 
-    long cs_elphel_decompose( 
+    void cs_elphel_decompose(
 
-        char   const * const csLog, 
-        char   const * const csDirectory, 
-        long                 csIndex, 
-        double const         csInterval 
+        cs_Log_t const * const csLog,
+        char     const * const csDirectory
 
     ) {
 
-        /* Records buffer variables */
-        lp_Byte_t csRec[LC_RECORD] = { 0 };
+        /* Parsing variables */
+        long csParse = 0;
+
+        /* Copy status variables */
+        int csStatus = LC_TRUE;
 
         /* Decomposition path variables */
         char csSeg[256] = { 0 };
 
+        /* Parsing segments */
+        for ( csParse = 0; csParse < csLog->lgCount; csParse ++ ) {
+
+            /* Compose decomposition segment path */
+            sprintf( csSeg, "%s/log-container.log-%05li", csDirectory, csLog->lgIndex + csParse );
+
+            /* Copy and check segment range */
+            if ( lc_file_range( csLog->lgPath, csSeg, csLog->lgSegment[csParse].sgOffset, csLog->lgSegment[csParse].sgLength ) != csLog->lgSegment[csParse].sgLength ) {
+
+                /* Display message */
+                fprintf( LC_ERR, "Error : unable to access %s\n", basename( csSeg ) );
+
+                /* Update copy status */
+                csStatus = LC_FALSE;
+
+            }
+
+        }
+
+        /* Check copy status */
+        if ( ( csStatus == LC_TRUE ) && ( csLog->lgCount > 0 ) ) {
+
+            /* Serialize display */
+            # ifdef __OPENMP__
+            # pragma omp critical
+            # endif
+            {
+
+                /* Display decomposition information */
+                fprintf( LC_OUT, "Decomposing : %s\n", basename( ( char * ) csLog->lgPath ) );
+
+                /* Parsing segments */
+                for ( csParse = 0; csParse < csLog->lgCount; csParse ++ ) {
+
+                    /* Display decomposition information */
+                    fprintf( LC_OUT, "    log-container.log-%05li\n", csLog->lgIndex + csParse );
+
+                }
+
+            }
+
+        }
+
+    }
+
+/*
+    Source - Logs-file virtual decomposer
+*/
+
+    void cs_elphel_decompose_virtual(
+
+        cs_Log_t const * const csLog,
+        FILE           * const csManifest
+
+    ) {
+
+        /* Parsing variables */
+        long csParse = 0;
+
+        /* Decomposition name variables */
+        char csSeg[256] = { 0 };
+
+        /* Source path variables */
+        char * csReal = NULL;
+
+        /* Check logs-file segments */
+        if ( csLog->lgCount > 0 ) {
+
+            /* Resolve source absolute path */
+            if ( ( csReal = realpath( csLog->lgPath, NULL ) ) == NULL ) {
+
+                /* Display message */
+                fprintf( LC_ERR, "Error : unable to resolve %s\n", basename( ( char * ) csLog->lgPath ) );
+
+            } else if ( strlen( csReal ) >= LC_MANIFEST_PATH ) {
+
+                /* Display message */
+                fprintf( LC_ERR, "Error : %s resolved path is too long for manifest\n", basename( ( char * ) csLog->lgPath ) );
+
+                /* Release source path */
+                free( csReal );
+
+            } else {
+
+                /* Display decomposition information */
+                fprintf( LC_OUT, "Decomposing : %s\n", basename( ( char * ) csLog->lgPath ) );
+
+                /* Parsing segments */
+                for ( csParse = 0; csParse < csLog->lgCount; csParse ++ ) {
+
+                    /* Compose segment name */
+                    sprintf( csSeg, "log-container.log-%05li", csLog->lgIndex + csParse );
+
+                    /* Export manifest entry */
+                    lc_manifest_write( csManifest, csSeg, csReal, csLog->lgSegment[csParse].sgOffset, csLog->lgSegment[csParse].sgLength );
+
+                    /* Display decomposition information */
+                    fprintf( LC_OUT, "    %s\n", csSeg );
+
+                }
+
+                /* Release source path */
+                free( csReal );
+
+            }
+
+        }
+
+    }
+
+/*
+    Source - Logs-file segments detection
+*/
+
+    cs_Segment_t * cs_elphel_decompose_scan( 
+
+        char   const * const csLog, 
+        double const         csInterval, 
+        int    const         csDevice,
+        int    const         csCamera,
+        long         * const csCount
+
+    ) {
+
+        /* Records block variables */
+        lp_Byte_t * csBlock = NULL;
+        lp_Byte_t * csRecord = NULL;
+
+        /* Block parsing variables */
+        size_t csRead  = 0;
+        size_t csParse = 0;
+
+        /* Device variables */
+        int csType = 0;
+
+        /* Splitting condition variables */
+        int csSplit = LC_FALSE;
+
         /* Timestamp variables */
         lp_Time_t cspTime = 0;
         lp_Time_t cscTime = 0;
 
+        /* Devices timestamp variables */
+        lp_Time_t csLast[3] = { 0 };
+
+        /* Offset variables */
+        size_t csOffset = 0;
+
+        /* Segments variables */
+        cs_Segment_t * csSegment = NULL;
+        cs_Segment_t * csSwap    = NULL;
+
+        /* Segments capacity variables */
+        long csCapacity = 0;
+
+        /* Segments compaction variables */
+        long csKeep = 0;
+        long csSeek = 0;
+
         /* Stream handle variables */
-        FILE * csIStream = NULL;
-        FILE * csOStream = NULL;
+        FILE * csStream = NULL;
 
-        /* Create and check input stream creation */
-        if ( ( csIStream = fopen( csLog, "rb" ) ) != NULL ) {
+        /* Reset segments count */
+        * csCount = 0;
 
-            /* Compose initial decomposition segment path */
-            sprintf( csSeg, "%s/log-container.log-%05li", csDirectory, csIndex ++ );
+        /* Create and check input stream */
+        if ( ( csStream = fopen( csLog, "rb" ) ) == NULL ) {
 
-            /* Create and check output stream creation */
-            if ( ( csOStream = fopen( csSeg, "wb" ) ) != NULL ) { 
+            /* Display message */
+            fprintf( LC_ERR, "Error : unable to access %s\n", basename( ( char * ) csLog ) );
 
-                /* Display decomposition information */
-                fprintf( LC_OUT, "Decomposing : %s\n    %s\n", basename( ( char * ) csLog ), basename( csSeg ) );
+            /* Return null pointer */
+            return( NULL );
 
-                /* Parsing input stream */
-                while ( fread( csRec, 1, LC_RECORD, csIStream ) == LC_RECORD ) {
+        }
 
-                    /* Read record timestamp */
-                    cscTime = LC_TSR( csRec );
+        /* Allocate and check records block */
+        if ( ( csBlock = ( lp_Byte_t * ) malloc( CS_BLOCK * LC_RECORD ) ) == NULL ) {
 
-                    /* Check splitting condition */
-                    if ( ( cspTime != 0 ) && ( lp_timestamp_float( lp_timestamp_diff( cscTime, cspTime ) ) > csInterval ) ) {
+            /* Display message */
+            fprintf( LC_ERR, "Error : unable to allocate memory\n" );
 
-                        /* Update decomposition segment path */
-                        sprintf( csSeg, "%s/log-container.log-%05li", csDirectory, csIndex ++ );
+            /* Close input stream */
+            fclose( csStream );
 
-                        /* Reset output stream */
-                        fclose( csOStream ); csOStream = fopen( csSeg, "wb" );
+            /* Return null pointer */
+            return( NULL );
 
-                        /* Display decomposition information */
-                        fprintf( LC_OUT, "    %s\n", basename( csSeg ) );
+        }
 
-                    }
+        /* Parsing input stream by blocks */
+        while ( ( csRead = fread( csBlock, LC_RECORD, CS_BLOCK, csStream ) ) > 0 ) {
+
+            /* Parsing block records */
+            for ( csParse = 0; csParse < csRead; csParse ++ ) {
+
+                /* Compute record pointer */
+                csRecord = csBlock + csParse * LC_RECORD;
+
+                /* Read record timestamp */
+                cscTime = LC_TSR( csRecord );
 
-                    /* Memorize previous timestamp */
-                    cspTime = cscTime;
+                /* Detect record device */
+                csType = LC_EDM( csRecord, LC_IMU ) ? 0 : ( LC_EDM( csRecord, LC_MAS ) ? 1 : ( LC_EDM( csRecord, LC_GPS ) ? 2 : -1 ) );
 
-                    /* Write recored in output stream */
-                    if ( csOStream != NULL ) fwrite( csRec, 1, LC_RECORD, csOStream );
+                /* Check any-record splitting condition */
+                csSplit = ( cspTime != 0 ) && ( lp_timestamp_float( lp_timestamp_diff( cscTime, cspTime ) ) > csInterval );
+
+                /* Restart devices streams on any-record splitting */
+                if ( csSplit != LC_FALSE ) memset( csLast, 0, sizeof( csLast ) );
+
+                /* Check device splitting condition */
+                if ( ( csSplit == LC_FALSE ) && ( csDevice != 0 ) ) {
+
+                    /* Check selected device stream gap */
+                    csSplit = ( csType >= 0 ) && ( ( csDevice & ( 1 << csType ) ) != 0 ) && ( csLast[csType] != 0 ) && ( lp_timestamp_float( lp_timestamp_diff( cscTime, csLast[csType] ) ) > csInterval );
 
                 }
 
-                /* Close output stream */
-                if ( csOStream != NULL ) fclose( csIStream );
+                /* Check splitting condition */
+                if ( ( ( * csCount ) == 0 ) || ( csSplit != LC_FALSE ) ) {
 
-            /* Display message */
-            } else { fprintf( LC_ERR, "Error : unable to access %s\n", basename( csSeg ) ); }
+                    /* Check segments capacity */
+                    if ( ( * csCount ) == csCapacity ) {
 
-            /* Close input stream */
-            fclose( csOStream );
+                        /* Update segments capacity */
+                        csCapacity = ( csCapacity == 0 ) ? 16 : csCapacity << 1;
+
+                        /* Reallocate and check segments array */
+                        if ( ( csSwap = ( cs_Segment_t * ) realloc( csSegment, csCapacity * sizeof( cs_Segment_t ) ) ) == NULL ) {
+
+                            /* Display message */
+                            fprintf( LC_ERR, "Error : unable to allocate memory\n" );
+
+                            /* Release memory */
+                            free( csSegment );
+                            free( csBlock   );
+
+                            /* Close input stream */
+                            fclose( csStream );
+
+                            /* Reset segments count */
+                            * csCount = 0;
+
+                            /* Return null pointer */
+                            return( NULL );
+
+                        }
 
-        /* Display message */
-        } else { fprintf( LC_ERR, "Error : unable to access %s\n", basename( ( char * ) csLog ) ); }
+                        /* Assign reallocated array */
+                        csSegment = csSwap;
+
+                    }
+
+                    /* Initialize segment */
+                    csSegment[( * csCount ) ++] = ( cs_Segment_t ) { csOffset, 0, 0 };
+
+                }
+
+                /* Memorize previous timestamp */
+                cspTime = cscTime;
+
+                /* Memorize device previous timestamp */
+                if ( csType >= 0 ) csLast[csType] = cscTime;
+
+                /* Update segment camera records count */
+                if ( csType == 1 ) csSegment[( * csCount ) - 1].sgCamera ++;
+
+                /* Update segment length */
+                csSegment[( * csCount ) - 1].sgLength += LC_RECORD;
+
+                /* Update offset */
+                csOffset += LC_RECORD;
+
+            }
+
+        }
+
+        /* Release records block */
+        free( csBlock );
+
+        /* Close input stream */
+        fclose( csStream );
+
+        /* Check camera records condition */
+        if ( csCamera == LC_TRUE ) {
+
+            /* Parsing segments */
+            for ( csSeek = 0; csSeek < ( * csCount ); csSeek ++ ) {
+
+                /* Keep segments with camera records */
+                if ( csSegment[csSeek].sgCamera > 0 ) csSegment[csKeep ++] = csSegment[csSeek];
+
+            }
+
+            /* Update segments count */
+            * csCount = csKeep;
+
+        }
 
-        /* Return decomposition index */
-        return( csIndex );
+        /* Return segments array */
+        return( csSegment );
 
     }
 
@@ -103,21 +103,36 @@
     # include <dirent.h>
     # include <csps-all.h>
     # include <common-all.h>
+    # ifdef __OPENMP__
+    # include <omp.h>
+    # endif
 
 /* 
     Header - Preprocessor definitions
  */
 
     /* Standard help */
-    # define CS_HELP "Usage summary :\n\n"                                \
-    "\tcsps-elphel-decompose [Arguments] [Parameters] ...\n\n"            \
-    "Short arguments and parameters summary :\n\n"                        \
-    "\t-s\tDirectory path containing the logs-files to decompose\n"       \
-    "\t-d\tDirectory path where decomposed logs-files are exported\n"     \
-    "\t-i\tSmallest time interval, in seconds, that induce splitting\n\n" \
-    "csps-elphel-decompose - csps-suite\n"                                \
+    # define CS_HELP "Usage summary :\n\n"                                    \
+    "\tcsps-elphel-decompose [Arguments] [Parameters] ...\n\n"                \
+    "Short arguments and parameters summary :\n\n"                            \
+    "\t-s\tDirectory path containing the logs-files to decompose\n"           \
+    "\t-d\tDirectory path where decomposed logs-files are exported\n"         \
+    "\t-i\tSmallest time interval, in seconds, that induce splitting\n"       \
+    "\t-v\tExport a segments manifest, read by csps-elphel-audit only\n"      \
+    "\t-t\tNumber of threads used for decomposition\n"                        \
+    "\t-e\tDevices streams checked for gaps (i : IMU, m : camera, g : GPS)\n" \
+    "\t-c\tDiscard segments that contain no camera records\n\n"               \
+    "csps-elphel-decompose - csps-suite\n"                                    \
     "Copyright (c) 2013-2015 FOXEL SA\n"
 
+    /* Define scan block size, in records */
+    # define CS_BLOCK 16384
+
+    /* Define devices splitting flags */
+    # define CS_IMU   0x01
+    # define CS_MAS   0x02
+    # define CS_GPS   0x04
+
 /* 
     Header - Preprocessor macros
  */
@@ -130,6 +145,53 @@
     Header - Structures
  */
 
+    /*! \struct cs_Segment_struct
+     *  \brief Decomposition segment
+     *
+     *  This structure describes a continuous records sequence detected in a
+     *  logs-file through its byte range.
+     *
+     *  \var cs_Segment_struct::sgOffset
+     *  Offset, in bytes, of the segment first record
+     *  \var cs_Segment_struct::sgLength
+     *  Length, in bytes, of the segment
+     *  \var cs_Segment_struct::sgCamera
+     *  Number of camera records of the segment
+     */
+
+    typedef struct cs_Segment_struct {
+
+        size_t sgOffset;
+        size_t sgLength;
+        long   sgCamera;
+
+    } cs_Segment_t;
+
+    /*! \struct cs_Log_struct
+     *  \brief Decomposition logs-file
+     *
+     *  This structure holds the segments detected in an input logs-file and
+     *  the decomposition index of its first segment.
+     *
+     *  \var cs_Log_struct::lgPath
+     *  Input logs-file path
+     *  \var cs_Log_struct::lgSegment
+     *  Logs-file segments array
+     *  \var cs_Log_struct::lgCount
+     *  Logs-file segments count
+     *  \var cs_Log_struct::lgIndex
+     *  Decomposition index of the first segment
+     */
+
+    typedef struct cs_Log_struct {
+
+        char           lgPath[256];
+        cs_Segment_t * lgSegment;
+        long           lgCount;
+        long           lgIndex;
+
+    } cs_Log_t;
+
 /* 
     Header - Function prototypes
  */
@@ -140,6 +202,12 @@
      *  directory and split the logs-files that contain more than one continuous
      *  records sequence based on their timestamp intervals analysis.
      *  
+     *  The decomposition is performed in two phases. The segments of each
+     *  logs-file are first detected in parallel. The decomposition indexes are
+     *  then assigned following the enumeration order, so that the exported
+     *  logs-files are named as in a serial decomposition, and the segments are
+     *  finally exported in parallel.
+     *
      *  \param  argc Standard main parameter
      *  \param  argv Standard main parameter
      *
@@ -148,6 +216,25 @@
 
     int main ( int argc, char ** argv );
 
+    /*! \brief Logs-files enumeration
+     *
+     *  This function enumerates the logs-files of the provided directory and
+     *  returns an allocated array of logs-files descriptors, in enumeration
+     *  order. The array has to be released by the caller.
+     *
+     *  \param  csDirectory Directory containing the logs-files
+     *  \param  csCount     Pointer to the variable that recieves logs-files count
+     *
+     *  \return Returns logs-files array
+     */
+
+    cs_Log_t * cs_elphel_decompose_list (
+
+        char const * const csDirectory,
+        long       * const csCount
+
+    );
+
     /*! \brief Logs-file decomposer
      * 
      *  This function opens the input logs-file and tests if a too wide interval
@@ -155,20 +242,73 @@
      *  detected, the function separates continuous events records sequences in
      *  differents output logs-files.
      *
-     *  \param  csLog       Input logs-file path
+     *  The segments have to be detected by a previous scan of the records
+     *  timestamps. Each segment is then copied as a whole byte range in its
+     *  output file.
+     *
+     *  \param  csLog       Logs-file descriptor
      *  \param  csDirectory Output directory
-     *  \param  csIndex     Current index of the decomposition
+     */
+
+    void cs_elphel_decompose (
+
+        cs_Log_t const * const csLog,
+        char     const * const csDirectory
+
+    );
+
+    /*! \brief Logs-file virtual decomposer
+     *
+     *  This function performs the same analysis as the logs-file decomposer
+     *  but does not copy the records. Instead, each detected continuous records
+     *  sequence is written as an entry of the provided manifest stream, giving
+     *  its byte range in the input logs-file. Such entries are then read back
+     *  as virtual logs-files.
+     *
+     *  The manifest is only read by csps-elphel-audit for now. The other
+     *  softwares of the suite and libcsps still expect logs-files copies.
+     *
+     *  \param  csLog       Logs-file descriptor
+     *  \param  csManifest  Manifest stream
+     */
+
+    void cs_elphel_decompose_virtual (
+
+        cs_Log_t const * const csLog,
+        FILE           * const csManifest
+
+    );
+
+    /*! \brief Logs-file segments detection
+     *
+     *  This function reads the timestamps of the records of the input logs-file
+     *  and detects the continuous records sequences. The logs-file is read by
+     *  blocks of CS_BLOCK records. The function returns an allocated array of
+     *  segments that has to be released by the caller.
+     *
+     *  A segment is ended as soon as two successive records, whatever their
+     *  type, are separated by a too wide interval. If devices are specified,
+     *  the last timestamp of each device is also tracked and a segment is ended
+     *  when a too wide interval appears in the stream of one of the specified
+     *  devices. This allows to detect camera or GPS outages that are hidden by
+     *  the high rate IMU records.
+     *
+     *  \param  csLog       Input logs-file path
      *  \param  csInterval  Maximum admited time gap between events timestamps
+     *  \param  csDevice    Devices flags, zero to consider only any-record gaps
+     *  \param  csCamera    Discard segments without camera records if LC_TRUE
+     *  \param  csCount     Pointer to the variable that recieves segments count
      *
-     *  \return Returns updated decomposition index
+     *  \return Returns segments array, NULL pointer on error
      */
 
-    long cs_elphel_decompose ( 
+    cs_Segment_t * cs_elphel_decompose_scan (
 
         char   const * const csLog, 
-        char   const * const csDirectory, 
-        long                 csIndex, 
-        double const         csInterval 
+        double const         csInterval,
+        int    const         csDevice,
+        int    const         csCamera,
+        long         * const csCount
 
     );
 
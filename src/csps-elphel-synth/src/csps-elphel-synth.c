@@ -0,0 +1,832 @@
+/*
+ * csps-suite - CSPS library front-end suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "csps-elphel-synth.h"
+
+/*
+    Source - Software main function
+ */
+
+    int main ( int argc, char ** argv ) {
+
+        /* Structure path variables */
+        char csDst[256] = { 0 };
+        char csFil[256] = { 0 };
+
+        /* Synthetic recording variables */
+        cs_Synth_t csSynth = { 0 };
+
+        /* Recording parameters variables */
+        unsigned long csFiles    = 1;
+        unsigned long csBegin    = 1420070400;
+        double        csDuration = 60.0;
+        double        csLength   = 5.0;
+
+        /* Pseudo-random seed variables */
+        unsigned long long csSeed = 1;
+
+        /* Parsing variables */
+        unsigned long csParse = 0;
+
+        /* Records count variables */
+        unsigned long csCount = 0;
+
+        /* Default events frequencies */
+        csSynth.syIMU = 2460.0;
+        csSynth.syMAS = 5.0;
+
+        /* Search in parameters */
+        lc_stdp( lc_stda( argc, argv, "--destination", "-d" ), argv,   csDst              , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--files"      , "-f" ), argv, & csFiles            , LC_ULONG  );
+        lc_stdp( lc_stda( argc, argv, "--duration"   , "-t" ), argv, & csDuration         , LC_DOUBLE );
+        lc_stdp( lc_stda( argc, argv, "--begin"      , "-b" ), argv, & csBegin            , LC_ULONG  );
+        lc_stdp( lc_stda( argc, argv, "--imu"        , "-i" ), argv, & csSynth.syIMU      , LC_DOUBLE );
+        lc_stdp( lc_stda( argc, argv, "--master"     , "-m" ), argv, & csSynth.syMAS      , LC_DOUBLE );
+        lc_stdp( lc_stda( argc, argv, "--seed"       , "-r" ), argv, & csSeed             , LC_ULLONG );
+        lc_stdp( lc_stda( argc, argv, "--disorder"   , "-o" ), argv, & csSynth.syDisorder , LC_DOUBLE );
+        lc_stdp( lc_stda( argc, argv, "--corrupt"    , "-c" ), argv, & csSynth.syCorrupt  , LC_DOUBLE );
+        lc_stdp( lc_stda( argc, argv, "--duplicate"  , "-u" ), argv, & csSynth.syDuplicate, LC_DOUBLE );
+        lc_stdp( lc_stda( argc, argv, "--gaps"       , "-a" ), argv, & csSynth.syGaps     , LC_ULONG  );
+        lc_stdp( lc_stda( argc, argv, "--gap-length" , "-l" ), argv, & csLength           , LC_DOUBLE );
+
+        /* Execution switch */
+        if ( lc_stda( argc, argv, "--help", "-h" ) || ( argc <= 1 ) ) {
+
+            /* Display help summary */
+            printf( CS_HELP );
+
+        } else {
+
+            /* Check recording parameters */
+            if ( ( csFiles == 0 ) || ( csDuration <= 0.0 ) || ( csSynth.syIMU < 0.0 ) || ( csSynth.syMAS < 0.0 ) ) {
+
+                /* Display message */
+                fprintf( LC_ERR, "Error : invalid recording parameters\n" );
+
+                /* Return to system */
+                return( EXIT_FAILURE );
+
+            }
+
+            /* Check injection parameters */
+            if (
+
+                ( csSynth.syDisorder  < 0.0 ) || ( csSynth.syDisorder  > 1.0 ) ||
+                ( csSynth.syCorrupt   < 0.0 ) || ( csSynth.syCorrupt   > 1.0 ) ||
+                ( csSynth.syDuplicate < 0.0 ) || ( csSynth.syDuplicate > 1.0 ) ||
+                ( ( csSynth.syGaps > 0 ) && ( ( csLength <= 0.0 ) || ( csLength >= csDuration ) ) )
+
+            ) {
+
+                /* Display message */
+                fprintf( LC_ERR, "Error : invalid injection parameters\n" );
+
+                /* Return to system */
+                return( EXIT_FAILURE );
+
+            }
+
+            /* Assign recording range */
+            csSynth.syBegin    = ( uint64_t ) csBegin * 1000000;
+            csSynth.syDuration = ( uint64_t ) ( csDuration * 1000000.0 );
+            csSynth.syLength   = ( uint64_t ) ( csLength   * 1000000.0 );
+
+            /* Assign GPS events activation */
+            csSynth.syGPS = lc_stda( argc, argv, "--no-gps", "-g" ) ? LC_FALSE : LC_TRUE;
+
+            /* Initialize pseudo-random generator state (splitmix64 mixing) */
+            csSynth.syState = csSeed + UINT64_C(0x9E3779B97F4A7C15);
+            csSynth.syState = ( csSynth.syState ^ ( csSynth.syState >> 30 ) ) * UINT64_C(0xBF58476D1CE4E5B9);
+            csSynth.syState = ( csSynth.syState ^ ( csSynth.syState >> 27 ) ) * UINT64_C(0x94D049BB133111EB);
+            csSynth.syState = ( csSynth.syState ^ ( csSynth.syState >> 31 ) );
+
+            /* Avoid generator null state */
+            if ( csSynth.syState == 0 ) csSynth.syState = 1;
+
+            /* Check recording gaps */
+            if ( csSynth.syGaps > 0 ) {
+
+                /* Allocate and check recording gaps array */
+                if ( ( csSynth.syGap = ( uint64_t * ) malloc( csSynth.syGaps * sizeof( uint64_t ) ) ) == NULL ) {
+
+                    /* Display message */
+                    fprintf( LC_ERR, "Error : unable to allocate memory\n" );
+
+                    /* Return to system */
+                    return( EXIT_FAILURE );
+
+                }
+
+                /* Distribute recording gaps */
+                for ( csParse = 0; csParse < csSynth.syGaps; csParse ++ ) {
+
+                    /* Compute recording gap begining */
+                    csSynth.syGap[csParse] = ( uint64_t ) ( cs_elphel_synth_uniform( & csSynth ) * ( double ) ( csSynth.syDuration - csSynth.syLength ) );
+
+                }
+
+            }
+
+            /* Check NMEA encoding */
+            if ( ( csSynth.syGPS == LC_TRUE ) && ( cs_elphel_synth_check() == LC_FALSE ) ) {
+
+                /* Display message */
+                fprintf( LC_ERR, "Warning : NMEA encoding not recognized by libcsps\n" );
+
+            }
+
+            /* Logs-files synthesis */
+            for ( csParse = 1; csParse <= csFiles; csParse ++ ) {
+
+                /* Build output file path */
+                sprintf( csFil, "%s/" CS_NAME, csDst, csParse );
+
+                /* Display information */
+                fprintf( LC_OUT, "Generating : %s\n", basename( csFil ) );
+
+                /* Memorize records count */
+                csCount = csSynth.syCount;
+
+                /* Logs-file synthesis procedure */
+                if ( cs_elphel_synth( & csSynth, csFil, ( csSynth.syDuration * csParse ) / csFiles ) == LC_FALSE ) {
+
+                    /* Release recording gaps array */
+                    free( csSynth.syGap );
+
+                    /* Return to system */
+                    return( EXIT_FAILURE );
+
+                }
+
+                /* Display information */
+                fprintf( LC_OUT, "    %lu record(s) exported\n", csSynth.syCount - csCount );
+
+            }
+
+            /* Display information */
+            fprintf( LC_OUT, "Synthesis : %lu record(s), %lu corrupted, %lu duplicated, %lu displaced\n", csSynth.syCount, csSynth.syCorrupted, csSynth.syDuplicated, csSynth.syDisplaced );
+
+            /* Release recording gaps array */
+            free( csSynth.syGap );
+
+        }
+
+        /* Return to system */
+        return( EXIT_SUCCESS );
+
+    }
+
+/*
+    Source - Logs-file synthesis procedure
+ */
+
+    int cs_elphel_synth(
+
+        cs_Synth_t * const csSynth,
+        char const * const csFile,
+        uint64_t     const csUntil
+
+    ) {
+
+        /* Stream variables */
+        FILE * csStream = NULL;
+
+        /* Record buffer variables */
+        lp_Byte_t csRecord[LC_RECORD] = { 0 };
+
+        /* Events timestamp variables */
+        uint64_t csimuTime = 0;
+        uint64_t csmasTime = 0;
+        uint64_t csgpsTime = 0;
+
+        /* Selected event variables */
+        uint64_t  csTime = 0;
+        lp_Byte_t csType = 0;
+
+        /* Create and check output stream */
+        if ( ( csStream = fopen( csFile, "wb" ) ) == NULL ) {
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : unable to access %s\n", basename( ( char * ) csFile ) );
+
+            /* Return failure */
+            return( LC_FALSE );
+
+        }
+
+        /* Generation loop */
+        while ( csType != lp_Byte_s( 0xFF ) ) {
+
+            /* Compute next events timestamp */
+            csimuTime = ( csSynth->syIMU > 0.0        ) ? cs_elphel_synth_time( csSynth->syimuIndex, csSynth->syIMU ) : UINT64_MAX;
+            csmasTime = ( csSynth->syMAS > 0.0        ) ? cs_elphel_synth_time( csSynth->symasIndex, csSynth->syMAS ) : UINT64_MAX;
+            csgpsTime = ( csSynth->syGPS == LC_TRUE   ) ? cs_elphel_synth_time( csSynth->sygpsIndex, 0.0            ) : UINT64_MAX;
+
+            /* Select earliest event */
+            if ( ( csimuTime <= csmasTime ) && ( csimuTime <= csgpsTime ) ) {
+
+                /* Select IMU event */
+                csTime = csimuTime, csType = LC_IMU;
+
+            } else
+            if ( csmasTime <= csgpsTime ) {
+
+                /* Select camera master event */
+                csTime = csmasTime, csType = LC_MAS;
+
+            } else {
+
+                /* Select GPS event */
+                csTime = csgpsTime, csType = LC_GPS;
+
+            }
+
+            /* Check time range */
+            if ( csTime >= csUntil ) {
+
+                /* Stop generation */
+                csType = lp_Byte_s( 0xFF );
+
+            } else {
+
+                /* Check recording gaps */
+                if ( cs_elphel_synth_gap( csSynth, csTime ) == LC_FALSE ) {
+
+                    /* Compose event record */
+                    if ( csType == LC_IMU ) {
+
+                        /* Compose IMU record */
+                        cs_elphel_synth_imu( csSynth, csRecord, csSynth->syBegin + csTime );
+
+                    } else
+                    if ( csType == LC_MAS ) {
+
+                        /* Compose camera master record */
+                        cs_elphel_synth_master( csRecord, csSynth->syBegin + csTime );
+
+                    } else {
+
+                        /* Compose GPS record */
+                        cs_elphel_synth_gps( csRecord, csSynth->syBegin + csTime, csSynth->syBegin + ( csSynth->sygpsIndex / CS_SENTENCES ) * CS_MEASURE, csSynth->syBegin, csSynth->sygpsIndex % CS_SENTENCES );
+
+                    }
+
+                    /* Export event record */
+                    cs_elphel_synth_push( csSynth, csRecord, csStream );
+
+                }
+
+                /* Update events index */
+                if ( csType == LC_IMU ) csSynth->syimuIndex ++; else
+                if ( csType == LC_MAS ) csSynth->symasIndex ++; else csSynth->sygpsIndex ++;
+
+            }
+
+        }
+
+        /* Export disorder window */
+        cs_elphel_synth_flush( csSynth, csStream );
+
+        /* Check stream state */
+        if ( ferror( csStream ) != 0 ) {
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : unable to write %s\n", basename( ( char * ) csFile ) );
+
+            /* Close output stream */
+            fclose( csStream );
+
+            /* Return failure */
+            return( LC_FALSE );
+
+        }
+
+        /* Close output stream */
+        fclose( csStream );
+
+        /* Return success */
+        return( LC_TRUE );
+
+    }
+
+/*
+    Source - Event timestamp computation
+ */
+
+    uint64_t cs_elphel_synth_time(
+
+        uint64_t const csIndex,
+        double   const csFrequency
+
+    ) {
+
+        /* Check events type */
+        if ( csFrequency > 0.0 ) {
+
+            /* Compute and return periodic event timestamp */
+            return( ( uint64_t ) ( ( ( double ) csIndex * 1000000.0 ) / csFrequency ) );
+
+        } else {
+
+            /* Compute and return GPS sentence timestamp */
+            return( ( csIndex / CS_SENTENCES ) * CS_MEASURE + ( csIndex % CS_SENTENCES ) * CS_SENTENCE );
+
+        }
+
+    }
+
+/*
+    Source - Recording gaps detection
+ */
+
+    int cs_elphel_synth_gap(
+
+        cs_Synth_t const * const csSynth,
+        uint64_t           const csTime
+
+    ) {
+
+        /* Parsing variables */
+        unsigned long csParse = 0;
+
+        /* Parsing recording gaps */
+        for ( csParse = 0; csParse < csSynth->syGaps; csParse ++ ) {
+
+            /* Check time inclusion */
+            if ( ( csTime >= csSynth->syGap[csParse] ) && ( csTime < csSynth->syGap[csParse] + csSynth->syLength ) ) return( LC_TRUE );
+
+        }
+
+        /* Return negative answer */
+        return( LC_FALSE );
+
+    }
+
+/*
+    Source - Record header composition
+ */
+
+    void cs_elphel_synth_header(
+
+        lp_Byte_t * const csRecord,
+        uint64_t    const csTime,
+        lp_Byte_t   const csType
+
+    ) {
+
+        /* Header variables */
+        lp_Time_t csHeader = lp_timestamp_compose( csTime / 1000000, csTime % 1000000 );
+
+        /* Insert event type */
+        csHeader |= ( lp_Time_t ) ( csType & lp_Byte_s( 0x0F ) ) << 24;
+
+        /* Clear record buffer */
+        memset( csRecord, 0, LC_RECORD );
+
+        /* Write record header */
+        memcpy( csRecord, & csHeader, sizeof( lp_Time_t ) );
+
+    }
+
+/*
+    Source - IMU record composition
+ */
+
+    void cs_elphel_synth_imu(
+
+        cs_Synth_t * const csSynth,
+        lp_Byte_t  * const csRecord,
+        uint64_t     const csTime
+
+    ) {
+
+        /* Parsing variables */
+        int csParse = 0;
+
+        /* Noise variables */
+        uint64_t csNoise = cs_elphel_synth_random( csSynth );
+
+        /* Measure variables */
+        int32_t csValue = 0;
+
+        /* Compose record header */
+        cs_elphel_synth_header( csRecord, csTime, LC_IMU );
+
+        /* Compose angular rates and accelerations */
+        for ( csParse = 0; csParse < 6; csParse ++, csNoise >>= 10 ) {
+
+            /* Compute measure noise */
+            csValue = ( int32_t ) ( csNoise & 0x3FF ) - 512;
+
+            /* Write measure */
+            memcpy( csRecord + 8 + ( csParse << 2 ), & csValue, sizeof( int32_t ) );
+
+        }
+
+    }
+
+/*
+    Source - Camera master record composition
+ */
+
+    void cs_elphel_synth_master(
+
+        lp_Byte_t * const csRecord,
+        uint64_t    const csTime
+
+    ) {
+
+        /* Master timestamp variables */
+        lp_Time_t csMaster = lp_timestamp_compose( csTime / 1000000, csTime % 1000000 );
+
+        /* Compose record header */
+        cs_elphel_synth_header( csRecord, csTime, LC_MAS );
+
+        /* Write master timestamp */
+        memcpy( csRecord + 8, & csMaster, sizeof( lp_Time_t ) );
+
+    }
+
+/*
+    Source - GPS record composition
+ */
+
+    void cs_elphel_synth_gps(
+
+        lp_Byte_t * const csRecord,
+        uint64_t    const csTime,
+        uint64_t    const csClock,
+        uint64_t    const csOrigin,
+        int         const csIndex
+
+    ) {
+
+        /* Sentence buffer variables */
+        char csSentence[128] = { 0 };
+
+        /* Sentence fields variables */
+        char csUTC[32] = { 0 };
+        char csLat[32] = { 0 };
+        char csLon[32] = { 0 };
+
+        /* Calendar variables */
+        struct tm csDate;
+        time_t    csSecond = ( time_t ) ( csClock / 1000000 );
+
+        /* Position variables */
+        double csDistance = CS_SPEED * ( double ) ( csClock - csOrigin ) * 1.0e-6;
+        double csLatitude = 0.0;
+        double csLongitude = 0.0;
+
+        /* Position units variables, in ten thousandth of minutes */
+        long long csUnits = 0;
+
+        /* Compute position along trajectory */
+        csLatitude  = CS_LATITUDE  + ( csDistance * cos( CS_COURSE * ( CS_PI / 180.0 ) ) / CS_RADIUS ) * ( 180.0 / CS_PI );
+        csLongitude = CS_LONGITUDE + ( csDistance * sin( CS_COURSE * ( CS_PI / 180.0 ) ) / ( CS_RADIUS * cos( CS_LATITUDE * ( CS_PI / 180.0 ) ) ) ) * ( 180.0 / CS_PI );
+
+        /* Compute GPS calendar time */
+        gmtime_r( & csSecond, & csDate );
+
+        /* Compose GPS clock field */
+        sprintf( csUTC, "%02d%02d%02d.%03d", csDate.tm_hour, csDate.tm_min, csDate.tm_sec, ( int ) ( ( csClock % 1000000 ) / 1000 ) );
+
+        /* Compose latitude field */
+        csUnits = llround( csLatitude * 600000.0 );
+        sprintf( csLat, "%02lld%02lld.%04lld", csUnits / 600000, ( csUnits % 600000 ) / 10000, csUnits % 10000 );
+
+        /* Compose longitude field */
+        csUnits = llround( csLongitude * 600000.0 );
+        sprintf( csLon, "%03lld%02lld.%04lld", csUnits / 600000, ( csUnits % 600000 ) / 10000, csUnits % 10000 );
+
+        /* Compose record header */
+        cs_elphel_synth_header( csRecord, csTime, LC_GPS );
+
+        /* Switch on measure sentence */
+        switch ( csIndex ) {
+
+            case ( 0 ) : {
+
+                /* Compose and encode NMEA/GGA sentence */
+                sprintf( csSentence, "%s,%s,N,%s,E,1,08,0.9,%.1f,M,46.9,M,,", csUTC, csLat, csLon, CS_ALTITUDE );
+                cs_elphel_synth_nmea( csRecord + 8, LP_NMEA_IDENT_GGA, csSentence );
+
+            } break;
+
+            case ( 1 ) : {
+
+                /* Compose and encode NMEA/GSA sentence */
+                sprintf( csSentence, "A,3,04,05,09,12,17,24,,,,,,,2.5,1.3,2.1" );
+                cs_elphel_synth_nmea( csRecord + 8, LP_NMEA_IDENT_GSA, csSentence );
+
+            } break;
+
+            case ( 2 ) : {
+
+                /* Compose and encode NMEA/RMC sentence */
+                sprintf( csSentence, "%s,A,%s,N,%s,E,%.3f,%.2f,%02d%02d%02d,,,A", csUTC, csLat, csLon, CS_SPEED * ( 3600.0 / 1852.0 ), CS_COURSE, csDate.tm_mday, csDate.tm_mon + 1, csDate.tm_year % 100 );
+                cs_elphel_synth_nmea( csRecord + 8, LP_NMEA_IDENT_RMC, csSentence );
+
+            } break;
+
+            default : {
+
+                /* Compose and encode NMEA/VTG sentence */
+                sprintf( csSentence, "%.2f,T,,M,%.3f,N,%.3f,K,A", CS_COURSE, CS_SPEED * ( 3600.0 / 1852.0 ), CS_SPEED * 3.6 );
+                cs_elphel_synth_nmea( csRecord + 8, LP_NMEA_IDENT_VTG, csSentence );
+
+            } break;
+
+        }
+
+    }
+
+/*
+    Source - NMEA sentence encoding
+ */
+
+    void cs_elphel_synth_nmea(
+
+        lp_Byte_t       * const csPayload,
+        lp_Enum_t         const csType,
+        char      const * const csSentence
+
+    ) {
+
+        /* Nibbles array variables, preserving the two record tail bytes */
+        lp_Byte_t csNibble[( LC_RECORD - 10 ) << 1] = { 0 };
+
+        /* Nibbles count variables */
+        size_t csSize = 0;
+
+        /* Parsing variables */
+        size_t csParse = 0;
+
+        /* Encoding variables */
+        char const * csCode = NULL;
+
+        /* Encode sentence type */
+        csNibble[csSize ++] = csType & lp_Byte_s( 0x0F );
+
+        /* Parsing sentence characters */
+        for ( csParse = 0; csSentence[csParse] != '\0'; csParse ++ ) {
+
+            /* Search character code */
+            if ( ( csCode = strchr( CS_NMEA, csSentence[csParse] ) ) != NULL ) {
+
+                /* Check remaining nibbles, keeping terminal nibble */
+                if ( csSize + 2 > sizeof( csNibble ) ) break;
+
+                /* Encode character */
+                csNibble[csSize ++] = csCode - CS_NMEA;
+
+            } else {
+
+                /* Check remaining nibbles, keeping terminal nibble */
+                if ( csSize + 4 > sizeof( csNibble ) ) break;
+
+                /* Encode escaped character */
+                csNibble[csSize ++] = CS_NMEA_ESCAPE;
+                csNibble[csSize ++] = ( ( lp_Byte_t ) csSentence[csParse]      ) & lp_Byte_s( 0x0F );
+                csNibble[csSize ++] = ( ( lp_Byte_t ) csSentence[csParse] >> 4 ) & lp_Byte_s( 0x0F );
+
+            }
+
+        }
+
+        /* Encode sentence termination */
+        csNibble[csSize ++] = CS_NMEA_END;
+
+        /* Pack nibbles in payload */
+        for ( csParse = 0; csParse < csSize; csParse ++ ) {
+
+            /* Write nibble, low nibble first */
+            csPayload[csParse >> 1] |= csNibble[csParse] << ( ( csParse & 1 ) << 2 );
+
+        }
+
+    }
+
+/*
+    Source - NMEA encoding verification
+ */
+
+    int cs_elphel_synth_check( void ) {
+
+        /* Record buffer variables */
+        lp_Byte_t csRecord[LC_RECORD] = { 0 };
+
+        /* Sentence buffer variables */
+        lp_Char_t csDecode[256] = { 0 };
+
+        /* Reference sentence variables */
+        char const * const csSentence = "123456.000,4612.2640,N,00608.5920,E,1,08,0.9,375.0,M,46.9,M,,";
+
+        /* Encode reference sentence */
+        cs_elphel_synth_nmea( csRecord + 8, LP_NMEA_IDENT_GGA, csSentence );
+
+        /* Decode sentence through libcsps */
+        if ( lp_nmea_sentence( csRecord + 8, ( LC_RECORD - 8 ) << 1, csDecode ) != LP_NMEA_IDENT_GGA ) return( LC_FALSE );
+
+        /* Compare decoded sentence */
+        if ( strcmp( ( char * ) csDecode, csSentence ) != 0 ) return( LC_FALSE ); else return( LC_TRUE );
+
+    }
+
+/*
+    Source - Record exportation
+ */
+
+    void cs_elphel_synth_push(
+
+        cs_Synth_t * const csSynth,
+        lp_Byte_t  * const csRecord,
+        FILE       * const csStream
+
+    ) {
+
+        /* Parsing variables */
+        unsigned long csParse = 0;
+
+        /* Copies count variables */
+        unsigned long csCopy = 1;
+
+        /* Window slots variables */
+        unsigned long csSlot = 0;
+        unsigned long csSwap = 0;
+
+        /* Noise variables */
+        uint64_t csNoise = 0;
+
+        /* Swap buffer variables */
+        lp_Byte_t csBuffer[LC_RECORD] = { 0 };
+
+        /* Corruption injection */
+        if ( ( csSynth->syCorrupt > 0.0 ) && ( cs_elphel_synth_uniform( csSynth ) < csSynth->syCorrupt ) ) {
+
+            /* Fill record with pseudo-random bytes */
+            for ( csParse = 0; csParse < LC_RECORD; csParse += sizeof( uint64_t ) ) {
+
+                /* Write pseudo-random bytes */
+                csNoise = cs_elphel_synth_random( csSynth ), memcpy( csRecord + csParse, & csNoise, sizeof( uint64_t ) );
+
+            }
+
+            /* Update corrupted count */
+            csSynth->syCorrupted ++;
+
+        }
+
+        /* Duplication injection */
+        if ( ( csSynth->syDuplicate > 0.0 ) && ( cs_elphel_synth_uniform( csSynth ) < csSynth->syDuplicate ) ) {
+
+            /* Push record twice */
+            csCopy = 2;
+
+            /* Update duplicated count */
+            csSynth->syDuplicated ++;
+
+        }
+
+        /* Pushing record copies */
+        for ( csParse = 0; csParse < csCopy; csParse ++ ) {
+
+            /* Check window state */
+            if ( csSynth->syFill == CS_WINDOW ) {
+
+                /* Export oldest record */
+                fwrite( csSynth->syWindow[csSynth->syHead], 1, LC_RECORD, csStream );
+
+                /* Update window state */
+                csSynth->syHead = ( csSynth->syHead + 1 ) % CS_WINDOW, csSynth->syFill --;
+
+                /* Update exported count */
+                csSynth->syCount ++;
+
+            }
+
+            /* Push record in window */
+            memcpy( csSynth->syWindow[csSlot = ( csSynth->syHead + csSynth->syFill ++ ) % CS_WINDOW], csRecord, LC_RECORD );
+
+            /* Disorder injection */
+            if ( ( csSynth->syFill > 1 ) && ( csSynth->syDisorder > 0.0 ) && ( cs_elphel_synth_uniform( csSynth ) < csSynth->syDisorder ) ) {
+
+                /* Select window record */
+                csSwap = ( csSynth->syHead + cs_elphel_synth_random( csSynth ) % ( csSynth->syFill - 1 ) ) % CS_WINDOW;
+
+                /* Swap records */
+                memcpy( csBuffer, csSynth->syWindow[csSwap], LC_RECORD );
+                memcpy( csSynth->syWindow[csSwap], csSynth->syWindow[csSlot], LC_RECORD );
+                memcpy( csSynth->syWindow[csSlot], csBuffer, LC_RECORD );
+
+                /* Update displaced count */
+                csSynth->syDisplaced ++;
+
+            }
+
+        }
+
+    }
+
+/*
+    Source - Disorder window flush
+ */
+
+    void cs_elphel_synth_flush(
+
+        cs_Synth_t * const csSynth,
+        FILE       * const csStream
+
+    ) {
+
+        /* Exporting window records */
+        while ( csSynth->syFill > 0 ) {
+
+            /* Export oldest record */
+            fwrite( csSynth->syWindow[csSynth->syHead], 1, LC_RECORD, csStream );
+
+            /* Update window state */
+            csSynth->syHead = ( csSynth->syHead + 1 ) % CS_WINDOW, csSynth->syFill --;
+
+            /* Update exported count */
+            csSynth->syCount ++;
+
+        }
+
+    }
+
+/*
+    Source - Pseudo-random generator
+ */
+
+    uint64_t cs_elphel_synth_random(
+
+        cs_Synth_t * const csSynth
+
+    ) {
+
+        /* Update generator state */
+        csSynth->syState ^= csSynth->syState >> 12;
+        csSynth->syState ^= csSynth->syState << 25;
+        csSynth->syState ^= csSynth->syState >> 27;
+
+        /* Return pseudo-random value */
+        return( csSynth->syState * UINT64_C(0x2545F4914F6CDD1D) );
+
+    }
+
+/*
+    Source - Pseudo-random uniform value
+ */
+
+    double cs_elphel_synth_uniform(
+
+        cs_Synth_t * const csSynth
+
+    ) {
+
+        /* Return pseudo-random value on 53 bits */
+        return( ( double ) ( cs_elphel_synth_random( csSynth ) >> 11 ) * ( 1.0 / 9007199254740992.0 ) );
+
+    }
+
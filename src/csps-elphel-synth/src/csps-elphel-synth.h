@@ -0,0 +1,545 @@
+/*
+ * csps-suite - CSPS library front-end suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   csps-elphel-synth.h
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *   
+     *  Software main header
+     */
+
+    /*! \mainpage csps-elphel-synth
+     *
+     *  \section csps-suite
+     *  \section _ CSPS library front-end suite
+     *
+     *  The csps-suite is dedicated to CSPS processing using libcsps. It provides 
+     *  a serie of softwares used for camera logs-files preparation and 
+     *  validation according to manufacturers standards. It comes with a main 
+     *  software that is responsible of CSPS processing of the camera logs-files 
+     *  and also offers softwares for CSPS processing results visualization and
+     *  exportation.
+     *
+     *  \section Documentation
+     *
+     *  A detailed documentation can be generated through doxygen. A more general
+     *  documentation can be consulted at https://github.com/FoxelSA/csps-suite/wiki.
+     *
+     *  \section Copyright
+     * 
+     *  Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch \n
+     *  This program is part of the FOXEL project <http://foxel.ch>.
+     *  
+     *  Please read the COPYRIGHT.md file for more information.
+     *
+     *  \section License
+     *
+     *  This program is licensed under the terms of the GNU Affero General Public
+     *  License v3 (GNU AGPL), with two additional terms. The content is licensed
+     *  under the terms of the Creative Commons Attribution-ShareAlike 4.0
+     *  International (CC BY-SA) license.
+     *
+     *  You must read <http://foxel.ch/license> for more information about our
+     *  Licensing terms and our Usage and Attribution guidelines.
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __CS_ELPHEL_SYNTH__
+    # define __CS_ELPHEL_SYNTH__
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    extern "C" {
+    # endif
+
+/* 
+    Header - Includes
+ */
+
+    # include <stdio.h>
+    # include <stdlib.h>
+    # include <string.h>
+    # include <stdint.h>
+    # include <math.h>
+    # include <time.h>
+    # include <libgen.h>
+    # include <csps-all.h>
+    # include <common-all.h>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Standard help */
+    # define CS_HELP "Usage summary :\n\n"                               \
+    "\tcsps-elphel-synth [Arguments] [Parameters] ...\n\n"               \
+    "Short arguments and parameters summary :\n\n"                       \
+    "\t-d\tDirectory where synthetic logs-files are exported\n"          \
+    "\t-f\tNumber of logs-files to export\n"                             \
+    "\t-t\tRecording duration, in seconds\n"                             \
+    "\t-b\tRecording begining, in seconds since epoch\n"                 \
+    "\t-i\tIMU events frequency, in hertz (zero to disable)\n"           \
+    "\t-m\tCamera master events frequency, in hertz (zero to disable)\n" \
+    "\t-g\tDisable GPS events\n"                                         \
+    "\t-r\tPseudo-random generator seed\n"                               \
+    "\t-o\tProbability of record displacement (disorder)\n"              \
+    "\t-c\tProbability of record corruption\n"                           \
+    "\t-u\tProbability of record duplication\n"                          \
+    "\t-a\tNumber of recording gaps\n"                                   \
+    "\t-l\tRecording gaps duration, in seconds\n\n"                      \
+    "csps-elphel-synth - csps-suite\n"                                   \
+    "Copyright (c) 2013-2015 FOXEL SA\n"
+
+    /* Define logs-files name */
+    # define CS_NAME        "log-synth" LC_PATTERN "%05lu"
+
+    /* Define disorder window size, in records */
+    # define CS_WINDOW      64
+
+    /* Define GPS measures parameters, in microseconds */
+    # define CS_MEASURE     200000
+    # define CS_SENTENCE    20000
+
+    /* Define GPS measures sentences count */
+    # define CS_SENTENCES   4
+
+    /* Define synthetic trajectory parameters */
+    # define CS_LATITUDE    46.2044
+    # define CS_LONGITUDE   6.1432
+    # define CS_ALTITUDE    375.0
+    # define CS_SPEED       1.4
+    # define CS_COURSE      45.0
+
+    /* Define earth radius, in meters */
+    # define CS_RADIUS      6378137.0
+
+    /* Define mathematical constants */
+    # define CS_PI          3.1415926535897932384626
+
+    /* Define NMEA sentence nibble encoding */
+    # define CS_NMEA        "0123456789,*.-"
+    # define CS_NMEA_ESCAPE 0x0E
+    # define CS_NMEA_END    0x0F
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+    /*! \struct cs_Synth_struct
+     *  \brief Synthetic recording structure
+     *
+     *  This structure holds the parameters of the synthetic recording and the
+     *  state of its generation. The events streams are driven by their index,
+     *  the timestamp of an event being computed from its index and frequency
+     *  so that no drift accumulates along large recordings.
+     *
+     *  The records are exported through a window of the last generated records
+     *  in which the disorder is introduced by swapping records.
+     *
+     *  \var cs_Synth_struct::syBegin
+     *  Recording begining timestamp, in microseconds
+     *  \var cs_Synth_struct::syDuration
+     *  Recording duration, in microseconds
+     *  \var cs_Synth_struct::syIMU
+     *  IMU events frequency, in hertz
+     *  \var cs_Synth_struct::syMAS
+     *  Camera master events frequency, in hertz
+     *  \var cs_Synth_struct::syGPS
+     *  GPS events activation flag
+     *  \var cs_Synth_struct::syDisorder
+     *  Probability of record displacement
+     *  \var cs_Synth_struct::syCorrupt
+     *  Probability of record corruption
+     *  \var cs_Synth_struct::syDuplicate
+     *  Probability of record duplication
+     *  \var cs_Synth_struct::syGap
+     *  Recording gaps begining array, in microseconds from recording begining
+     *  \var cs_Synth_struct::syGaps
+     *  Number of recording gaps
+     *  \var cs_Synth_struct::syLength
+     *  Recording gaps duration, in microseconds
+     *  \var cs_Synth_struct::syState
+     *  Pseudo-random generator state
+     *  \var cs_Synth_struct::syimuIndex
+     *  Index of the next IMU event
+     *  \var cs_Synth_struct::symasIndex
+     *  Index of the next camera master event
+     *  \var cs_Synth_struct::sygpsIndex
+     *  Index of the next GPS event
+     *  \var cs_Synth_struct::syWindow
+     *  Disorder window records array
+     *  \var cs_Synth_struct::syHead
+     *  Index of the oldest record of the disorder window
+     *  \var cs_Synth_struct::syFill
+     *  Number of records in the disorder window
+     *  \var cs_Synth_struct::syCount
+     *  Number of exported records
+     *  \var cs_Synth_struct::syCorrupted
+     *  Number of corrupted records
+     *  \var cs_Synth_struct::syDuplicated
+     *  Number of duplicated records
+     *  \var cs_Synth_struct::syDisplaced
+     *  Number of displaced records
+     */
+
+    typedef struct cs_Synth_struct {
+
+        uint64_t       syBegin;
+        uint64_t       syDuration;
+        double         syIMU;
+        double         syMAS;
+        int            syGPS;
+        double         syDisorder;
+        double         syCorrupt;
+        double         syDuplicate;
+        uint64_t     * syGap;
+        unsigned long  syGaps;
+        uint64_t       syLength;
+        uint64_t       syState;
+        uint64_t       syimuIndex;
+        uint64_t       symasIndex;
+        uint64_t       sygpsIndex;
+        lp_Byte_t      syWindow[CS_WINDOW][LC_RECORD];
+        unsigned long  syHead;
+        unsigned long  syFill;
+        unsigned long  syCount;
+        unsigned long  syCorrupted;
+        unsigned long  syDuplicated;
+        unsigned long  syDisplaced;
+
+    } cs_Synth_t;
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Software main function
+     *  
+     *  The main function reads the recording parameters and creates the
+     *  synthetic logs-files in the provided directory. The recording duration
+     *  is equally split among the logs-files that contain consecutive parts
+     *  of the recording.
+     *
+     *  The generation only depends on the provided parameters and seed, so
+     *  that the same logs-files are obtained on each execution.
+     *  
+     *  \param  argc Standard main parameter
+     *  \param  argv Standard main parameter
+     *
+     *  \return Returns exit code
+     */
+
+    int main ( int argc, char ** argv );
+
+    /*! \brief Logs-file synthesis procedure
+     *
+     *  This function generates the events of the recording that are in the
+     *  provided time range and exports them in the provided logs-file. The IMU,
+     *  camera master and GPS events are interleaved according to their
+     *  timestamp. The events that fall in a recording gap are discarded.
+     *
+     *  \param  csSynth Synthetic recording structure
+     *  \param  csFile  Path to the output logs-file
+     *  \param  csUntil End of the time range, in microseconds from recording
+     *                  begining
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int cs_elphel_synth(
+
+        cs_Synth_t * const csSynth,
+        char const * const csFile,
+        uint64_t     const csUntil
+
+    );
+
+    /*! \brief Event timestamp computation
+     *
+     *  This function computes the timestamp of the event of provided index for
+     *  the provided events frequency. For GPS events, the index enumerates the
+     *  sentences of the measures, the four sentences of a measure being sent
+     *  one after the other at the begining of the measure period.
+     *
+     *  \param  csIndex     Index of the event
+     *  \param  csFrequency Events frequency, in hertz, zero for GPS events
+     *
+     *  \return Returns event timestamp, in microseconds from recording begining
+     */
+
+    uint64_t cs_elphel_synth_time(
+
+        uint64_t const csIndex,
+        double   const csFrequency
+
+    );
+
+    /*! \brief Recording gaps detection
+     *
+     *  This function checks if the provided time is covered by one of the
+     *  recording gaps.
+     *
+     *  \param  csSynth Synthetic recording structure
+     *  \param  csTime  Time, in microseconds from recording begining
+     *
+     *  \return Returns LC_TRUE if the time is in a recording gap, LC_FALSE
+     *          otherwise
+     */
+
+    int cs_elphel_synth_gap(
+
+        cs_Synth_t const * const csSynth,
+        uint64_t           const csTime
+
+    );
+
+    /*! \brief Record header composition
+     *
+     *  This function clears the provided record buffer and writes its header
+     *  made of the event timestamp and type. The timestamp is written with its
+     *  seconds in the four last bytes and its microseconds in the twenty low
+     *  bits of the four first bytes. The event type is written in the low four
+     *  bits of the fourth byte.
+     *
+     *  \param  csRecord Pointer to record buffer
+     *  \param  csTime   Event timestamp, in microseconds since epoch
+     *  \param  csType   Event type
+     */
+
+    void cs_elphel_synth_header(
+
+        lp_Byte_t * const csRecord,
+        uint64_t    const csTime,
+        lp_Byte_t   const csType
+
+    );
+
+    /*! \brief IMU record composition
+     *
+     *  This function composes an IMU event record. The record payload holds
+     *  low amplitude noise on the angular rates and accelerations, which is
+     *  enough for logs-files preparation softwares but does not describe the
+     *  motion of the GPS trajectory.
+     *
+     *  \param  csSynth  Synthetic recording structure
+     *  \param  csRecord Pointer to record buffer
+     *  \param  csTime   Event timestamp, in microseconds since epoch
+     */
+
+    void cs_elphel_synth_imu(
+
+        cs_Synth_t * const csSynth,
+        lp_Byte_t  * const csRecord,
+        uint64_t     const csTime
+
+    );
+
+    /*! \brief Camera master record composition
+     *
+     *  This function composes a camera master event record. The master
+     *  (trigger) timestamp, equal to the synchronization timestamp, follows
+     *  the record header.
+     *
+     *  \param  csRecord Pointer to record buffer
+     *  \param  csTime   Event timestamp, in microseconds since epoch
+     */
+
+    void cs_elphel_synth_master(
+
+        lp_Byte_t * const csRecord,
+        uint64_t    const csTime
+
+    );
+
+    /*! \brief GPS record composition
+     *
+     *  This function composes a GPS event record holding one sentence of a GPS
+     *  measure. The measures are made of a NMEA/GGA, GSA, RMC and VTG sentence,
+     *  in this order, five measures being taken each second. The sentences
+     *  describe a constant velocity trajectory with a valid fix, the GPS clock
+     *  of the first measure of each second being an integer.
+     *
+     *  \param  csRecord Pointer to record buffer
+     *  \param  csTime   Event timestamp, in microseconds since epoch
+     *  \param  csClock  GPS measure time, in microseconds since epoch
+     *  \param  csOrigin Recording begining, in microseconds since epoch
+     *  \param  csIndex  Index of the sentence in the GPS measure
+     */
+
+    void cs_elphel_synth_gps(
+
+        lp_Byte_t * const csRecord,
+        uint64_t    const csTime,
+        uint64_t    const csClock,
+        uint64_t    const csOrigin,
+        int         const csIndex
+
+    );
+
+    /*! \brief NMEA sentence encoding
+     *
+     *  This function encodes the provided NMEA sentence, given without its
+     *  "$GPxxx," header and checksum, in the provided record payload. The
+     *  payload is read as a sequence of nibbles, low nibble first, the first
+     *  one giving the sentence type. Each following nibble encodes a digit or
+     *  one of the ',', '*', '.' and '-' characters. The other characters are
+     *  encoded by an escape nibble followed by their two ASCII nibbles, low
+     *  nibble first. The sentence is terminated by a nibble with all bits set.
+     *
+     *  \param  csPayload   Pointer to record payload
+     *  \param  csType      NMEA sentence type
+     *  \param  csSentence  NMEA sentence string
+     */
+
+    void cs_elphel_synth_nmea(
+
+        lp_Byte_t       * const csPayload,
+        lp_Enum_t         const csType,
+        char      const * const csSentence
+
+    );
+
+    /*! \brief NMEA encoding verification
+     *
+     *  This function encodes a NMEA/GGA sentence and decodes it through the
+     *  libcsps decoder. It allows to detect a disagreement between the NMEA
+     *  encoding assumed by this software and the one of libcsps.
+     *
+     *  \return Returns LC_TRUE if libcsps decodes the sentence, LC_FALSE
+     *          otherwise
+     */
+
+    int cs_elphel_synth_check( void );
+
+    /*! \brief Record exportation
+     *
+     *  This function pushes the provided record in the disorder window after
+     *  having applied the requested corruption and duplication. When the window
+     *  is full, its oldest record is exported in the provided stream. The
+     *  disorder is introduced by swapping the pushed record with a random
+     *  record of the window.
+     *
+     *  \param  csSynth  Synthetic recording structure
+     *  \param  csRecord Pointer to record buffer
+     *  \param  csStream Output logs-file stream
+     */
+
+    void cs_elphel_synth_push(
+
+        cs_Synth_t * const csSynth,
+        lp_Byte_t  * const csRecord,
+        FILE       * const csStream
+
+    );
+
+    /*! \brief Disorder window flush
+     *
+     *  This function exports the records remaining in the disorder window in
+     *  the provided stream and empties the window.
+     *
+     *  \param  csSynth  Synthetic recording structure
+     *  \param  csStream Output logs-file stream
+     */
+
+    void cs_elphel_synth_flush(
+
+        cs_Synth_t * const csSynth,
+        FILE       * const csStream
+
+    );
+
+    /*! \brief Pseudo-random generator
+     *
+     *  This function returns the next value of the xorshift64* pseudo-random
+     *  generator. It is used instead of the standard library generator so that
+     *  the synthetic logs-files do not depend on the system.
+     *
+     *  \param  csSynth Synthetic recording structure
+     *
+     *  \return Returns pseudo-random value
+     */
+
+    uint64_t cs_elphel_synth_random(
+
+        cs_Synth_t * const csSynth
+
+    );
+
+    /*! \brief Pseudo-random uniform value
+     *
+     *  This function returns a pseudo-random value uniformly distributed in
+     *  the [0,1[ range.
+     *
+     *  \param  csSynth Synthetic recording structure
+     *
+     *  \return Returns pseudo-random value
+     */
+
+    double cs_elphel_synth_uniform(
+
+        cs_Synth_t * const csSynth
+
+    );
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    }
+    # endif
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
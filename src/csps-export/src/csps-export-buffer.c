@@ -0,0 +1,392 @@
+/*
+ * csps-suite - CSPS library front-end suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "csps-export-buffer.h"
+
+/*
+    Source - Buffer creation
+ */
+
+    int cs_export_buffer_create( 
+
+        cs_Buffer_t * const csBuffer, 
+        FILE        * const csStream, 
+        int           const csLegacy 
+
+    ) {
+
+        /* Initialize buffer */
+        csBuffer->bfStream   = csStream;
+        csBuffer->bfSize     = 0;
+        csBuffer->bfCapacity = CS_BUFFER_SIZE;
+        csBuffer->bfOffset   = 0;
+        csBuffer->bfLegacy   = csLegacy;
+
+        /* Allocate and check buffer memory */
+        if ( ( csBuffer->bfData = ( char * ) malloc( csBuffer->bfCapacity ) ) == NULL ) {
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : unable to allocate memory\n" );
+
+            /* Return failure */
+            return( LC_FALSE );
+
+        }
+
+        /* Return success */
+        return( LC_TRUE );
+
+    }
+
+/*
+    Source - Buffer deletion
+ */
+
+    void cs_export_buffer_delete( 
+
+        cs_Buffer_t * const csBuffer 
+
+    ) {
+
+        /* Export remaining content */
+        cs_export_buffer_flush( csBuffer );
+
+        /* Release buffer memory */
+        free( csBuffer->bfData );
+
+        /* Invalidate buffer memory */
+        csBuffer->bfData = NULL;
+
+    }
+
+/*
+    Source - Buffer flush
+ */
+
+    void cs_export_buffer_flush( 
+
+        cs_Buffer_t * const csBuffer 
+
+    ) {
+
+        /* Check buffer mode */
+        if ( csBuffer->bfStream == NULL ) return;
+
+        /* Export buffer content */
+        if ( csBuffer->bfSize > 0 ) fwrite( csBuffer->bfData, 1, csBuffer->bfSize, csBuffer->bfStream );
+
+        /* Update stream offset */
+        csBuffer->bfOffset += csBuffer->bfSize;
+
+        /* Reset buffer size */
+        csBuffer->bfSize = 0;
+
+    }
+
+/*
+    Source - Buffer position
+ */
+
+    size_t cs_export_buffer_tell(
+
+        cs_Buffer_t const * const csBuffer
+
+    ) {
+
+        /* Return buffer position */
+        return( csBuffer->bfOffset + csBuffer->bfSize );
+
+    }
+
+/*
+    Source - Buffer space reservation
+ */
+
+    int cs_export_buffer_reserve( 
+
+        cs_Buffer_t * const csBuffer, 
+        size_t        const csLength 
+
+    ) {
+
+        /* Memory variables */
+        char * csSwap = NULL;
+
+        /* Capacity variables */
+        size_t csCapacity = csBuffer->bfCapacity;
+
+        /* Check buffer space */
+        if ( ( csBuffer->bfSize + csLength ) <= csBuffer->bfCapacity ) return( LC_TRUE );
+
+        /* Check buffer mode */
+        if ( csBuffer->bfStream != NULL ) {
+
+            /* Export buffer content */
+            cs_export_buffer_flush( csBuffer );
+
+            /* Return status */
+            return( ( csLength <= csBuffer->bfCapacity ) ? LC_TRUE : LC_FALSE );
+
+        }
+
+        /* Compute enlarged capacity */
+        while ( ( csBuffer->bfSize + csLength ) > csCapacity ) csCapacity <<= 1;
+
+        /* Reallocate and check buffer memory */
+        if ( ( csSwap = ( char * ) realloc( csBuffer->bfData, csCapacity ) ) == NULL ) {
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : unable to allocate memory\n" );
+
+            /* Return failure */
+            return( LC_FALSE );
+
+        }
+
+        /* Assign enlarged memory */
+        csBuffer->bfData     = csSwap;
+        csBuffer->bfCapacity = csCapacity;
+
+        /* Return success */
+        return( LC_TRUE );
+
+    }
+
+/*
+    Source - Bytes exportation
+ */
+
+    void cs_export_buffer_memory( 
+
+        cs_Buffer_t       * const csBuffer, 
+        char        const * const csData, 
+        size_t              const csLength 
+
+    ) {
+
+        /* Bytes variables */
+        char const * csByte = csData;
+
+        /* Length variables */
+        size_t csRemain = csLength;
+        size_t csChunk  = 0;
+
+        /* Check memory buffer */
+        if ( csBuffer->bfStream == NULL ) {
+
+            /* Reserve and check buffer space */
+            if ( cs_export_buffer_reserve( csBuffer, csLength ) == LC_FALSE ) return;
+
+        }
+
+        /* Append bytes by chunks */
+        while ( csRemain > 0 ) {
+
+            /* Compute chunk length */
+            csChunk = csBuffer->bfCapacity - csBuffer->bfSize;
+
+            /* Clamp chunk length */
+            if ( csChunk > csRemain ) csChunk = csRemain;
+
+            /* Append chunk */
+            memcpy( csBuffer->bfData + csBuffer->bfSize, csByte, csChunk );
+
+            /* Update buffer size */
+            csBuffer->bfSize += csChunk;
+
+            /* Update bytes */
+            csByte   += csChunk;
+            csRemain -= csChunk;
+
+            /* Check buffer state */
+            if ( csBuffer->bfSize == csBuffer->bfCapacity ) cs_export_buffer_flush( csBuffer );
+
+        }
+
+    }
+
+/*
+    Source - Buffer concatenation
+ */
+
+    void cs_export_buffer_append( 
+
+        cs_Buffer_t * const csBuffer, 
+        cs_Buffer_t * const csSource 
+
+    ) {
+
+        /* Append source content */
+        cs_export_buffer_memory( csBuffer, csSource->bfData, csSource->bfSize );
+
+        /* Reset source size */
+        csSource->bfSize = 0;
+
+    }
+
+/*
+    Source - String exportation
+ */
+
+    void cs_export_buffer_string( 
+
+        cs_Buffer_t       * const csBuffer, 
+        char        const * const csString 
+
+    ) {
+
+        /* Append string */
+        cs_export_buffer_memory( csBuffer, csString, strlen( csString ) );
+
+    }
+
+/*
+    Source - Timestamp component exportation
+ */
+
+    void cs_export_buffer_time( 
+
+        cs_Buffer_t * const csBuffer, 
+        lp_Time_t     const csValue 
+
+    ) {
+
+        /* Digits variables */
+        char csDigits[CS_BUFFER_MARGIN] = { 0 };
+
+        /* Digits count variables */
+        int csCount = 0;
+
+        /* Value variables */
+        lp_Time_t csRemain = csValue;
+
+        /* Reserve and check buffer space */
+        if ( cs_export_buffer_reserve( csBuffer, CS_BUFFER_MARGIN ) == LC_FALSE ) return;
+
+        /* Compute digits in reverse order */
+        do { csDigits[csCount ++] = '0' + ( csRemain % 10 ); csRemain /= 10; } while ( csRemain > 0 );
+
+        /* Append digits */
+        while ( csCount > 0 ) csBuffer->bfData[csBuffer->bfSize ++] = csDigits[-- csCount];
+
+    }
+
+/*
+    Source - Double exportation
+ */
+
+    void cs_export_buffer_double( 
+
+        cs_Buffer_t * const csBuffer, 
+        double        const csValue 
+
+    ) {
+
+        /* Reserve and check buffer space */
+        if ( cs_export_buffer_reserve( csBuffer, CS_BUFFER_MARGIN ) == LC_FALSE ) return;
+
+        /* Check formatting mode */
+        if ( ( csBuffer->bfLegacy == LC_TRUE ) || ( isfinite( csValue ) == 0 ) ) {
+
+            /* Append legacy representation */
+            csBuffer->bfSize += sprintf( csBuffer->bfData + csBuffer->bfSize, "%.16e", csValue );
+
+        } else {
+
+            /* Append round-trip representation */
+            csBuffer->bfSize += cs_export_dtoa( csValue, csBuffer->bfData + csBuffer->bfSize );
+
+        }
+
+    }
+
+/*
+    Source - Binary integer exportation
+ */
+
+    void cs_export_buffer_uint(
+
+        cs_Buffer_t * const csBuffer,
+        uint64_t      const csValue,
+        int           const csBytes
+
+    ) {
+
+        /* Parsing variables */
+        int csParse = 0;
+
+        /* Reserve and check buffer space */
+        if ( cs_export_buffer_reserve( csBuffer, csBytes ) == LC_FALSE ) return;
+
+        /* Append bytes, least significant first */
+        for ( csParse = 0; csParse < csBytes; csParse ++ ) {
+
+            /* Append byte */
+            csBuffer->bfData[csBuffer->bfSize ++] = ( char ) ( ( csValue >> ( csParse << 3 ) ) & 0xFF );
+
+        }
+
+    }
+
+/*
+    Source - Binary double exportation
+ */
+
+    void cs_export_buffer_real(
+
+        cs_Buffer_t * const csBuffer,
+        double        const csValue
+
+    ) {
+
+        /* Representation variables */
+        uint64_t csBits = 0;
+
+        /* Retrieve double representation */
+        memcpy( & csBits, & csValue, sizeof( double ) );
+
+        /* Append representation */
+        cs_export_buffer_uint( csBuffer, csBits, 8 );
+
+    }
+
@@ -0,0 +1,347 @@
+/*
+ * csps-suite - CSPS library front-end suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   csps-export-buffer.h
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *   
+     *  Buffered exportation stream
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __CS_EXPORT_BUFFER__
+    # define __CS_EXPORT_BUFFER__
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    extern "C" {
+    # endif
+
+/* 
+    Header - Includes
+ */
+
+    # include <stdio.h>
+    # include <stdlib.h>
+    # include <string.h>
+    # include <stdint.h>
+    # include <csps-all.h>
+    # include <common-all.h>
+    # include "csps-export-dtoa.h"
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define buffer size */
+    # define CS_BUFFER_SIZE     4194304
+
+    /* Define buffer formatting margin */
+    # define CS_BUFFER_MARGIN   64
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+    /*! \struct cs_Buffer_struct
+     *  \brief Exportation buffer
+     *
+     *  This structure holds a memory buffer in which the exported text is
+     *  composed. If the buffer is attached to a stream, its content is
+     *  written in the stream by large blocks. Otherwise, the buffer memory
+     *  grows as needed to hold all the composed text.
+     *
+     *  \var cs_Buffer_struct::bfStream
+     *  Exportation stream, NULL for memory buffers
+     *  \var cs_Buffer_struct::bfData
+     *  Buffer memory
+     *  \var cs_Buffer_struct::bfSize
+     *  Buffer filled size, in bytes
+     *  \var cs_Buffer_struct::bfCapacity
+     *  Buffer memory size, in bytes
+     *  \var cs_Buffer_struct::bfOffset
+     *  Amount of bytes already written in the stream
+     *  \var cs_Buffer_struct::bfLegacy
+     *  Legacy double formatting flag
+     */ 
+
+    typedef struct cs_Buffer_struct {
+
+        FILE * bfStream;
+        char * bfData;
+        size_t bfSize;
+        size_t bfCapacity;
+        size_t bfOffset;
+        int    bfLegacy;
+
+    } cs_Buffer_t;
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Buffer creation
+     *
+     *  This function creates an exportation buffer attached to the provided
+     *  stream. If NULL is provided as stream, a memory buffer is created.
+     *
+     *  If LC_TRUE is provided as legacy flag, the doubles are formatted using
+     *  the "%.16e" format, reproducing the exportation of previous versions.
+     *  Otherwise, a representation that reads back to the exact same double,
+     *  usually the shortest one, is used.
+     *
+     *  \param csBuffer Buffer structure
+     *  \param csStream Exportation stream, NULL for memory buffer
+     *  \param csLegacy Legacy double formatting flag
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int cs_export_buffer_create( 
+
+        cs_Buffer_t * const csBuffer, 
+        FILE        * const csStream, 
+        int           const csLegacy 
+
+    );
+
+    /*! \brief Buffer deletion
+     *
+     *  This function writes the remaining buffer content in the exportation
+     *  stream and releases the buffer memory. The stream is not closed.
+     *
+     *  \param csBuffer Buffer structure
+     */
+
+    void cs_export_buffer_delete( 
+
+        cs_Buffer_t * const csBuffer 
+
+    );
+
+    /*! \brief Buffer flush
+     *
+     *  This function writes the buffer content in the exportation stream and
+     *  empties the buffer. Memory buffers are left unchanged.
+     *
+     *  \param csBuffer Buffer structure
+     */
+
+    void cs_export_buffer_flush( 
+
+        cs_Buffer_t * const csBuffer 
+
+    );
+
+    /*! \brief Buffer position
+     *
+     *  This function returns the position, in bytes, at which the next
+     *  appended byte is going to be written in the exportation stream.
+     *
+     *  \param csBuffer Buffer structure
+     *
+     *  \return Returns the buffer position
+     */
+
+    size_t cs_export_buffer_tell(
+
+        cs_Buffer_t const * const csBuffer
+
+    );
+
+    /*! \brief Buffer space reservation
+     *
+     *  This function ensures that the provided amount of bytes can be
+     *  appended to the buffer without overflow. Stream buffers are flushed
+     *  when needed while memory buffers are enlarged.
+     *
+     *  \param csBuffer Buffer structure
+     *  \param csLength Amount of bytes to reserve
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int cs_export_buffer_reserve( 
+
+        cs_Buffer_t * const csBuffer, 
+        size_t        const csLength 
+
+    );
+
+    /*! \brief Bytes exportation
+     *
+     *  This function appends the provided bytes to the buffer.
+     *
+     *  \param csBuffer Buffer structure
+     *  \param csData   Exported bytes
+     *  \param csLength Amount of exported bytes
+     */
+
+    void cs_export_buffer_memory( 
+
+        cs_Buffer_t       * const csBuffer, 
+        char        const * const csData, 
+        size_t              const csLength 
+
+    );
+
+    /*! \brief Buffer concatenation
+     *
+     *  This function appends the content of the source buffer to the
+     *  destination buffer and empties the source buffer.
+     *
+     *  \param csBuffer Destination buffer structure
+     *  \param csSource Source buffer structure
+     */
+
+    void cs_export_buffer_append( 
+
+        cs_Buffer_t * const csBuffer, 
+        cs_Buffer_t * const csSource 
+
+    );
+
+    /*! \brief String exportation
+     *
+     *  This function appends the provided string to the buffer.
+     *
+     *  \param csBuffer Buffer structure
+     *  \param csString Exported string
+     */
+
+    void cs_export_buffer_string( 
+
+        cs_Buffer_t       * const csBuffer, 
+        char        const * const csString 
+
+    );
+
+    /*! \brief Timestamp component exportation
+     *
+     *  This function appends the decimal representation of the provided
+     *  timestamp component to the buffer.
+     *
+     *  \param csBuffer Buffer structure
+     *  \param csValue  Exported timestamp component
+     */
+
+    void cs_export_buffer_time( 
+
+        cs_Buffer_t * const csBuffer, 
+        lp_Time_t     const csValue 
+
+    );
+
+    /*! \brief Double exportation
+     *
+     *  This function appends the representation of the provided double to the
+     *  buffer, according to the buffer formatting mode.
+     *
+     *  \param csBuffer Buffer structure
+     *  \param csValue  Exported double
+     */
+
+    void cs_export_buffer_double(
+
+        cs_Buffer_t * const csBuffer,
+        double        const csValue
+
+    );
+
+    /*! \brief Binary integer exportation
+     *
+     *  This function appends the provided amount of bytes of the provided
+     *  integer to the buffer, least significant byte first, whatever the
+     *  host byte order.
+     *
+     *  \param csBuffer Buffer structure
+     *  \param csValue  Exported integer
+     *  \param csBytes  Amount of exported bytes, up to eight
+     */
+
+    void cs_export_buffer_uint(
+
+        cs_Buffer_t * const csBuffer,
+        uint64_t      const csValue,
+        int           const csBytes
+
+    );
+
+    /*! \brief Binary double exportation
+     *
+     *  This function appends the eight bytes of the IEEE 754 representation of
+     *  the provided double to the buffer, least significant byte first.
+     *
+     *  \param csBuffer Buffer structure
+     *  \param csValue  Exported double
+     */
+
+    void cs_export_buffer_real(
+
+        cs_Buffer_t * const csBuffer,
+        double        const csValue
+
+    );
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    }
+    # endif
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
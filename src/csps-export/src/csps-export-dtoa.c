@@ -0,0 +1,514 @@
+/*
+ * csps-suite - CSPS library front-end suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "csps-export-dtoa.h"
+
+/*
+    Source - Cached powers of ten
+ */
+
+    /* Cached powers significands, from 10^-348 to 10^340 by steps of 10^8 */
+    static uint64_t const cs_export_dtoa_significand[] = {
+
+        UINT64_C( 0xfa8fd5a0081c0288 ), UINT64_C( 0xbaaee17fa23ebf76 ), UINT64_C( 0x8b16fb203055ac76 ),
+        UINT64_C( 0xcf42894a5dce35ea ), UINT64_C( 0x9a6bb0aa55653b2d ), UINT64_C( 0xe61acf033d1a45df ),
+        UINT64_C( 0xab70fe17c79ac6ca ), UINT64_C( 0xff77b1fcbebcdc4f ), UINT64_C( 0xbe5691ef416bd60c ),
+        UINT64_C( 0x8dd01fad907ffc3c ), UINT64_C( 0xd3515c2831559a83 ), UINT64_C( 0x9d71ac8fada6c9b5 ),
+        UINT64_C( 0xea9c227723ee8bcb ), UINT64_C( 0xaecc49914078536d ), UINT64_C( 0x823c12795db6ce57 ),
+        UINT64_C( 0xc21094364dfb5637 ), UINT64_C( 0x9096ea6f3848984f ), UINT64_C( 0xd77485cb25823ac7 ),
+        UINT64_C( 0xa086cfcd97bf97f4 ), UINT64_C( 0xef340a98172aace5 ), UINT64_C( 0xb23867fb2a35b28e ),
+        UINT64_C( 0x84c8d4dfd2c63f3b ), UINT64_C( 0xc5dd44271ad3cdba ), UINT64_C( 0x936b9fcebb25c996 ),
+        UINT64_C( 0xdbac6c247d62a584 ), UINT64_C( 0xa3ab66580d5fdaf6 ), UINT64_C( 0xf3e2f893dec3f126 ),
+        UINT64_C( 0xb5b5ada8aaff80b8 ), UINT64_C( 0x87625f056c7c4a8b ), UINT64_C( 0xc9bcff6034c13053 ),
+        UINT64_C( 0x964e858c91ba2655 ), UINT64_C( 0xdff9772470297ebd ), UINT64_C( 0xa6dfbd9fb8e5b88f ),
+        UINT64_C( 0xf8a95fcf88747d94 ), UINT64_C( 0xb94470938fa89bcf ), UINT64_C( 0x8a08f0f8bf0f156b ),
+        UINT64_C( 0xcdb02555653131b6 ), UINT64_C( 0x993fe2c6d07b7fac ), UINT64_C( 0xe45c10c42a2b3b06 ),
+        UINT64_C( 0xaa242499697392d3 ), UINT64_C( 0xfd87b5f28300ca0e ), UINT64_C( 0xbce5086492111aeb ),
+        UINT64_C( 0x8cbccc096f5088cc ), UINT64_C( 0xd1b71758e219652c ), UINT64_C( 0x9c40000000000000 ),
+        UINT64_C( 0xe8d4a51000000000 ), UINT64_C( 0xad78ebc5ac620000 ), UINT64_C( 0x813f3978f8940984 ),
+        UINT64_C( 0xc097ce7bc90715b3 ), UINT64_C( 0x8f7e32ce7bea5c70 ), UINT64_C( 0xd5d238a4abe98068 ),
+        UINT64_C( 0x9f4f2726179a2245 ), UINT64_C( 0xed63a231d4c4fb27 ), UINT64_C( 0xb0de65388cc8ada8 ),
+        UINT64_C( 0x83c7088e1aab65db ), UINT64_C( 0xc45d1df942711d9a ), UINT64_C( 0x924d692ca61be758 ),
+        UINT64_C( 0xda01ee641a708dea ), UINT64_C( 0xa26da3999aef774a ), UINT64_C( 0xf209787bb47d6b85 ),
+        UINT64_C( 0xb454e4a179dd1877 ), UINT64_C( 0x865b86925b9bc5c2 ), UINT64_C( 0xc83553c5c8965d3d ),
+        UINT64_C( 0x952ab45cfa97a0b3 ), UINT64_C( 0xde469fbd99a05fe3 ), UINT64_C( 0xa59bc234db398c25 ),
+        UINT64_C( 0xf6c69a72a3989f5c ), UINT64_C( 0xb7dcbf5354e9bece ), UINT64_C( 0x88fcf317f22241e2 ),
+        UINT64_C( 0xcc20ce9bd35c78a5 ), UINT64_C( 0x98165af37b2153df ), UINT64_C( 0xe2a0b5dc971f303a ),
+        UINT64_C( 0xa8d9d1535ce3b396 ), UINT64_C( 0xfb9b7cd9a4a7443c ), UINT64_C( 0xbb764c4ca7a44410 ),
+        UINT64_C( 0x8bab8eefb6409c1a ), UINT64_C( 0xd01fef10a657842c ), UINT64_C( 0x9b10a4e5e9913129 ),
+        UINT64_C( 0xe7109bfba19c0c9d ), UINT64_C( 0xac2820d9623bf429 ), UINT64_C( 0x80444b5e7aa7cf85 ),
+        UINT64_C( 0xbf21e44003acdd2d ), UINT64_C( 0x8e679c2f5e44ff8f ), UINT64_C( 0xd433179d9c8cb841 ),
+        UINT64_C( 0x9e19db92b4e31ba9 ), UINT64_C( 0xeb96bf6ebadf77d9 ), UINT64_C( 0xaf87023b9bf0ee6b )
+
+    };
+
+    /* Cached powers binary exponents */
+    static int const cs_export_dtoa_exponent[] = {
+
+        -1220, -1193, -1166, -1140, -1113, -1087, -1060, -1034, -1007,  -980,
+         -954,  -927,  -901,  -874,  -847,  -821,  -794,  -768,  -741,  -715,
+         -688,  -661,  -635,  -608,  -582,  -555,  -529,  -502,  -475,  -449,
+         -422,  -396,  -369,  -343,  -316,  -289,  -263,  -236,  -210,  -183,
+         -157,  -130,  -103,   -77,   -50,   -24,     3,    30,    56,    83,
+          109,   136,   162,   189,   216,   242,   269,   295,   322,   348,
+          375,   402,   428,   455,   481,   508,   534,   561,   588,   614,
+          641,   667,   694,   720,   747,   774,   800,   827,   853,   880,
+          907,   933,   960,   986,  1013,  1039,  1066
+
+    };
+
+    /* Powers of ten */
+    static uint64_t const cs_export_dtoa_power[] = {
+
+        UINT64_C( 1 ), UINT64_C( 10 ), UINT64_C( 100 ), UINT64_C( 1000 ), UINT64_C( 10000 ), 
+        UINT64_C( 100000 ), UINT64_C( 1000000 ), UINT64_C( 10000000 ), UINT64_C( 100000000 ), 
+        UINT64_C( 1000000000 ), UINT64_C( 10000000000 ), UINT64_C( 100000000000 ), 
+        UINT64_C( 1000000000000 ), UINT64_C( 10000000000000 ), UINT64_C( 100000000000000 ), 
+        UINT64_C( 1000000000000000 ), UINT64_C( 10000000000000000 ), UINT64_C( 100000000000000000 ), 
+        UINT64_C( 1000000000000000000 ), UINT64_C( 10000000000000000000 )
+
+    };
+
+/*
+    Source - Double formatting
+ */
+
+    int cs_export_dtoa( 
+
+        double const         csValue, 
+        char         * const csString 
+
+    ) {
+
+        /* Digits variables */
+        char * csDigits = csString;
+
+        /* Digits count variables */
+        int csLength = 0;
+
+        /* Decimal exponent variables */
+        int csPower = 0;
+
+        /* Check value sign */
+        if ( signbit( csValue ) != 0 ) * ( csDigits ++ ) = '-';
+
+        /* Check null value */
+        if ( csValue == 0.0 ) {
+
+            /* Compose null representation */
+            memcpy( csDigits, "0.0", 3 );
+
+            /* Return representation length */
+            return( ( csDigits - csString ) + 3 );
+
+        }
+
+        /* Generate value digits */
+        csPower = cs_export_dtoa_grisu( fabs( csValue ), csDigits, & csLength );
+
+        /* Compose and return representation length */
+        return( ( csDigits - csString ) + cs_export_dtoa_compose( csDigits, csLength, csPower ) );
+
+    }
+
+/*
+    Source - Extended floating point product
+ */
+
+    cs_Float_t cs_export_dtoa_multiply( 
+
+        cs_Float_t const csA, 
+        cs_Float_t const csB 
+
+    ) {
+
+        /* Half-words variables */
+        uint64_t csAh = csA.ftMantissa >> 32;
+        uint64_t csAl = csA.ftMantissa & UINT64_C( 0xFFFFFFFF );
+        uint64_t csBh = csB.ftMantissa >> 32;
+        uint64_t csBl = csB.ftMantissa & UINT64_C( 0xFFFFFFFF );
+
+        /* Partial products variables */
+        uint64_t csHH = csAh * csBh;
+        uint64_t csLH = csAl * csBh;
+        uint64_t csHL = csAh * csBl;
+        uint64_t csLL = csAl * csBl;
+
+        /* Carry variables */
+        uint64_t csCarry = ( csLL >> 32 ) + ( csHL & UINT64_C( 0xFFFFFFFF ) ) + ( csLH & UINT64_C( 0xFFFFFFFF ) );
+
+        /* Round lower half */
+        csCarry += UINT64_C( 1 ) << 31;
+
+        /* Return product */
+        return( ( cs_Float_t ) { csHH + ( csHL >> 32 ) + ( csLH >> 32 ) + ( csCarry >> 32 ), csA.ftExponent + csB.ftExponent + 64 } );
+
+    }
+
+/*
+    Source - Grisu2 digits generation
+ */
+
+    int cs_export_dtoa_grisu( 
+
+        double const         csValue, 
+        char         * const csDigits, 
+        int          * const csLength 
+
+    ) {
+
+        /* Binary representation variables */
+        uint64_t csBits = 0;
+
+        /* Value and boundaries variables */
+        cs_Float_t csV = { 0, 0 };
+        cs_Float_t csP = { 0, 0 };
+        cs_Float_t csM = { 0, 0 };
+
+        /* Cached power variables */
+        cs_Float_t csC = { 0, 0 };
+
+        /* Scaled value and boundaries variables */
+        cs_Float_t csW  = { 0, 0 };
+        cs_Float_t csWp = { 0, 0 };
+        cs_Float_t csWm = { 0, 0 };
+
+        /* Cached power index variables */
+        double csApprox = 0.0;
+        int    csIndex  = 0;
+
+        /* Decimal exponent variables */
+        int csPower = 0;
+
+        /* Digits generation variables */
+        uint64_t csOne   = 0;
+        uint64_t csGap   = 0;
+        uint64_t csDelta = 0;
+        uint64_t csRest  = 0;
+        uint32_t csHigh  = 0;
+        uint64_t csLow   = 0;
+        uint32_t csDigit = 0;
+        int      csShift = 0;
+        int      csKappa = 1;
+
+        /* Retrieve binary representation */
+        memcpy( & csBits, & csValue, sizeof( double ) );
+
+        /* Decompose binary representation */
+        if ( ( csBits & UINT64_C( 0x7FF0000000000000 ) ) != 0 ) {
+
+            /* Decompose normal value */
+            csV = ( cs_Float_t ) { ( csBits & UINT64_C( 0x000FFFFFFFFFFFFF ) ) + UINT64_C( 0x0010000000000000 ), ( int ) ( ( csBits >> 52 ) & 0x7FF ) - 1075 };
+
+        } else {
+
+            /* Decompose subnormal value */
+            csV = ( cs_Float_t ) { csBits & UINT64_C( 0x000FFFFFFFFFFFFF ), -1074 };
+
+        }
+
+        /* Compute upper boundary */
+        csP = ( cs_Float_t ) { ( csV.ftMantissa << 1 ) + 1, csV.ftExponent - 1 };
+
+        /* Normalize upper boundary */
+        while ( ( csP.ftMantissa & UINT64_C( 0x0020000000000000 ) ) == 0 ) { csP.ftMantissa <<= 1; csP.ftExponent --; }
+
+        /* Normalize upper boundary */
+        csP.ftMantissa <<= 10; csP.ftExponent -= 10;
+
+        /* Compute lower boundary */
+        if ( csV.ftMantissa == UINT64_C( 0x0010000000000000 ) ) {
+
+            /* Compute lower boundary on binade change */
+            csM = ( cs_Float_t ) { ( csV.ftMantissa << 2 ) - 1, csV.ftExponent - 2 };
+
+        } else {
+
+            /* Compute lower boundary */
+            csM = ( cs_Float_t ) { ( csV.ftMantissa << 1 ) - 1, csV.ftExponent - 1 };
+
+        }
+
+        /* Align lower boundary on upper boundary */
+        csM.ftMantissa <<= csM.ftExponent - csP.ftExponent; csM.ftExponent = csP.ftExponent;
+
+        /* Normalize value */
+        while ( ( csV.ftMantissa & UINT64_C( 0x8000000000000000 ) ) == 0 ) { csV.ftMantissa <<= 1; csV.ftExponent --; }
+
+        /* Compute cached power index */
+        csApprox = ( -61 - csP.ftExponent ) * 0.30102999566398114 + 347;
+
+        /* Compute cached power index */
+        csIndex = ( int ) csApprox; if ( ( csApprox - csIndex ) > 0.0 ) csIndex ++;
+
+        /* Compute cached power index */
+        csIndex = ( csIndex >> 3 ) + 1;
+
+        /* Compute decimal exponent */
+        csPower = 348 - ( csIndex << 3 );
+
+        /* Retrieve cached power */
+        csC = ( cs_Float_t ) { cs_export_dtoa_significand[csIndex], cs_export_dtoa_exponent[csIndex] };
+
+        /* Scale value and boundaries */
+        csW  = cs_export_dtoa_multiply( csV, csC );
+        csWp = cs_export_dtoa_multiply( csP, csC );
+        csWm = cs_export_dtoa_multiply( csM, csC );
+
+        /* Narrow rounding interval */
+        csWm.ftMantissa ++;
+        csWp.ftMantissa --;
+
+        /* Compute unit and shift */
+        csShift = - csWp.ftExponent;
+        csOne   = UINT64_C( 1 ) << csShift;
+
+        /* Compute distances */
+        csGap   = csWp.ftMantissa - csW.ftMantissa;
+        csDelta = csWp.ftMantissa - csWm.ftMantissa;
+
+        /* Split upper boundary */
+        csHigh = ( uint32_t ) ( csWp.ftMantissa >> csShift );
+        csLow  = csWp.ftMantissa & ( csOne - 1 );
+
+        /* Count integral part digits */
+        while ( ( csKappa < 10 ) && ( csHigh >= cs_export_dtoa_power[csKappa] ) ) csKappa ++;
+
+        /* Reset digits count */
+        * csLength = 0;
+
+        /* Generate integral part digits */
+        while ( csKappa > 0 ) {
+
+            /* Extract digit */
+            csDigit = csHigh / cs_export_dtoa_power[csKappa - 1];
+
+            /* Update integral part */
+            csHigh %= cs_export_dtoa_power[csKappa - 1];
+
+            /* Store digit */
+            if ( ( csDigit != 0 ) || ( ( * csLength ) != 0 ) ) csDigits[( * csLength ) ++] = '0' + csDigit;
+
+            /* Update digit weight */
+            csKappa --;
+
+            /* Compute remainder */
+            csRest = ( ( ( uint64_t ) csHigh ) << csShift ) + csLow;
+
+            /* Check rounding interval */
+            if ( csRest <= csDelta ) {
+
+                /* Adjust last digit */
+                cs_export_dtoa_round( csDigits, * csLength, csDelta, csRest, cs_export_dtoa_power[csKappa] << csShift, csGap );
+
+                /* Return decimal exponent */
+                return( csPower + csKappa );
+
+            }
+
+        }
+
+        /* Generate fractional part digits */
+        for ( ; ; ) {
+
+            /* Shift fractional part */
+            csLow *= 10; csDelta *= 10;
+
+            /* Extract digit */
+            csDigit = ( uint32_t ) ( csLow >> csShift );
+
+            /* Store digit */
+            if ( ( csDigit != 0 ) || ( ( * csLength ) != 0 ) ) csDigits[( * csLength ) ++] = '0' + csDigit;
+
+            /* Update fractional part */
+            csLow &= csOne - 1;
+
+            /* Update digit weight */
+            csKappa --;
+
+            /* Check rounding interval */
+            if ( csLow < csDelta ) {
+
+                /* Adjust last digit */
+                cs_export_dtoa_round( csDigits, * csLength, csDelta, csLow, csOne, csGap * ( ( -csKappa < 20 ) ? cs_export_dtoa_power[-csKappa] : 0 ) );
+
+                /* Return decimal exponent */
+                return( csPower + csKappa );
+
+            }
+
+        }
+
+    }
+
+/*
+    Source - Grisu2 last digit adjustment
+ */
+
+    void cs_export_dtoa_round( 
+
+        char     * const csDigits, 
+        int        const csLength, 
+        uint64_t   const csDelta, 
+        uint64_t         csRest, 
+        uint64_t   const csTen, 
+        uint64_t   const csGap 
+
+    ) {
+
+        /* Approach exact value */
+        while ( 
+
+            ( csRest < csGap ) && 
+            ( ( csDelta - csRest ) >= csTen ) && 
+            ( ( ( csRest + csTen ) < csGap ) || ( ( csGap - csRest ) > ( csRest + csTen - csGap ) ) ) 
+
+        ) {
+
+            /* Decrease last digit */
+            csDigits[csLength - 1] --;
+
+            /* Update remainder */
+            csRest += csTen;
+
+        }
+
+    }
+
+/*
+    Source - Representation composition
+ */
+
+    int cs_export_dtoa_compose( 
+
+        char * const csDigits, 
+        int    const csLength, 
+        int    const csPower 
+
+    ) {
+
+        /* Decimal point position variables */
+        int csPoint = csLength + csPower;
+
+        /* Exponent variables */
+        int csExponent = csPoint - 1;
+
+        /* Composition variables */
+        int csParse = 0;
+        int csShift = 0;
+
+        /* Check representation mode */
+        if ( ( csPower >= 0 ) && ( csPoint <= 21 ) ) {
+
+            /* Pad integer digits */
+            for ( csParse = csLength; csParse < csPoint; csParse ++ ) csDigits[csParse] = '0';
+
+            /* Append decimal suffix */
+            csDigits[csPoint] = '.'; csDigits[csPoint + 1] = '0';
+
+            /* Return representation length */
+            return( csPoint + 2 );
+
+        } else
+        if ( ( csPoint > 0 ) && ( csPoint <= 21 ) ) {
+
+            /* Insert decimal point */
+            memmove( csDigits + csPoint + 1, csDigits + csPoint, csLength - csPoint ); csDigits[csPoint] = '.';
+
+            /* Return representation length */
+            return( csLength + 1 );
+
+        } else
+        if ( ( csPoint > -6 ) && ( csPoint <= 0 ) ) {
+
+            /* Compute leading zeros shift */
+            csShift = 2 - csPoint;
+
+            /* Shift digits */
+            memmove( csDigits + csShift, csDigits, csLength );
+
+            /* Insert leading zeros */
+            for ( csParse = 0; csParse < csShift; csParse ++ ) csDigits[csParse] = '0';
+
+            /* Insert decimal point */
+            csDigits[1] = '.';
+
+            /* Return representation length */
+            return( csLength + csShift );
+
+        } else {
+
+            /* Check digits count */
+            if ( csLength == 1 ) {
+
+                /* Compose exponent mark */
+                csDigits[1] = 'e'; csParse = 2;
+
+            } else {
+
+                /* Insert decimal point */
+                memmove( csDigits + 2, csDigits + 1, csLength - 1 ); csDigits[1] = '.';
+
+                /* Compose exponent mark */
+                csDigits[csLength + 1] = 'e'; csParse = csLength + 2;
+
+            }
+
+            /* Compose exponent sign */
+            if ( csExponent < 0 ) { csDigits[csParse ++] = '-'; csExponent = -csExponent; }
+
+            /* Compose exponent digits */
+            if ( csExponent >= 100 ) csDigits[csParse ++] = '0' + ( csExponent / 100 );
+            if ( csExponent >=  10 ) csDigits[csParse ++] = '0' + ( csExponent / 10 ) % 10;
+
+            /* Compose exponent digits */
+            csDigits[csParse ++] = '0' + ( csExponent % 10 );
+
+            /* Return representation length */
+            return( csParse );
+
+        }
+
+    }
+
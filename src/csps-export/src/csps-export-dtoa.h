@@ -0,0 +1,237 @@
+/*
+ * csps-suite - CSPS library front-end suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   csps-export-dtoa.h
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *   
+     *  Round-trip double formatting
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __CS_EXPORT_DTOA__
+    # define __CS_EXPORT_DTOA__
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    extern "C" {
+    # endif
+
+/* 
+    Header - Includes
+ */
+
+    # include <stdint.h>
+    # include <string.h>
+    # include <math.h>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define formatted double maximum length */
+    # define CS_DTOA_LENGTH 32
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+    /*! \struct cs_Float_struct
+     *  \brief Extended floating point value
+     *
+     *  This structure holds a floating point value as an unsigned 64 bits
+     *  significand and a binary exponent, the value being significand times
+     *  two to the power of the exponent.
+     *
+     *  \var cs_Float_struct::ftMantissa
+     *  Value significand
+     *  \var cs_Float_struct::ftExponent
+     *  Value binary exponent
+     */ 
+
+    typedef struct cs_Float_struct {
+
+        uint64_t ftMantissa;
+        int      ftExponent;
+
+    } cs_Float_t;
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Double formatting
+     *
+     *  This function writes a decimal representation of the provided double
+     *  that reads back to the exact same value. The Grisu2 algorithm of F.
+     *  Loitsch is used to generate the digits. The representation is usually
+     *  the shortest one, but Grisu2 has no exactness fallback and a few values
+     *  get one more digit than needed. The digits are then written in fixed
+     *  notation for moderate exponents and in exponential notation otherwise.
+     *  Integer values keep a ".0" suffix so that they are still read as
+     *  floating point values.
+     *
+     *  The provided string has to be at least CS_DTOA_LENGTH bytes long. The
+     *  written string is not null-terminated.
+     *
+     *  \param csValue  Double to format, has to be finite
+     *  \param csString String receiving the representation
+     *
+     *  \return Returns the length of the representation
+     */
+
+    int cs_export_dtoa( 
+
+        double const         csValue, 
+        char         * const csString 
+
+    );
+
+    /*! \brief Extended floating point product
+     *
+     *  This function computes the rounded product of two extended floating
+     *  point values, keeping the 64 most significant bits of the significands
+     *  product.
+     *
+     *  \param csA First operand
+     *  \param csB Second operand
+     *
+     *  \return Returns the product
+     */
+
+    cs_Float_t cs_export_dtoa_multiply( 
+
+        cs_Float_t const csA, 
+        cs_Float_t const csB 
+
+    );
+
+    /*! \brief Grisu2 digits generation
+     *
+     *  This function generates the decimal digits of the provided double in
+     *  the provided buffer. The generated digits, read as an integer, times ten
+     *  to the power of the returned decimal exponent give back the double.
+     *
+     *  \param csValue  Positive double
+     *  \param csDigits Digits buffer
+     *  \param csLength Pointer to the variable that recieves digits count
+     *
+     *  \return Returns the decimal exponent
+     */
+
+    int cs_export_dtoa_grisu( 
+
+        double const         csValue, 
+        char         * const csDigits, 
+        int          * const csLength 
+
+    );
+
+    /*! \brief Grisu2 last digit adjustment
+     *
+     *  This function decreases the last generated digit as long as the
+     *  represented value gets closer to the exact value while staying in the
+     *  rounding interval.
+     *
+     *  \param csDigits Digits buffer
+     *  \param csLength Digits count
+     *  \param csDelta  Rounding interval width
+     *  \param csRest   Remainder of the digits generation
+     *  \param csTen    Scaled weight of the last digit
+     *  \param csGap    Distance between upper bound and exact value
+     */
+
+    void cs_export_dtoa_round( 
+
+        char     * const csDigits, 
+        int        const csLength, 
+        uint64_t   const csDelta, 
+        uint64_t         csRest, 
+        uint64_t   const csTen, 
+        uint64_t   const csGap 
+
+    );
+
+    /*! \brief Representation composition
+     *
+     *  This function composes the final representation of the generated
+     *  digits and decimal exponent, choosing between fixed and exponential
+     *  notation.
+     *
+     *  \param csDigits Digits buffer, receiving the representation
+     *  \param csLength Digits count
+     *  \param csPower  Decimal exponent
+     *
+     *  \return Returns the length of the representation
+     */
+
+    int cs_export_dtoa_compose( 
+
+        char * const csDigits, 
+        int    const csLength, 
+        int    const csPower 
+
+    );
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    }
+    # endif
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
@@ -0,0 +1,199 @@
+/*
+ * csps-suite - CSPS library front-end suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "csps-export-index.h"
+
+/*
+    Source - Index creation
+ */
+
+    int cs_export_index_create( 
+
+        cs_Index_t * const csIndex, 
+        long         const csCount 
+
+    ) {
+
+        /* Slots count variables */
+        size_t csSize = 16;
+
+        /* Parsing variables */
+        size_t csParse = 0;
+
+        /* Compute slots count */
+        while ( csSize < ( size_t ) ( csCount << 1 ) ) csSize <<= 1;
+
+        /* Allocate index memory */
+        csIndex->ixKey   = ( lp_Time_t * ) malloc( csSize * sizeof( lp_Time_t ) );
+        csIndex->ixValue = ( long      * ) malloc( csSize * sizeof( long      ) );
+
+        /* Check index memory */
+        if ( ( csIndex->ixKey == NULL ) || ( csIndex->ixValue == NULL ) ) {
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : unable to allocate memory\n" );
+
+            /* Release index memory */
+            cs_export_index_delete( csIndex );
+
+            /* Return failure */
+            return( LC_FALSE );
+
+        }
+
+        /* Assign slots mask */
+        csIndex->ixMask = csSize - 1;
+
+        /* Empty slots */
+        for ( csParse = 0; csParse < csSize; csParse ++ ) csIndex->ixValue[csParse] = CS_INDEX_EMPTY;
+
+        /* Return success */
+        return( LC_TRUE );
+
+    }
+
+/*
+    Source - Index deletion
+ */
+
+    void cs_export_index_delete( 
+
+        cs_Index_t * const csIndex 
+
+    ) {
+
+        /* Release index memory */
+        free( csIndex->ixKey   );
+        free( csIndex->ixValue );
+
+        /* Invalidate index memory */
+        csIndex->ixKey   = NULL;
+        csIndex->ixValue = NULL;
+
+    }
+
+/*
+    Source - Index insertion
+ */
+
+    void cs_export_index_insert( 
+
+        cs_Index_t * const csIndex, 
+        lp_Time_t    const csMaster, 
+        long         const csValue 
+
+    ) {
+
+        /* Slot variables */
+        size_t csSlot = cs_export_index_hash( csMaster ) & csIndex->ixMask;
+
+        /* Search free or matching slot */
+        while ( csIndex->ixValue[csSlot] != CS_INDEX_EMPTY ) {
+
+            /* Keep first inserted position */
+            if ( csIndex->ixKey[csSlot] == csMaster ) return;
+
+            /* Probe next slot */
+            csSlot = ( csSlot + 1 ) & csIndex->ixMask;
+
+        }
+
+        /* Assign slot */
+        csIndex->ixKey  [csSlot] = csMaster;
+        csIndex->ixValue[csSlot] = csValue;
+
+    }
+
+/*
+    Source - Index search
+ */
+
+    long cs_export_index_search( 
+
+        cs_Index_t const * const csIndex, 
+        lp_Time_t          const csMaster 
+
+    ) {
+
+        /* Slot variables */
+        size_t csSlot = cs_export_index_hash( csMaster ) & csIndex->ixMask;
+
+        /* Search matching slot */
+        while ( csIndex->ixValue[csSlot] != CS_INDEX_EMPTY ) {
+
+            /* Check slot timestamp */
+            if ( csIndex->ixKey[csSlot] == csMaster ) return( csIndex->ixValue[csSlot] );
+
+            /* Probe next slot */
+            csSlot = ( csSlot + 1 ) & csIndex->ixMask;
+
+        }
+
+        /* Return empty position */
+        return( CS_INDEX_EMPTY );
+
+    }
+
+/*
+    Source - Timestamp hash
+ */
+
+    uint64_t cs_export_index_hash( 
+
+        lp_Time_t const csMaster 
+
+    ) {
+
+        /* Hash variables */
+        uint64_t csHash = ( uint64_t ) csMaster;
+
+        /* Mix timestamp bits */
+        csHash ^= csHash >> 30; csHash *= UINT64_C( 0xBF58476D1CE4E5B9 );
+        csHash ^= csHash >> 27; csHash *= UINT64_C( 0x94D049BB133111EB );
+        csHash ^= csHash >> 31;
+
+        /* Return timestamp hash */
+        return( csHash );
+
+    }
+
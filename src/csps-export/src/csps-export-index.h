@@ -0,0 +1,214 @@
+/*
+ * csps-suite - CSPS library front-end suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   csps-export-index.h
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *   
+     *  Previous poses timestamp index
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __CS_EXPORT_INDEX__
+    # define __CS_EXPORT_INDEX__
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    extern "C" {
+    # endif
+
+/* 
+    Header - Includes
+ */
+
+    # include <stdio.h>
+    # include <stdlib.h>
+    # include <stdint.h>
+    # include <csps-all.h>
+    # include <common-all.h>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define empty index slot */
+    # define CS_INDEX_EMPTY -1
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+    /*! \struct cs_Index_struct
+     *  \brief Timestamp index
+     *
+     *  This structure holds an open addressing hash table associating master
+     *  timestamps to the position of the corresponding pose in the previous
+     *  exportation poses array.
+     *
+     *  \var cs_Index_struct::ixKey
+     *  Slots master timestamp
+     *  \var cs_Index_struct::ixValue
+     *  Slots pose position, CS_INDEX_EMPTY for empty slots
+     *  \var cs_Index_struct::ixMask
+     *  Slots count minus one, slots count being a power of two
+     */ 
+
+    typedef struct cs_Index_struct {
+
+        lp_Time_t * ixKey;
+        long      * ixValue;
+        size_t      ixMask;
+
+    } cs_Index_t;
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Index creation
+     *
+     *  This function allocates an empty index able to hold the provided count
+     *  of poses. The slots count is chosen as the smallest power of two that
+     *  keeps the index at most half filled.
+     *
+     *  \param csIndex Index structure
+     *  \param csCount Count of poses to index
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int cs_export_index_create( 
+
+        cs_Index_t * const csIndex, 
+        long         const csCount 
+
+    );
+
+    /*! \brief Index deletion
+     *
+     *  This function releases the index memory.
+     *
+     *  \param csIndex Index structure
+     */
+
+    void cs_export_index_delete( 
+
+        cs_Index_t * const csIndex 
+
+    );
+
+    /*! \brief Index insertion
+     *
+     *  This function associates the provided pose position to the provided
+     *  master timestamp. If the timestamp is already indexed, the first
+     *  inserted position is kept.
+     *
+     *  \param csIndex  Index structure
+     *  \param csMaster Pose master timestamp
+     *  \param csValue  Pose position
+     */
+
+    void cs_export_index_insert( 
+
+        cs_Index_t * const csIndex, 
+        lp_Time_t    const csMaster, 
+        long         const csValue 
+
+    );
+
+    /*! \brief Index search
+     *
+     *  This function searches the pose position associated to the provided
+     *  master timestamp.
+     *
+     *  \param csIndex  Index structure
+     *  \param csMaster Pose master timestamp
+     *
+     *  \return Returns pose position, CS_INDEX_EMPTY if not found
+     */
+
+    long cs_export_index_search( 
+
+        cs_Index_t const * const csIndex, 
+        lp_Time_t          const csMaster 
+
+    );
+
+    /*! \brief Timestamp hash
+     *
+     *  This function computes the slot hash of a master timestamp by mixing
+     *  all its bits.
+     *
+     *  \param csMaster Master timestamp
+     *
+     *  \return Returns timestamp hash
+     */
+
+    uint64_t cs_export_index_hash( 
+
+        lp_Time_t const csMaster 
+
+    );
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    }
+    # endif
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
@@ -0,0 +1,789 @@
+/*
+ * csps-suite - CSPS library front-end suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "csps-export-json.h"
+
+/*
+    Source - Previous exportation import
+ */
+
+    int cs_export_json_import( 
+
+        cs_Json_t * const csJson, 
+        char      * const csFile 
+
+    ) {
+
+        /* Reader variables */
+        cs_Reader_t * csReader = NULL;
+
+        /* Status variables */
+        int csStatus = LC_FALSE;
+
+        /* Initialize document */
+        memset( csJson, 0, sizeof( cs_Json_t ) );
+
+        /* Allocate and check reader */
+        if ( ( csReader = ( cs_Reader_t * ) malloc( sizeof( cs_Reader_t ) ) ) == NULL ) return( LC_FALSE );
+
+        /* Initialize reader */
+        csReader->rdSize = 0;
+        csReader->rdHead = 0;
+
+        /* Create and check input stream */
+        if ( ( csReader->rdStream = fopen( csFile, "r" ) ) != NULL ) {
+
+            /* Parse document */
+            csStatus = cs_export_json_document( csReader, csJson );
+
+            /* Close input stream */
+            fclose( csReader->rdStream );
+
+        }
+
+        /* Release reader */
+        free( csReader );
+
+        /* Release document on failure */
+        if ( csStatus == LC_FALSE ) cs_export_json_delete( csJson );
+
+        /* Return status */
+        return( csStatus );
+
+    }
+
+/*
+    Source - Imported document deletion
+ */
+
+    void cs_export_json_delete( 
+
+        cs_Json_t * const csJson 
+
+    ) {
+
+        /* Release document memory */
+        free( csJson->jsRaw    );
+        free( csJson->jsMaster );
+        free( csJson->jsPool   );
+
+        /* Reset document */
+        memset( csJson, 0, sizeof( cs_Json_t ) );
+
+    }
+
+/*
+    Source - Imported string access
+ */
+
+    char const * cs_export_json_string( 
+
+        cs_Json_t  const * const csJson, 
+        cs_Field_t const * const csField 
+
+    ) {
+
+        /* Return string value */
+        return( csJson->jsPool + csField->fdOffset );
+
+    }
+
+/*
+    Source - Document parser
+ */
+
+    int cs_export_json_document( 
+
+        cs_Reader_t * const csReader, 
+        cs_Json_t   * const csJson 
+
+    ) {
+
+        /* Key variables */
+        char csKey[CS_JSON_TOKEN] = { 0 };
+
+        /* Status variables */
+        int csStatus = LC_TRUE;
+
+        /* Check and consume object opening */
+        if ( cs_export_json_peek( csReader ) != '{' ) return( LC_FALSE ); else cs_export_json_get( csReader );
+
+        /* Check empty object */
+        if ( cs_export_json_peek( csReader ) == '}' ) return( ( cs_export_json_get( csReader ) == '}' ) ? LC_TRUE : LC_FALSE );
+
+        /* Parsing object members */
+        while ( csStatus == LC_TRUE ) {
+
+            /* Parse member key */
+            if ( cs_export_json_key( csReader, csKey ) == LC_FALSE ) return( LC_FALSE );
+
+            /* Parse member value */
+            if ( strcmp( csKey, "split" ) == 0 ) {
+
+                /* Import field */
+                csStatus = cs_export_json_field( csReader, csJson, & csJson->jsSplit );
+
+            } else
+            if ( strcmp( csKey, "preview" ) == 0 ) {
+
+                /* Import field */
+                csStatus = cs_export_json_field( csReader, csJson, & csJson->jsPreview );
+
+            } else
+            if ( strcmp( csKey, "trash" ) == 0 ) {
+
+                /* Import field */
+                csStatus = cs_export_json_field( csReader, csJson, & csJson->jsTrash );
+
+            } else
+            if ( ( strcmp( csKey, "pose" ) == 0 ) && ( cs_export_json_peek( csReader ) == '[' ) ) {
+
+                /* Import poses */
+                csStatus = cs_export_json_poses( csReader, csJson );
+
+            } else {
+
+                /* Skip member value */
+                csStatus = cs_export_json_skip( csReader );
+
+            }
+
+            /* Check member status */
+            if ( csStatus == LC_FALSE ) return( LC_FALSE );
+
+            /* Parse member separator */
+            if ( cs_export_json_peek( csReader ) == '}' ) return( ( cs_export_json_get( csReader ) == '}' ) ? LC_TRUE : LC_FALSE );
+
+            /* Check member separator */
+            csStatus = ( cs_export_json_get( csReader ) == ',' ) ? LC_TRUE : LC_FALSE;
+
+        }
+
+        /* Return status */
+        return( csStatus );
+
+    }
+
+/*
+    Source - Poses array parser
+ */
+
+    int cs_export_json_poses( 
+
+        cs_Reader_t * const csReader, 
+        cs_Json_t   * const csJson 
+
+    ) {
+
+        /* Status variables */
+        int csStatus = LC_TRUE;
+
+        /* Consume array opening */
+        cs_export_json_get( csReader );
+
+        /* Check empty array */
+        if ( cs_export_json_peek( csReader ) == ']' ) return( ( cs_export_json_get( csReader ) == ']' ) ? LC_TRUE : LC_FALSE );
+
+        /* Parsing array elements */
+        while ( csStatus == LC_TRUE ) {
+
+            /* Check element type */
+            if ( cs_export_json_peek( csReader ) == '{' ) {
+
+                /* Import pose */
+                csStatus = cs_export_json_pose( csReader, csJson );
+
+            } else {
+
+                /* Skip element */
+                csStatus = cs_export_json_skip( csReader );
+
+            }
+
+            /* Check element status */
+            if ( csStatus == LC_FALSE ) return( LC_FALSE );
+
+            /* Parse element separator */
+            if ( cs_export_json_peek( csReader ) == ']' ) return( ( cs_export_json_get( csReader ) == ']' ) ? LC_TRUE : LC_FALSE );
+
+            /* Check element separator */
+            csStatus = ( cs_export_json_get( csReader ) == ',' ) ? LC_TRUE : LC_FALSE;
+
+        }
+
+        /* Return status */
+        return( csStatus );
+
+    }
+
+/*
+    Source - Pose object parser
+ */
+
+    int cs_export_json_pose( 
+
+        cs_Reader_t * const csReader, 
+        cs_Json_t   * const csJson 
+
+    ) {
+
+        /* Key variables */
+        char csKey[CS_JSON_TOKEN] = { 0 };
+
+        /* Pose fields variables */
+        cs_Field_t csRaw = { CS_JSON_ABSENT, 0 };
+
+        /* Pose timestamp variables */
+        long csSec  = 0;
+        long csUsec = 0;
+
+        /* Arrays swap variables */
+        cs_Field_t * csSwapRaw    = NULL;
+        lp_Time_t  * csSwapMaster = NULL;
+
+        /* Status variables */
+        int csStatus = LC_TRUE;
+
+        /* Consume object opening */
+        cs_export_json_get( csReader );
+
+        /* Check empty object */
+        if ( cs_export_json_peek( csReader ) == '}' ) {
+
+            /* Consume object closure */
+            cs_export_json_get( csReader );
+
+        } else {
+
+            /* Parsing object members */
+            while ( csStatus == LC_TRUE ) {
+
+                /* Parse member key */
+                if ( cs_export_json_key( csReader, csKey ) == LC_FALSE ) return( LC_FALSE );
+
+                /* Parse member value */
+                if ( strcmp( csKey, "raw" ) == 0 ) {
+
+                    /* Import field */
+                    csStatus = cs_export_json_field( csReader, csJson, & csRaw );
+
+                } else
+                if ( strcmp( csKey, "sec" ) == 0 ) {
+
+                    /* Import timestamp component */
+                    csStatus = cs_export_json_integer( csReader, & csSec );
+
+                } else
+                if ( strcmp( csKey, "usec" ) == 0 ) {
+
+                    /* Import timestamp component */
+                    csStatus = cs_export_json_integer( csReader, & csUsec );
+
+                } else {
+
+                    /* Skip member value */
+                    csStatus = cs_export_json_skip( csReader );
+
+                }
+
+                /* Check member status */
+                if ( csStatus == LC_FALSE ) return( LC_FALSE );
+
+                /* Parse member separator */
+                if ( cs_export_json_peek( csReader ) == '}' ) {
+
+                    /* Consume object closure */
+                    cs_export_json_get( csReader );
+
+                    /* Stop parsing */
+                    break;
+
+                }
+
+                /* Check member separator */
+                csStatus = ( cs_export_json_get( csReader ) == ',' ) ? LC_TRUE : LC_FALSE;
+
+            }
+
+            /* Check members status */
+            if ( csStatus == LC_FALSE ) return( LC_FALSE );
+
+        }
+
+        /* Check arrays capacity */
+        if ( csJson->jsCount == csJson->jsCapacity ) {
+
+            /* Update arrays capacity */
+            csJson->jsCapacity = ( csJson->jsCapacity == 0 ) ? 1024 : csJson->jsCapacity << 1;
+
+            /* Reallocate arrays */
+            csSwapRaw    = ( cs_Field_t * ) realloc( csJson->jsRaw   , csJson->jsCapacity * sizeof( cs_Field_t ) );
+            csSwapMaster = ( lp_Time_t  * ) realloc( csJson->jsMaster, csJson->jsCapacity * sizeof( lp_Time_t  ) );
+
+            /* Assign reallocated arrays */
+            if ( csSwapRaw    != NULL ) csJson->jsRaw    = csSwapRaw;
+            if ( csSwapMaster != NULL ) csJson->jsMaster = csSwapMaster;
+
+            /* Check reallocated arrays */
+            if ( ( csSwapRaw == NULL ) || ( csSwapMaster == NULL ) ) return( LC_FALSE );
+
+        }
+
+        /* Assign pose fields */
+        csJson->jsRaw   [csJson->jsCount  ] = csRaw;
+        csJson->jsMaster[csJson->jsCount ++] = lp_timestamp_compose( csSec, csUsec );
+
+        /* Return status */
+        return( LC_TRUE );
+
+    }
+
+/*
+    Source - Field value parser
+ */
+
+    int cs_export_json_field( 
+
+        cs_Reader_t * const csReader, 
+        cs_Json_t   * const csJson, 
+        cs_Field_t  * const csField 
+
+    ) {
+
+        /* Token variables */
+        char csToken[CS_JSON_TOKEN] = { 0 };
+
+        /* Character variables */
+        int csChar = cs_export_json_peek( csReader );
+
+        /* Check value type */
+        if ( csChar == '"' ) {
+
+            /* Assign field type */
+            csField->fdType = CS_JSON_STRING;
+
+            /* Import string */
+            return( cs_export_json_text( csReader, csJson, & csField->fdOffset ) );
+
+        } else
+        if ( ( csChar == '{' ) || ( csChar == '[' ) ) {
+
+            /* Assign field type */
+            csField->fdType = CS_JSON_OTHER;
+
+            /* Skip value */
+            return( cs_export_json_skip( csReader ) );
+
+        } else {
+
+            /* Read literal */
+            cs_export_json_token( csReader, csToken );
+
+            /* Assign field type */
+            if ( strcmp( csToken, "null"  ) == 0 ) csField->fdType = CS_JSON_NULL;  else
+            if ( strcmp( csToken, "true"  ) == 0 ) csField->fdType = CS_JSON_TRUE;  else
+            if ( strcmp( csToken, "false" ) == 0 ) csField->fdType = CS_JSON_FALSE; else
+                                                   csField->fdType = CS_JSON_OTHER;
+
+            /* Return status */
+            return( ( csToken[0] != '\0' ) ? LC_TRUE : LC_FALSE );
+
+        }
+
+    }
+
+/*
+    Source - Integer value parser
+ */
+
+    int cs_export_json_integer( 
+
+        cs_Reader_t * const csReader, 
+        long        * const csValue 
+
+    ) {
+
+        /* Token variables */
+        char csToken[CS_JSON_TOKEN] = { 0 };
+
+        /* Character variables */
+        int csChar = cs_export_json_peek( csReader );
+
+        /* Check value type */
+        if ( ( csChar == '-' ) || ( ( csChar >= '0' ) && ( csChar <= '9' ) ) ) {
+
+            /* Read numerical token */
+            cs_export_json_token( csReader, csToken );
+
+            /* Convert numerical token */
+            * csValue = ( long ) strtod( csToken, NULL );
+
+            /* Return success */
+            return( LC_TRUE );
+
+        } else {
+
+            /* Reset value */
+            * csValue = 0;
+
+            /* Skip value */
+            return( cs_export_json_skip( csReader ) );
+
+        }
+
+    }
+
+/*
+    Source - Key parser
+ */
+
+    int cs_export_json_key( 
+
+        cs_Reader_t * const csReader, 
+        char        * const csKey 
+
+    ) {
+
+        /* Key length variables */
+        int csLength = 0;
+
+        /* Character variables */
+        int csChar = 0;
+
+        /* Check and consume key opening */
+        if ( cs_export_json_peek( csReader ) != '"' ) return( LC_FALSE ); else cs_export_json_get( csReader );
+
+        /* Parsing key characters */
+        while ( ( csChar = cs_export_json_get( csReader ) ) != '"' ) {
+
+            /* Check end of stream */
+            if ( csChar == EOF ) return( LC_FALSE );
+
+            /* Consume escaped character */
+            if ( csChar == '\\' ) if ( ( csChar = cs_export_json_get( csReader ) ) == EOF ) return( LC_FALSE );
+
+            /* Store key character */
+            if ( csLength < ( CS_JSON_TOKEN - 1 ) ) csKey[csLength ++] = csChar;
+
+        }
+
+        /* Terminate key */
+        csKey[csLength] = '\0';
+
+        /* Check and consume key separator */
+        return( ( ( cs_export_json_peek( csReader ) == ':' ) && ( cs_export_json_get( csReader ) == ':' ) ) ? LC_TRUE : LC_FALSE );
+
+    }
+
+/*
+    Source - String parser
+ */
+
+    int cs_export_json_text( 
+
+        cs_Reader_t * const csReader, 
+        cs_Json_t   * const csJson, 
+        size_t      * const csOffset 
+
+    ) {
+
+        /* Character variables */
+        int csChar = 0;
+
+        /* Check and consume string opening */
+        if ( cs_export_json_get( csReader ) != '"' ) return( LC_FALSE );
+
+        /* Assign pool offset */
+        if ( csJson != NULL ) * csOffset = csJson->jsPoolSize;
+
+        /* Parsing string characters */
+        while ( ( csChar = cs_export_json_get( csReader ) ) != '"' ) {
+
+            /* Check end of stream */
+            if ( csChar == EOF ) return( LC_FALSE );
+
+            /* Store character */
+            if ( csJson != NULL ) if ( cs_export_json_append( csJson, csChar ) == LC_FALSE ) return( LC_FALSE );
+
+            /* Check escaped character */
+            if ( csChar == '\\' ) {
+
+                /* Consume and check escaped character */
+                if ( ( csChar = cs_export_json_get( csReader ) ) == EOF ) return( LC_FALSE );
+
+                /* Store escaped character */
+                if ( csJson != NULL ) if ( cs_export_json_append( csJson, csChar ) == LC_FALSE ) return( LC_FALSE );
+
+            }
+
+        }
+
+        /* Terminate pool string */
+        return( ( csJson != NULL ) ? cs_export_json_append( csJson, '\0' ) : LC_TRUE );
+
+    }
+
+/*
+    Source - Value skipping
+ */
+
+    int cs_export_json_skip( 
+
+        cs_Reader_t * const csReader 
+
+    ) {
+
+        /* Token variables */
+        char csToken[CS_JSON_TOKEN] = { 0 };
+
+        /* Depth variables */
+        long csDepth = 0;
+
+        /* Character variables */
+        int csChar = cs_export_json_peek( csReader );
+
+        /* Check value type */
+        if ( csChar == '"' ) {
+
+            /* Skip string */
+            return( cs_export_json_text( csReader, NULL, NULL ) );
+
+        } else
+        if ( ( csChar == '{' ) || ( csChar == '[' ) ) {
+
+            /* Skip nested values */
+            do {
+
+                /* Check nested character */
+                if ( ( csChar = cs_export_json_peek( csReader ) ) == EOF ) return( LC_FALSE );
+
+                /* Check nested string */
+                if ( csChar == '"' ) {
+
+                    /* Skip nested string */
+                    if ( cs_export_json_text( csReader, NULL, NULL ) == LC_FALSE ) return( LC_FALSE );
+
+                } else {
+
+                    /* Consume character */
+                    cs_export_json_get( csReader );
+
+                    /* Update depth */
+                    if ( ( csChar == '{' ) || ( csChar == '[' ) ) csDepth ++;
+                    if ( ( csChar == '}' ) || ( csChar == ']' ) ) csDepth --;
+
+                }
+
+            } while ( csDepth > 0 );
+
+            /* Return success */
+            return( LC_TRUE );
+
+        } else {
+
+            /* Skip literal */
+            cs_export_json_token( csReader, csToken );
+
+            /* Return status */
+            return( ( csToken[0] != '\0' ) ? LC_TRUE : LC_FALSE );
+
+        }
+
+    }
+
+/*
+    Source - Token parser
+ */
+
+    void cs_export_json_token( 
+
+        cs_Reader_t * const csReader, 
+        char        * const csToken 
+
+    ) {
+
+        /* Token length variables */
+        int csLength = 0;
+
+        /* Character variables */
+        int csChar = 0;
+
+        /* Skip white spaces */
+        cs_export_json_peek( csReader );
+
+        /* Parsing token characters */
+        while ( cs_export_json_fill( csReader ) == LC_TRUE ) {
+
+            /* Read character */
+            csChar = ( unsigned char ) csReader->rdBlock[csReader->rdHead];
+
+            /* Check token character */
+            if ( ( isalnum( csChar ) == 0 ) && ( csChar != '-' ) && ( csChar != '+' ) && ( csChar != '.' ) ) break;
+
+            /* Store token character */
+            if ( csLength < ( CS_JSON_TOKEN - 1 ) ) csToken[csLength ++] = csChar;
+
+            /* Consume character */
+            csReader->rdHead ++;
+
+        }
+
+        /* Terminate token */
+        csToken[csLength] = '\0';
+
+    }
+
+/*
+    Source - Pool appending
+ */
+
+    int cs_export_json_append( 
+
+        cs_Json_t * const csJson, 
+        int         const csChar 
+
+    ) {
+
+        /* Pool swap variables */
+        char * csSwap = NULL;
+
+        /* Check pool capacity */
+        if ( csJson->jsPoolSize == csJson->jsPoolCapacity ) {
+
+            /* Reallocate and check pool */
+            if ( ( csSwap = ( char * ) realloc( csJson->jsPool, ( csJson->jsPoolCapacity == 0 ) ? 4096 : csJson->jsPoolCapacity << 1 ) ) == NULL ) {
+
+                /* Return failure */
+                return( LC_FALSE );
+
+            }
+
+            /* Assign reallocated pool */
+            csJson->jsPool = csSwap;
+
+            /* Update pool capacity */
+            csJson->jsPoolCapacity = ( csJson->jsPoolCapacity == 0 ) ? 4096 : csJson->jsPoolCapacity << 1;
+
+        }
+
+        /* Append character */
+        csJson->jsPool[csJson->jsPoolSize ++] = csChar;
+
+        /* Return success */
+        return( LC_TRUE );
+
+    }
+
+/*
+    Source - Reader character peek
+ */
+
+    int cs_export_json_peek( 
+
+        cs_Reader_t * const csReader 
+
+    ) {
+
+        /* Character variables */
+        int csChar = 0;
+
+        /* Parsing characters */
+        while ( cs_export_json_fill( csReader ) == LC_TRUE ) {
+
+            /* Read character */
+            csChar = ( unsigned char ) csReader->rdBlock[csReader->rdHead];
+
+            /* Check white space */
+            if ( ( csChar != ' ' ) && ( csChar != '\t' ) && ( csChar != '\n' ) && ( csChar != '\r' ) ) return( csChar );
+
+            /* Consume white space */
+            csReader->rdHead ++;
+
+        }
+
+        /* Return end of stream */
+        return( EOF );
+
+    }
+
+/*
+    Source - Reader character consumption
+ */
+
+    int cs_export_json_get( 
+
+        cs_Reader_t * const csReader 
+
+    ) {
+
+        /* Check and consume character */
+        return( ( cs_export_json_fill( csReader ) == LC_TRUE ) ? ( unsigned char ) csReader->rdBlock[csReader->rdHead ++] : EOF );
+
+    }
+
+/*
+    Source - Reader block filling
+ */
+
+    int cs_export_json_fill( 
+
+        cs_Reader_t * const csReader 
+
+    ) {
+
+        /* Check reading block state */
+        if ( csReader->rdHead == csReader->rdSize ) {
+
+            /* Read next block */
+            csReader->rdSize = fread( csReader->rdBlock, 1, CS_JSON_BLOCK, csReader->rdStream );
+
+            /* Reset block position */
+            csReader->rdHead = 0;
+
+        }
+
+        /* Return availability */
+        return( ( csReader->rdHead < csReader->rdSize ) ? LC_TRUE : LC_FALSE );
+
+    }
+
@@ -0,0 +1,485 @@
+/*
+ * csps-suite - CSPS library front-end suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   csps-export-json.h
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *   
+     *  Previous exportation streaming import
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __CS_EXPORT_JSON__
+    # define __CS_EXPORT_JSON__
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    extern "C" {
+    # endif
+
+/* 
+    Header - Includes
+ */
+
+    # include <stdio.h>
+    # include <stdlib.h>
+    # include <string.h>
+    # include <ctype.h>
+    # include <csps-all.h>
+    # include <common-all.h>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define reading block size */
+    # define CS_JSON_BLOCK  65536
+
+    /* Define token maximum length */
+    # define CS_JSON_TOKEN  64
+
+    /* Define field types */
+    # define CS_JSON_ABSENT 0
+    # define CS_JSON_NULL   1
+    # define CS_JSON_STRING 2
+    # define CS_JSON_TRUE   3
+    # define CS_JSON_FALSE  4
+    # define CS_JSON_OTHER  5
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+    /*! \struct cs_Field_struct
+     *  \brief Imported field
+     *
+     *  This structure holds the value of a field imported from a previous
+     *  exportation file. String values are stored, as written in the file,
+     *  in the strings pool of the imported document.
+     *
+     *  \var cs_Field_struct::fdType
+     *  Field value type
+     *  \var cs_Field_struct::fdOffset
+     *  Offset of the string value in the strings pool
+     */ 
+
+    typedef struct cs_Field_struct {
+
+        int    fdType;
+        size_t fdOffset;
+
+    } cs_Field_t;
+
+    /*! \struct cs_Json_struct
+     *  \brief Imported document
+     *
+     *  This structure holds the fields of a previous exportation file that
+     *  have to be kept by the exportation. Only the document flags and the
+     *  raw field and timestamp of each pose are imported.
+     *
+     *  \var cs_Json_struct::jsSplit
+     *  Document split field
+     *  \var cs_Json_struct::jsPreview
+     *  Document preview field
+     *  \var cs_Json_struct::jsTrash
+     *  Document trash field
+     *  \var cs_Json_struct::jsRaw
+     *  Poses raw field array
+     *  \var cs_Json_struct::jsMaster
+     *  Poses master timestamp array
+     *  \var cs_Json_struct::jsCount
+     *  Poses count
+     *  \var cs_Json_struct::jsCapacity
+     *  Poses arrays capacity
+     *  \var cs_Json_struct::jsPool
+     *  Strings pool
+     *  \var cs_Json_struct::jsPoolSize
+     *  Strings pool size, in bytes
+     *  \var cs_Json_struct::jsPoolCapacity
+     *  Strings pool capacity, in bytes
+     */ 
+
+    typedef struct cs_Json_struct {
+
+        cs_Field_t   jsSplit;
+        cs_Field_t   jsPreview;
+        cs_Field_t   jsTrash;
+        cs_Field_t * jsRaw;
+        lp_Time_t  * jsMaster;
+        long         jsCount;
+        long         jsCapacity;
+        char       * jsPool;
+        size_t       jsPoolSize;
+        size_t       jsPoolCapacity;
+
+    } cs_Json_t;
+
+    /*! \struct cs_Reader_struct
+     *  \brief Streaming reader
+     *
+     *  This structure holds the state of the streaming reading of a JSON file.
+     *
+     *  \var cs_Reader_struct::rdStream
+     *  Input stream
+     *  \var cs_Reader_struct::rdBlock
+     *  Reading block
+     *  \var cs_Reader_struct::rdSize
+     *  Reading block filled size
+     *  \var cs_Reader_struct::rdHead
+     *  Reading block position
+     */ 
+
+    typedef struct cs_Reader_struct {
+
+        FILE   * rdStream;
+        char     rdBlock[CS_JSON_BLOCK];
+        size_t   rdSize;
+        size_t   rdHead;
+
+    } cs_Reader_t;
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Previous exportation import
+     *
+     *  This function reads the provided previous exportation file as a stream
+     *  and imports the fields that have to be kept by the exportation. The
+     *  memory used by the imported document is then proportional to the
+     *  number of poses, and not to the file size.
+     *
+     *  \param csJson Imported document structure
+     *  \param csFile Previous exportation file path
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int cs_export_json_import( 
+
+        cs_Json_t * const csJson, 
+        char      * const csFile 
+
+    );
+
+    /*! \brief Imported document deletion
+     *
+     *  This function releases the memory of the imported document.
+     *
+     *  \param csJson Imported document structure
+     */
+
+    void cs_export_json_delete( 
+
+        cs_Json_t * const csJson 
+
+    );
+
+    /*! \brief Imported string access
+     *
+     *  This function returns the string value of the provided field, as it
+     *  was written in the previous exportation file.
+     *
+     *  \param csJson  Imported document structure
+     *  \param csField Imported field
+     *
+     *  \return Returns string value
+     */
+
+    char const * cs_export_json_string( 
+
+        cs_Json_t  const * const csJson, 
+        cs_Field_t const * const csField 
+
+    );
+
+    /*! \brief Document parser
+     *
+     *  This function parses the main object of the document and imports its
+     *  flags fields and its poses array.
+     *
+     *  \param csReader Streaming reader
+     *  \param csJson   Imported document structure
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE on syntax error
+     */
+
+    int cs_export_json_document( 
+
+        cs_Reader_t * const csReader, 
+        cs_Json_t   * const csJson 
+
+    );
+
+    /*! \brief Poses array parser
+     *
+     *  This function parses the poses array of the document and imports the
+     *  raw field and the timestamp of each pose.
+     *
+     *  \param csReader Streaming reader
+     *  \param csJson   Imported document structure
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE on syntax error
+     */
+
+    int cs_export_json_poses( 
+
+        cs_Reader_t * const csReader, 
+        cs_Json_t   * const csJson 
+
+    );
+
+    /*! \brief Pose object parser
+     *
+     *  This function parses a pose object of the poses array and appends its
+     *  raw field and timestamp to the document poses arrays.
+     *
+     *  \param csReader Streaming reader
+     *  \param csJson   Imported document structure
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE on syntax error
+     */
+
+    int cs_export_json_pose( 
+
+        cs_Reader_t * const csReader, 
+        cs_Json_t   * const csJson 
+
+    );
+
+    /*! \brief Field value parser
+     *
+     *  This function parses a value and imports it in the provided field. The
+     *  values that are not null, boolean or string are skipped.
+     *
+     *  \param csReader Streaming reader
+     *  \param csJson   Imported document structure
+     *  \param csField  Imported field
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE on syntax error
+     */
+
+    int cs_export_json_field( 
+
+        cs_Reader_t * const csReader, 
+        cs_Json_t   * const csJson, 
+        cs_Field_t  * const csField 
+
+    );
+
+    /*! \brief Integer value parser
+     *
+     *  This function parses a numerical value and returns its integral part.
+     *  The values that are not numerical are skipped and read as zero.
+     *
+     *  \param csReader Streaming reader
+     *  \param csValue  Pointer to the variable that recieves the value
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE on syntax error
+     */
+
+    int cs_export_json_integer( 
+
+        cs_Reader_t * const csReader, 
+        long        * const csValue 
+
+    );
+
+    /*! \brief Key parser
+     *
+     *  This function parses an object key and its following colon. Keys longer
+     *  than the provided token are truncated.
+     *
+     *  \param csReader Streaming reader
+     *  \param csKey    Token receiving the key, CS_JSON_TOKEN bytes long
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE on syntax error
+     */
+
+    int cs_export_json_key( 
+
+        cs_Reader_t * const csReader, 
+        char        * const csKey 
+
+    );
+
+    /*! \brief String parser
+     *
+     *  This function parses a string, the reader being on its opening quote.
+     *  If a document is provided, the string content is appended, as written
+     *  in the file, to the document strings pool.
+     *
+     *  \param csReader Streaming reader
+     *  \param csJson   Imported document structure, NULL to skip the string
+     *  \param csOffset Pointer to the variable that recieves the pool offset
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE on syntax error
+     */
+
+    int cs_export_json_text( 
+
+        cs_Reader_t * const csReader, 
+        cs_Json_t   * const csJson, 
+        size_t      * const csOffset 
+
+    );
+
+    /*! \brief Value skipping
+     *
+     *  This function skips the value on which the reader is, whatever its
+     *  type and depth.
+     *
+     *  \param csReader Streaming reader
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE on syntax error
+     */
+
+    int cs_export_json_skip( 
+
+        cs_Reader_t * const csReader 
+
+    );
+
+    /*! \brief Token parser
+     *
+     *  This function reads the literal or numerical token on which the reader
+     *  is. Tokens longer than the provided token are truncated.
+     *
+     *  \param csReader Streaming reader
+     *  \param csToken  Token receiving the literal, CS_JSON_TOKEN bytes long
+     */
+
+    void cs_export_json_token( 
+
+        cs_Reader_t * const csReader, 
+        char        * const csToken 
+
+    );
+
+    /*! \brief Pool appending
+     *
+     *  This function appends a character to the strings pool of the document.
+     *
+     *  \param csJson Imported document structure
+     *  \param csChar Appended character
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int cs_export_json_append( 
+
+        cs_Json_t * const csJson, 
+        int         const csChar 
+
+    );
+
+    /*! \brief Reader character peek
+     *
+     *  This function skips the white spaces and returns the character on which
+     *  the reader is, without consuming it.
+     *
+     *  \param csReader Streaming reader
+     *
+     *  \return Returns character, EOF at end of stream
+     */
+
+    int cs_export_json_peek( 
+
+        cs_Reader_t * const csReader 
+
+    );
+
+    /*! \brief Reader character consumption
+     *
+     *  This function consumes and returns the character on which the reader
+     *  is, white spaces included.
+     *
+     *  \param csReader Streaming reader
+     *
+     *  \return Returns character, EOF at end of stream
+     */
+
+    int cs_export_json_get( 
+
+        cs_Reader_t * const csReader 
+
+    );
+
+    /*! \brief Reader block filling
+     *
+     *  This function reads the next block of the input stream when the current
+     *  one is entirely consumed.
+     *
+     *  \param csReader Streaming reader
+     *
+     *  \return Returns LC_TRUE if characters are available, LC_FALSE otherwise
+     */
+
+    int cs_export_json_fill( 
+
+        cs_Reader_t * const csReader 
+
+    );
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    }
+    # endif
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
@@ -50,39 +50,53 @@
     int main ( int argc, char ** argv ) {
 
         /* Structure path variables */
-        char csPath[256] = { 0 };
         char csFile[256] = { 0 };
-        char csCAMd[256] = { 0 };
-        char csCAMm[256] = { 0 };
-        char csGPSd[256] = { 0 };
-        char csGPSm[256] = { 0 };
-        char csIMUd[256] = { 0 };
-        char csIMUm[256] = { 0 };
-        char csSTLd[256] = { 0 };
-        char csSTLm[256] = { 0 };
         char csGPSf[256] = { 0 };
 
+        /* Devices variables */
+        cs_Device_t csDevice;
+
+        /* Legacy formatting variables */
+        int csLegacy = LC_FALSE;
+
+        /* Threads count variables */
+        int csThreads = 0;
+
+        /* Exportation format variables */
+        char csFormat[256] = { 0 };
+
+        /* Exportation formats flags variables */
+        int csFlags = 0;
+
+        /* Incremental exportation variables */
+        int csIncrement = LC_FALSE;
+
+        /* Last exportation variables */
+        cs_Last_t csLast;
+
         /* Query variables */
-        lp_Trigger_t  csTrigger;
-        lp_Position_t csPosition;
-        lp_Orient_t   csOrient;
-        lp_Still_t    csStill;
+        cs_Query_t csQuery;
+
+        /* Previous exportation variables */
+        cs_Json_t csJson;
 
-        /* Object variables */
-        cs_Object_t * csJson = NULL;
+        /* Initialize devices */
+        memset( & csDevice, 0, sizeof( cs_Device_t ) );
 
         /* Search in parameters */
-        lc_stdp( lc_stda( argc, argv, "--path"     ,"-p" ), argv, csPath, LC_STRING );
-        lc_stdp( lc_stda( argc, argv, "--export"   ,"-e" ), argv, csFile, LC_STRING );
-        lc_stdp( lc_stda( argc, argv, "--cam-tag"  ,"-c" ), argv, csCAMd, LC_STRING );
-        lc_stdp( lc_stda( argc, argv, "--cam-mod"  ,"-m" ), argv, csCAMm, LC_STRING );
-        lc_stdp( lc_stda( argc, argv, "--gps-tag"  ,"-g" ), argv, csGPSd, LC_STRING );
-        lc_stdp( lc_stda( argc, argv, "--gps-mod"  ,"-n" ), argv, csGPSm, LC_STRING );
-        lc_stdp( lc_stda( argc, argv, "--imu-tag"  ,"-i" ), argv, csIMUd, LC_STRING );
-        lc_stdp( lc_stda( argc, argv, "--imu-mod"  ,"-s" ), argv, csIMUm, LC_STRING );
-        lc_stdp( lc_stda( argc, argv, "--still-tag","-t" ), argv, csSTLd, LC_STRING );
-        lc_stdp( lc_stda( argc, argv, "--still-mod","-k" ), argv, csSTLm, LC_STRING );
-        lc_stdp( lc_stda( argc, argv, "--forced"   ,"-f" ), argv, csGPSf, LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--path"     ,"-p" ), argv, csDevice.dvPath, LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--export"   ,"-e" ), argv, csFile         , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--cam-tag"  ,"-c" ), argv, csDevice.dvCAMd, LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--cam-mod"  ,"-m" ), argv, csDevice.dvCAMm, LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--gps-tag"  ,"-g" ), argv, csDevice.dvGPSd, LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--gps-mod"  ,"-n" ), argv, csDevice.dvGPSm, LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--imu-tag"  ,"-i" ), argv, csDevice.dvIMUd, LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--imu-mod"  ,"-s" ), argv, csDevice.dvIMUm, LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--still-tag","-t" ), argv, csDevice.dvSTLd, LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--still-mod","-k" ), argv, csDevice.dvSTLm, LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--forced"   ,"-f" ), argv, csGPSf         , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--threads"  ,"-j" ), argv, & csThreads    , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--format"   ,"-o" ), argv, csFormat       , LC_STRING );
 
         /* Execution switch */
         if ( lc_stda( argc, argv, "--help", "-h" ) || ( argc <= 1 ) ) {
@@ -96,29 +110,64 @@
             /* File exportation */
             cs_export_template( csGPSf, csFile );
 
+        } else
+        if ( ( csFlags = cs_export_get_format( csFormat ) ) == 0 ) {
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : unknown exportation format %s\n", csFormat );
+
         } else {
 
-            /* Create query structure */
-            csTrigger = lp_query_trigger_create( csPath, csCAMd, csCAMm );
+            /* Check legacy formatting */
+            if ( lc_stda( argc, argv, "--legacy", "-x" ) ) csLegacy = LC_TRUE;
+
+            /* Check incremental exportation */
+            if ( lc_stda( argc, argv, "--incremental", "-r" ) ) csIncrement = LC_TRUE;
+
+            /* Check incremental exportation format */
+            if ( ( csIncrement == LC_TRUE ) && ( csFlags != CS_FORMAT_JSON ) ) {
+
+                /* Display message */
+                fprintf( LC_ERR, "Error : incremental exportation only available for JSON format alone\n" );
 
-            /* Verify query structures */
-            if ( lp_query_trigger_state( & csTrigger ) == LP_FALSE ) {
+            } else
+            if ( cs_export_query_create( & csQuery, & csDevice, LC_TRUE ) == LC_FALSE ) {
 
                 /* Display message */
                 fprintf( LC_ERR, "Error : unable to create query structure on camera trigger\n" );
 
             } else {
 
-                /* Create query structure */
-                csPosition = lp_query_position_create   ( csPath, csGPSd, csGPSm );
-                csOrient   = lp_query_orientation_create( csPath, csIMUd, csIMUm );
-                csStill    = lp_query_still_create      ( csPath, csSTLd, csSTLm );
+                /* Check exportation formats */
+                if ( csFlags != CS_FORMAT_JSON ) {
+
+                    /* Files exportation */
+                    cs_export_formats( & csQuery, & csDevice, csGPSf, csFile, csFlags, csLegacy, csThreads );
+
+                } else
+                if ( ( csIncrement == LC_TRUE ) && ( cs_export_get_last( & csQuery, csGPSf, csFile, csLegacy, & csLast ) == LC_TRUE ) ) {
+
+                    /* Check new triggers availability */
+                    if ( csLast.lsCount >= csQuery.qySize ) {
+
+                        /* Display message */
+                        fprintf( LC_OUT, "%s JSON file is up to date\n", basename( csFile ) );
+
+                    } else {
+
+                        /* Display message */
+                        fprintf( LC_OUT, "Appending to %s JSON file ...\n", basename( csFile ) );
+
+                        /* File exportation */
+                        cs_export( & csQuery, & csDevice, csGPSf, csFile, NULL, csLegacy, csThreads, & csLast );
+
+                    }
 
-                /* Check previous file existence */
+                } else
                 if ( lc_file_detect( csFile, LC_FILE ) == LC_TRUE ) {
 
-                    /* Create master object */
-                    if ( ( csJson = json_object_from_file( csFile ) ) == NULL ) {
+                    /* Import previous exportation */
+                    if ( cs_export_json_import( & csJson, csFile ) == LC_FALSE ) {
 
                         /* Display message */
                         fprintf( LC_ERR, "Error : unable to import %s file content\n", basename( csFile ) );
@@ -129,10 +178,10 @@
                         fprintf( LC_OUT, "Updating %s JSON file ...\n", basename( csFile ) );
 
                         /* File exportation */
-                        cs_export( & csTrigger, & csPosition, & csOrient, & csStill, csGPSf, csFile, csJson );
+                        cs_export( & csQuery, & csDevice, csGPSf, csFile, & csJson, csLegacy, csThreads, ( csIncrement == LC_TRUE ) ? & csLast : NULL );
 
-                        /* Delete master object */
-                        json_object_put( csJson );
+                        /* Delete previous exportation */
+                        cs_export_json_delete( & csJson );
 
                     }
 
@@ -142,15 +191,12 @@
                     fprintf( LC_OUT, "Creating %s JSON file ...\n", basename( csFile ) );
 
                     /* File exportation */
-                    cs_export( & csTrigger, & csPosition, & csOrient, & csStill, csGPSf, csFile, NULL );
+                    cs_export( & csQuery, & csDevice, csGPSf, csFile, NULL, csLegacy, csThreads, ( csIncrement == LC_TRUE ) ? & csLast : NULL );
 
                 }
 
-                /* Delete query structure */
-                lp_query_still_delete      ( & csStill    );
-                lp_query_orientation_delete( & csOrient   );
-                lp_query_position_delete   ( & csPosition );
-                lp_query_trigger_delete    ( & csTrigger  );
+                /* Delete query structures */
+                cs_export_query_delete( & csQuery );
 
             }
 
@@ -167,22 +213,36 @@
 
     void cs_export( 
 
-        lp_Trigger_t  * const csTrigger, 
-        lp_Position_t * const csPosition, 
-        lp_Orient_t   * const csOrient,
-        lp_Still_t    * const csStill,
-        char          * const csGPSf,
-        char          * const csFile,
-        cs_Object_t   * const csJson
+        cs_Query_t        * const csQuery,
+        cs_Device_t const * const csDevice,
+        char              * const csGPSf,
+        char              * const csFile,
+        cs_Json_t         * const csJson,
+        int                 const csLegacy,
+        int                 const csThreads,
+        cs_Last_t         * const csLast
 
     ) {
 
         /* Camera stream size variables */
         long csSize  = 0;
 
+        /* First exported trigger variables */
+        long csFirst = 0;
+
         /* Parsing variables */
         long csParse = 0;
 
+        /* Chunks variables */
+        long csBase  = 0;
+        long csStart = 0;
+        long csStop  = 0;
+
+        /* Threads variables */
+        int csCount  = 1;
+        int csTeam   = 1;
+        int csThread = 0;
+
         /* GPS availability variables */
         long csSignal = LC_FALSE;
 
@@ -190,380 +250,1679 @@
         long csForced = LC_FALSE;
 
         /* GPS forced position variables */
-        double csGPSflon = 0.0;
-        double csGPSflat = 0.0;
-        double csGPSfalt = 0.0;
+        double csGPSfpos[3] = { 0.0 };
 
         /* Stream variables */
         FILE * csStream = NULL;
 
-        /* Object variables */
-        cs_Object_t * csArray = NULL;
-        cs_Object_t * csPose  = NULL;
+        /* Temporary file path variables */
+        char csTemp[512] = { 0 };
+
+        /* Buffer variables */
+        cs_Buffer_t csBuffer;
+
+        /* Threads buffers variables */
+        cs_Buffer_t * csLocal = NULL;
+
+        /* Threads queries variables */
+        cs_Query_t * csQueries = NULL;
+
+        /* Index variables */
+        cs_Index_t csIndex;
+
+        /* Pose variables */
+        cs_Pose_t csPose;
+
+        /* Compute threads count */
+        # ifdef __OPENMP__
+        csCount = ( csThreads > 0 ) ? csThreads : omp_get_max_threads();
+        # endif
+
+        /* Trigger count query */
+        csSize = csQuery->qySize;
+
+        /* Retrieve first exported trigger */
+        if ( csLast != NULL ) csFirst = csLast->lsCount;
+
+        /* Check new triggers availability */
+        if ( ( csFirst > 0 ) && ( csFirst >= csSize ) ) return;
 
         /* Create stream */
-        if ( ( csStream = fopen( csFile, "w" ) ) == NULL ) {
+        if ( ( csStream = lc_file_atomic_open( csFile, csTemp ) ) == NULL ) {
 
             /* Display message */
             fprintf( LC_ERR, "Error : unable to access %s\n", basename( csFile ) );
 
         } else {
 
-            /* Check if GPS position are forced */
-            if ( strlen( csGPSf ) > 0 ) {
-
-                /* Update flag */
-                csForced = LC_TRUE;
+            /* Copy previous content up to the last pose ending */
+            if ( ( csFirst > 0 ) && ( lc_file_range( csFile, csTemp, 0, csLast->lsOffset - 1 ) != ( csLast->lsOffset - 1 ) ) ) {
 
-                /* Analyse forced position */
-                sscanf( csGPSf, "%lf,%lf,%lf", & csGPSflon, & csGPSflat, & csGPSfalt );
+                /* Display message */
+                fprintf( LC_ERR, "Error : unable to copy %s content\n", basename( csFile ) );
 
-            }
+                /* Discard output stream */
+                lc_file_atomic_close( csStream, csTemp, csFile, LC_FALSE );
 
-            /* Trigger count query */
-            csSize = lp_query_trigger_size( csTrigger );
+                /* Abort exportation */
+                return;
 
-            /* Create pose array object */
-            csArray = json_object_object_get( csJson, "pose" );
+            }
 
-            /* Export format */
-            fprintf( csStream, "{\n" );
+            /* Create previous poses index */
+            if ( cs_export_set_index( csJson, & csIndex ) == LC_FALSE ) {
 
-            /* Export to stream */
-            cs_export_field( "split"  , "false", ",", csStream, csJson );
-            cs_export_field( "preview", "false", ",", csStream, csJson );
-            cs_export_field( "trash"  , "false", ",", csStream, csJson );
-            cs_export_field( "pose"   , ""     , "" , csStream, NULL   );
+                /* Discard output stream */
+                lc_file_atomic_close( csStream, csTemp, csFile, LC_FALSE );
 
-            /* Export format */
-            fprintf( csStream, "[\n" );
-            
-            /* Exportation loop */
-            for ( csParse = 0; csParse < csSize; csParse ++ ) {
+                /* Abort exportation */
+                return;
 
-                /* Query trigger by index */
-                lp_query_trigger_byindex( csTrigger, csParse );
+            }
 
-                /* Query position */
-                lp_query_position( csPosition, csTrigger->qrSynch );
+            /* Create exportation buffer */
+            if ( cs_export_buffer_create( & csBuffer, csStream, csLegacy ) == LC_FALSE ) {
 
-                /* Query orientation */
-                lp_query_orientation( csOrient, csTrigger->qrSynch );
+                /* Delete previous poses index */
+                cs_export_index_delete( & csIndex );
 
-                /* Query still range */
-                lp_query_still( csStill, csTrigger->qrSynch );
+                /* Discard output stream */
+                lc_file_atomic_close( csStream, csTemp, csFile, LC_FALSE );
 
-                /* Search for previous pose */
-                csPose = cs_export_get_pose( csArray, csTrigger->qrMaster );
+                /* Abort exportation */
+                return;
 
-                /* Export format */
-                fprintf( csStream, "{\n" );
+            }
 
-                /* Export to stream */
-                cs_export_field( "still", ( csStill->qrStill == LP_TRUE ) ? "true" : "false", ",", csStream, NULL );
-                cs_export_field( "raw", "\"unknown\"", ",", csStream, csPose );
+            /* Create threads queries and buffers */
+            csCount = cs_export_set_threads( csQuery, csDevice, csLegacy, csCount, & csQueries, & csLocal );
 
-                /* Export to stream */
-                fprintf( csStream, "\"sec\":%"  lp_Time_p ",\n", lp_timestamp_sec ( csTrigger->qrMaster ) );
-                fprintf( csStream, "\"usec\":%" lp_Time_p ",\n", lp_timestamp_usec( csTrigger->qrMaster ) );
+            /* Analyse forced position */
+            csForced = cs_export_get_forced( csGPSf, csGPSfpos );
 
-                /* Check forced position */
-                if ( csForced == LC_TRUE ) {
+            /* Check exportation mode */
+            if ( csFirst > 0 ) {
 
-                    /* Update GPS availability */
-                    csSignal = LC_TRUE;
+                /* Move stream after copied content */
+                fseek( csStream, 0, SEEK_END );
 
-                    /* Export to stream */
-                    cs_export_field( "position", "", "", csStream, NULL );
+                /* Update buffer position */
+                csBuffer.bfOffset = csLast->lsOffset - 1;
 
-                    /* Export format */
-                    fprintf( csStream, "[\n" ); 
+                /* Restore GPS availability */
+                csSignal = csLast->lsSignal;
 
-                    /* Export to stream */
-                    fprintf( csStream, "%.16e,\n", csGPSflon );
-                    fprintf( csStream, "%.16e,\n", csGPSflat );
-                    fprintf( csStream, "%.16e,\n", csGPSfalt );
-                    fprintf( csStream, "%.16e \n", 0.0       );
+                /* Export poses separator */
+                cs_export_buffer_string( & csBuffer, ",\n" );
 
-                    /* Export format */
-                    fprintf( csStream, "],\n" );
+            } else {
 
-                } else {
+                /* Export JSON head */
+                cs_export_head_json( & csBuffer, csJson );
 
-                    /* Check position availability */
-                    if ( lp_query_position_status( csPosition ) == LP_FALSE ) {
+            }
 
-                        /* Export to stream */
-                        cs_export_field( "position", "null", ",", csStream, NULL );
+            /* Exportation loop */
+            # ifdef __OPENMP__
+            # pragma omp parallel num_threads( csCount ) private( csThread, csBase, csStart, csStop, csParse, csPose ) reduction( | : csSignal )
+            # endif
+            {
 
-                    } else {
+                /* Retrieve thread index */
+                # ifdef __OPENMP__
+                csThread = omp_get_thread_num();
+                # endif
 
-                        /* Exception management */
-                        if ( 
+                /* Retrieve started threads count */
+                # ifdef __OPENMP__
+                # pragma omp single
+                csTeam = omp_get_num_threads();
+                # endif
 
-                            ( isnormal( csPosition->qrAltitude  ) == 0 ) || 
-                            ( isnormal( csPosition->qrLongitude ) == 0 ) || 
-                            ( isnormal( csPosition->qrLatitude  ) == 0 ) 
+                /* Parsing chunks rounds */
+                for ( csBase = csFirst; csBase < csSize; csBase += csTeam * CS_EXPORT_CHUNK ) {
 
-                        ) {
+                    /* Compute thread chunk range */
+                    csStart = csBase  + csThread * CS_EXPORT_CHUNK;
+                    csStop  = csStart + CS_EXPORT_CHUNK;
 
-                            /* Export to stream */
-                            cs_export_field( "position", "null", ",", csStream, NULL );
+                    /* Clamp thread chunk range */
+                    if ( csStop > csSize ) csStop = csSize;
 
-                        } else {
+                    /* Parsing thread chunk */
+                    for ( csParse = csStart; csParse < csStop; csParse ++ ) {
 
-                            /* Update GPS availability */
-                            csSignal = LC_TRUE;
+                        /* Query pose */
+                        cs_export_query( csQueries + csThread, csParse, ( csForced == LC_TRUE ) ? csGPSfpos : NULL, & csPose );
 
-                            /* Export to stream */
-                            cs_export_field( "position", "", "", csStream, NULL );
+                        /* Update GPS availability */
+                        if ( csPose.psLocated == LC_TRUE ) csSignal = LC_TRUE;
 
-                            /* Export format */
-                            fprintf( csStream, "[\n" ); 
+                        /* Export pose */
+                        cs_export_pose_json( csLocal + csThread, & csPose, csJson, cs_export_get_pose( csJson, & csIndex, csPose.psMaster ), csParse == ( csSize - 1 ) );
 
-                            /* Export to stream */
-                            fprintf( csStream, "%.16e,\n", csPosition->qrAltitude  );
-                            fprintf( csStream, "%.16e,\n", csPosition->qrLongitude );
-                            fprintf( csStream, "%.16e,\n", csPosition->qrLatitude  );
-                            fprintf( csStream, "%.16e \n", csPosition->qrWeak      );
+                    }
 
-                            /* Export format */
-                            fprintf( csStream, "],\n" );
+                    /* Wait chunks completion */
+                    # ifdef __OPENMP__
+                    # pragma omp barrier
+                    # pragma omp single
+                    # endif
+                    {
 
-                        }
+                        /* Concatenate chunks in order */
+                        for ( csParse = 0; csParse < csTeam; csParse ++ ) cs_export_buffer_append( & csBuffer, csLocal + csParse );
 
                     }
 
                 }
 
-                /* Check orientation availability */
-                if ( lp_query_orientation_status( csOrient ) == LP_FALSE ) {
+            }
+
+            /* Check last exportation tracking */
+            if ( csLast != NULL ) {
 
-                    /* Export to stream */
-                    cs_export_field( "orientation", "null", "", csStream, NULL );
+                /* Memorize poses array ending */
+                csLast->lsOffset = cs_export_buffer_tell( & csBuffer );
 
-                } else {
+                /* Memorize exported triggers count */
+                csLast->lsCount = csSize;
 
-                    /* Exception management */
-                    if ( 
+                /* Memorize GPS availability and formatting */
+                csLast->lsSignal = ( csSignal == LC_TRUE ) ? LC_TRUE : LC_FALSE;
+                csLast->lsForced = csForced;
+                csLast->lsLegacy = csLegacy;
 
-                         ( isnormal( csOrient->qrfxx ) == 0 ) ||
-                         ( isnormal( csOrient->qrfxy ) == 0 ) ||
-                         ( isnormal( csOrient->qrfxz ) == 0 ) ||
-                         ( isnormal( csOrient->qrfyx ) == 0 ) ||
-                         ( isnormal( csOrient->qrfyy ) == 0 ) ||
-                         ( isnormal( csOrient->qrfyz ) == 0 ) ||
-                         ( isnormal( csOrient->qrfzx ) == 0 ) ||
-                         ( isnormal( csOrient->qrfzy ) == 0 ) ||
-                         ( isnormal( csOrient->qrfzz ) == 0 ) 
+            }
 
-                    ) {
+            /* Export JSON tail */
+            cs_export_tail_json( & csBuffer, csForced, csSignal );
 
-                        /* Export to stream */
-                        cs_export_field( "orientation", "null", "", csStream, NULL );
+            /* Delete threads queries and buffers */
+            cs_export_set_threads( csQuery, csDevice, csLegacy, -csCount, & csQueries, & csLocal );
 
-                    } else {
+            /* Export pose cache if all the triggers have been queried */
+            if ( csFirst == 0 ) cs_export_query_commit( csQuery, csDevice );
 
-                        /* Export to stream */
-                        cs_export_field( "orientation", "", "", csStream, NULL );
+            /* Delete exportation buffer */
+            cs_export_buffer_delete( & csBuffer );
 
-                        /* Export format */
-                        fprintf( csStream, "[\n" );
+            /* Delete previous poses index */
+            cs_export_index_delete( & csIndex );
 
-                        /* Export to stream */
-                        fprintf( csStream, "%.16e,\n", csOrient->qrfxx  );
-                        fprintf( csStream, "%.16e,\n", csOrient->qrfxy  );
-                        fprintf( csStream, "%.16e,\n", csOrient->qrfxz  );
-                        fprintf( csStream, "%.16e,\n", csOrient->qrfyx  );
-                        fprintf( csStream, "%.16e,\n", csOrient->qrfyy  );
-                        fprintf( csStream, "%.16e,\n", csOrient->qrfyz  );
-                        fprintf( csStream, "%.16e,\n", csOrient->qrfzx  );
-                        fprintf( csStream, "%.16e,\n", csOrient->qrfzy  );
-                        fprintf( csStream, "%.16e,\n", csOrient->qrfzz  );
-                        fprintf( csStream, "%.16e \n", csOrient->qrWeak );
+            /* Commit output stream */
+            if ( lc_file_atomic_close( csStream, csTemp, csFile, LC_TRUE ) == LC_FALSE ) {
 
-                        /* Export format */
-                        fprintf( csStream, "]\n" );
+                /* Display message */
+                fprintf( LC_ERR, "Error : unable to write %s\n", basename( csFile ) );
 
-                    }
+            } else if ( ( csLast != NULL ) && ( csSize > 0 ) ) {
 
-                }
+                /* Memorize last trigger timestamp */
+                csLast->lsMaster = cs_export_query_master( csQuery, csSize - 1 );
+
+                /* Memorize exportation file size */
+                csLast->lsSize = lc_file_size( csFile );
 
-                /* Export format */
-                fprintf( csStream, "}%s\n", ( csParse < ( csSize - 1 ) ) ? "," : "" );
+                /* Export last exportation record */
+                cs_export_set_last( csFile, csLast );
 
             }
 
-            /* Export format */
-            fprintf( csStream, "],\n" );
+        }
 
-            /* Export to stream */
-            cs_export_field( "single", ( csForced == LC_TRUE ) ? "true" : "false", ",", csStream, NULL );
-            cs_export_field( "gps"   , ( csSignal == LC_TRUE ) ? "true" : "false", "" , csStream, NULL );
+    }
 
-            /* Export format */
-            fprintf( csStream, "}\n" );
+/*
+    Source - Last exportation analysis
+ */
+
+    int cs_export_get_last(
+
+        cs_Query_t  * const csQuery,
+        char  const * const csGPSf,
+        char  const * const csFile,
+        int           const csLegacy,
+        cs_Last_t   * const csLast
+
+    ) {
+
+        /* Record path variables */
+        char csPath[512] = { 0 };
+
+        /* Record header variables */
+        char csMagic[32] = { 0 };
+
+        /* Record fields variables */
+        unsigned long long csMaster = 0;
+        unsigned long long csOffset = 0;
+        unsigned long long csSize   = 0;
+
+        /* Bytes variables */
+        char csByte[3] = { 0 };
+
+        /* Stream variables */
+        FILE * csStream = NULL;
+
+        /* Reset last exportation */
+        memset( csLast, 0, sizeof( cs_Last_t ) );
+
+        /* Compose record path */
+        sprintf( csPath, "%s" CS_LAST_SUFFIX, csFile );
+
+        /* Create and check record stream */
+        if ( ( csStream = fopen( csPath, "r" ) ) == NULL ) return( LC_FALSE );
+
+        /* Import and check record */
+        if ( fscanf( csStream, "%31s %ld %llu %llu %llu %d %d %d", csMagic, & csLast->lsCount, & csMaster, & csOffset, & csSize, & csLast->lsSignal, & csLast->lsForced, & csLast->lsLegacy ) != 8 ) csMagic[0] = '\0';
+
+        /* Close record stream */
+        fclose( csStream );
+
+        /* Assign record fields */
+        csLast->lsMaster = csMaster;
+        csLast->lsOffset = csOffset;
+        csLast->lsSize   = csSize;
+
+        /* Check record validity and exportation options */
+        if (
+
+            ( strcmp( csMagic, CS_LAST_MAGIC ) != 0 ) ||
+            ( csLast->lsCount <= 0 ) ||
+            ( csLast->lsOffset < 2 ) ||
+            ( csLast->lsForced != LC_FALSE ) ||
+            ( strlen( csGPSf ) > 0 ) ||
+            ( csLast->lsLegacy != csLegacy ) ||
+            ( csLast->lsSize != lc_file_size( csFile ) ) ||
+            ( csLast->lsCount > csQuery->qySize )
 
-            /* Close output stream */
-            fclose( csStream );
+        ) {
+
+            /* Reset last exportation */
+            csLast->lsCount = 0;
+
+            /* Return failure */
+            return( LC_FALSE );
+
+        }
+
+        /* Check last exported trigger timestamp */
+        if ( cs_export_query_master( csQuery, csLast->lsCount - 1 ) != csLast->lsMaster ) {
+
+            /* Reset last exportation */
+            csLast->lsCount = 0;
+
+            /* Return failure */
+            return( LC_FALSE );
+
+        }
+
+        /* Create and check exportation stream */
+        if ( ( csStream = fopen( csFile, "rb" ) ) == NULL ) {
+
+            /* Reset last exportation */
+            csLast->lsCount = 0;
+
+            /* Return failure */
+            return( LC_FALSE );
 
         }
 
+        /* Import bytes around poses array ending */
+        fseek( csStream, csLast->lsOffset - 2, SEEK_SET );
+
+        /* Check poses array ending */
+        if ( ( fread( csByte, 1, 3, csStream ) != 3 ) || ( memcmp( csByte, "}\n]", 3 ) != 0 ) ) csLast->lsCount = 0;
+
+        /* Close exportation stream */
+        fclose( csStream );
+
+        /* Return last exportation state */
+        return( ( csLast->lsCount > 0 ) ? LC_TRUE : LC_FALSE );
+
     }
 
 /*
-    Source - Template creation function
+    Source - Last exportation record
  */
 
-    void cs_export_template( 
+    void cs_export_set_last(
 
-        char * const csGPSf,
-        char * const csFile 
+        char      const * const csFile,
+        cs_Last_t const * const csLast
 
     ) {
 
+        /* Record path variables */
+        char csPath[512] = { 0 };
+
+        /* Temporary file path variables */
+        char csTemp[528] = { 0 };
+
         /* Stream variables */
         FILE * csStream = NULL;
 
-        /* Create and check output stream */
-        if ( ( csStream = fopen( csFile, "w" ) ) == NULL ) {
+        /* Compose record path */
+        sprintf( csPath, "%s" CS_LAST_SUFFIX, csFile );
+
+        /* Create and check record stream */
+        if ( ( csStream = lc_file_atomic_open( csPath, csTemp ) ) == NULL ) {
 
             /* Display message */
-            fprintf( LC_ERR, "Error : unable to write %s\n", basename( csFile ) );
+            fprintf( LC_ERR, "Error : unable to access %s\n", basename( csPath ) );
 
         } else {
 
-            /* Export header */
-            fprintf( csStream, "{\n\"split\":true,\n\"preview\":false,\n\"trash\":false,\n\"pose\":[\n{\n" );
+            /* Export record */
+            fprintf( csStream, "%s %ld %llu %llu %llu %d %d %d\n", CS_LAST_MAGIC, csLast->lsCount,
 
-            /* Export template pose */
-            fprintf( csStream, "\"raw\":\"unknown\",\n\"still\":true,\n\"sec\":null,\n\"usec\":null,\n\"orientation\":null,\n\"position\":" );
+                ( unsigned long long ) csLast->lsMaster,
+                ( unsigned long long ) csLast->lsOffset,
+                ( unsigned long long ) csLast->lsSize,
+                csLast->lsSignal,
+                csLast->lsForced,
+                csLast->lsLegacy
 
-            /* Export GPS position */
-            if ( strlen( csGPSf ) > 0 ) {
+            );
 
-                /* Export forced position */
-                fprintf( csStream, "[%s,0.0]", csGPSf );
+            /* Commit record stream */
+            if ( lc_file_atomic_close( csStream, csTemp, csPath, LC_TRUE ) == LC_FALSE ) {
+
+                /* Display message */
+                fprintf( LC_ERR, "Error : unable to write %s\n", basename( csPath ) );
+
+            }
+
+        }
+
+    }
+
+/*
+    Source - Threads resources management
+ */
+
+    int cs_export_set_threads(
+
+        cs_Query_t        *  const csQuery,
+        cs_Device_t const *  const csDevice,
+        int                  const csLegacy,
+        int                  const csCount,
+        cs_Query_t        ** const csQueries,
+        cs_Buffer_t       ** const csLocal
+
+    ) {
+
+        /* Parsing variables */
+        int csParse = 0;
+
+        /* Created resources variables */
+        int csCreated = 0;
+
+        /* Check mode */
+        if ( csCount < 0 ) {
+
+            /* Parsing threads resources */
+            for ( csParse = 0; csParse < -csCount; csParse ++ ) {
+
+                /* Check thread query structures */
+                if ( ( csParse > 0 ) && ( csQuery->qyCache.caPose == NULL ) ) {
+
+                    /* Release shared pose records from thread */
+                    ( * csQueries )[csParse].qyStore = NULL;
+
+                    /* Delete thread query structures */
+                    cs_export_query_delete( ( * csQueries ) + csParse );
+
+                }
+
+                /* Delete thread buffer */
+                if ( csLocal != NULL ) cs_export_buffer_delete( ( * csLocal ) + csParse );
+
+            }
+
+            /* Release threads queries array */
+            free( * csQueries );
+
+            /* Invalidate threads queries array */
+            * csQueries = NULL;
+
+            /* Check threads buffers */
+            if ( csLocal != NULL ) {
+
+                /* Release threads buffers array */
+                free( * csLocal );
+
+                /* Invalidate threads buffers array */
+                * csLocal = NULL;
+
+            }
+
+            /* Return threads count */
+            return( 0 );
+
+        }
+
+        /* Allocate threads queries array */
+        * csQueries = ( cs_Query_t * ) malloc( csCount * sizeof( cs_Query_t ) );
+
+        /* Allocate threads buffers array */
+        if ( csLocal != NULL ) * csLocal = ( cs_Buffer_t * ) malloc( csCount * sizeof( cs_Buffer_t ) );
+
+        /* Check threads arrays */
+        if ( ( ( * csQueries ) == NULL ) || ( ( csLocal != NULL ) && ( ( * csLocal ) == NULL ) ) ) {
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : unable to allocate memory\n" );
+
+            /* Abort creation */
+            exit( EXIT_FAILURE );
+
+        }
+
+        /* Parsing threads */
+        for ( csCreated = 0; csCreated < csCount; csCreated ++ ) {
+
+            /* Check first thread and pose cache */
+            if ( ( csCreated == 0 ) || ( csQuery->qyCache.caPose != NULL ) ) {
+
+                /* Share main query structures */
+                ( * csQueries )[csCreated] = * csQuery;
 
             } else {
 
-                /* Export null field */
-                fprintf( csStream, "null" );
+                /* Create thread query structures */
+                if ( cs_export_query_create( ( * csQueries ) + csCreated, csDevice, LC_FALSE ) == LC_FALSE ) break;
+
+                /* Share main pose records to store */
+                ( * csQueries )[csCreated].qyStore = csQuery->qyStore;
 
             }
 
-            /* Export footer */
-            fprintf( csStream, "\n}\n],\n\"single\":%s,\n\"gps\":false\n}", ( strlen( csGPSf ) > 0 ) ? "true" : "false" );
+            /* Check threads buffers */
+            if ( csLocal == NULL ) continue;
+
+            /* Create thread buffer */
+            if ( cs_export_buffer_create( ( * csLocal ) + csCreated, NULL, csLegacy ) == LC_FALSE ) {
+
+                /* Check thread query structures */
+                if ( ( csCreated > 0 ) && ( csQuery->qyCache.caPose == NULL ) ) {
+
+                    /* Release shared pose records from thread */
+                    ( * csQueries )[csCreated].qyStore = NULL;
+
+                    /* Delete thread query structures */
+                    cs_export_query_delete( ( * csQueries ) + csCreated );
+
+                }
+
+                /* Stop creation */
+                break;
+
+            }
 
-            /* Close output stream */
-            fclose( csStream );
+        }
+
+        /* Check threads resources */
+        if ( csCreated == 0 ) {
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : unable to allocate memory\n" );
+
+            /* Abort creation */
+            exit( EXIT_FAILURE );
 
         }
 
+        /* Return created threads count */
+        return( csCreated );
+
     }
 
 /*
-    Source - JSON array search
+    Source - Query structures creation
  */
 
-    cs_Object_t * cs_export_get_pose( 
+    int cs_export_query_create(
 
-        cs_Object_t * const csArray, 
-        lp_Time_t     const csMaster 
+        cs_Query_t        * const csQuery,
+        cs_Device_t const * const csDevice,
+        int                 const csCache
 
     ) {
 
-        /* Parsing variables */
-        static long csIndex = 0;
+        /* Pose cache devices variables */
+        char const * csTags[6] = { csDevice->dvCAMd, csDevice->dvCAMm, csDevice->dvGPSd, csDevice->dvGPSm, csDevice->dvIMUd, csDevice->dvIMUm };
 
-        /* Size variables */
-        long csSize = 0;
+        /* Reset pose cache structures */
+        memset( & csQuery->qyCache, 0, sizeof( lc_Cache_t ) );
 
-        /* Timestamp variables */
-        lp_Time_t csTime = 0;
+        /* Reset pose records to store */
+        csQuery->qyStore = NULL;
 
-        /* Object variables */
-        cs_Object_t * csPose = NULL;
+        /* Check pose cache */
+        if ( ( csCache == LC_TRUE ) && ( lc_pose_open( & csQuery->qyCache, csDevice->dvPath, csTags ) == LC_TRUE ) ) {
 
-        /* Check object consistency */
-        if ( csArray != NULL ) {
+            /* Check still range device of the cache */
+            if ( csQuery->qyCache.caStill == lc_pose_still( csDevice->dvSTLd, csDevice->dvSTLm ) ) {
 
-            /* Retrieve array size */
-            csSize = json_object_array_length( csArray );
+                /* Assign trigger count */
+                csQuery->qySize = csQuery->qyCache.caCount;
 
-            /* Parsing array */
-            while ( ( csIndex < csSize ) && ( csPose == NULL ) ) {
+                /* Return success */
+                return( LC_TRUE );
 
-                /* Create pose node */
-                csPose = json_object_array_get_idx( csArray, csIndex );
+            }
 
-                /* Compose pose timestamp */
-                csTime = lp_timestamp_compose( 
+            /* Unmap pose cache */
+            lc_pose_close( & csQuery->qyCache );
 
-                    json_object_get_int( json_object_object_get( csPose, "sec" ) ), 
-                    json_object_get_int( json_object_object_get( csPose, "usec" ) ) 
+        }
 
-                );
+        /* Create query structure */
+        csQuery->qyTrigger = lp_query_trigger_create( csDevice->dvPath, csDevice->dvCAMd, csDevice->dvCAMm );
 
-                /* Detect master timestamp equality */
-                if ( lp_timestamp_eq( csMaster, csTime ) == LP_FALSE ) csPose = NULL;
+        /* Verify query structures */
+        if ( lp_query_trigger_state( & csQuery->qyTrigger ) == LP_FALSE ) return( LC_FALSE );
 
-                /* Update parse index */
-                csIndex ++;
+        /* Create query structure */
+        csQuery->qyPosition = lp_query_position_create   ( csDevice->dvPath, csDevice->dvGPSd, csDevice->dvGPSm );
+        csQuery->qyOrient   = lp_query_orientation_create( csDevice->dvPath, csDevice->dvIMUd, csDevice->dvIMUm );
+        csQuery->qyStill    = lp_query_still_create      ( csDevice->dvPath, csDevice->dvSTLd, csDevice->dvSTLm );
 
-            }
+        /* Trigger count query */
+        csQuery->qySize = lp_query_trigger_size( & csQuery->qyTrigger );
+
+        /* Allocate pose records to store, caching being skipped on failure */
+        if ( csCache == LC_TRUE ) csQuery->qyStore = ( lc_Pose_t * ) malloc( ( csQuery->qySize + 1 ) * sizeof( lc_Pose_t ) );
+
+        /* Return success */
+        return( LC_TRUE );
+
+    }
+
+/*
+    Source - Query structures deletion
+ */
+
+    void cs_export_query_delete(
+
+        cs_Query_t * const csQuery
+
+    ) {
+
+        /* Check pose cache */
+        if ( csQuery->qyCache.caPose != NULL ) {
+
+            /* Unmap pose cache */
+            lc_pose_close( & csQuery->qyCache );
+
+        } else {
+
+            /* Release pose records */
+            free( csQuery->qyStore );
+
+            /* Delete query structure */
+            lp_query_still_delete      ( & csQuery->qyStill    );
+            lp_query_orientation_delete( & csQuery->qyOrient   );
+            lp_query_position_delete   ( & csQuery->qyPosition );
+            lp_query_trigger_delete    ( & csQuery->qyTrigger  );
 
         }
 
-        /* Return found allocation */
-        return( csPose );
-        
     }
 
 /*
-    Source - Field exportation
+    Source - Pose cache commitment
  */
 
-    void cs_export_field( 
+    void cs_export_query_commit(
 
-        char        const * const csKey,
-        char        const * const csValue,
-        char        const * const csComma,
-        FILE              * const csStream,
-        cs_Object_t       * const csObject
+        cs_Query_t        * const csQuery,
+        cs_Device_t const * const csDevice
 
     ) {
 
-        /* Object variables */
-        cs_Object_t * csSubObject = NULL;
+        /* Check pose records */
+        if ( csQuery->qyStore == NULL ) return;
 
-        /* Search for already existing entry */
-        if ( ( csSubObject = json_object_object_get( csObject, csKey ) ) == NULL ) {
+        /* Export pose records in cache */
+        lc_pose_write( & csQuery->qyCache, csQuery->qyStore, csQuery->qySize, lc_pose_still( csDevice->dvSTLd, csDevice->dvSTLm ) );
 
-            /* Export to stream */
-            fprintf( csStream, "\"%s\":%s%s\n", csKey, csValue, csComma );
+        /* Release pose records */
+        free( csQuery->qyStore );
 
-        } else {
+        /* Invalidate pose records */
+        csQuery->qyStore = NULL;
 
-            /* Retrieve object type */
-            if ( json_object_get_type( csSubObject ) == json_type_null ) {
+    }
 
-                /* Export to stream */
-                fprintf( csStream, "\"%s\":null%s\n", csKey, csComma );
+/*
+    Source - Camera trigger timestamp query
+ */
 
-            } else
-            if ( json_object_get_type( csSubObject ) == json_type_string ) {
+    lp_Time_t cs_export_query_master(
 
-                /* Export to stream */
-                fprintf( csStream, "\"%s\":\"%s\"%s\n", csKey, json_object_get_string( csSubObject ), csComma );
+        cs_Query_t * const csQuery,
+        long         const csIndex
 
-            } else
-            if ( json_object_get_type( csSubObject ) == json_type_boolean ) {
+    ) {
 
-                /* Export to stream */
-                fprintf( csStream, "\"%s\":%s%s\n", csKey, json_object_get_boolean( csSubObject ) ? "true": "false", csComma );
+        /* Check pose cache */
+        if ( csQuery->qyCache.caPose != NULL ) return( csQuery->qyCache.caPose[csIndex].pcMaster );
 
-            }
+        /* Query trigger by index */
+        lp_query_trigger_byindex( & csQuery->qyTrigger, csIndex );
+
+        /* Return trigger timestamp */
+        return( csQuery->qyTrigger.qrMaster );
+
+    }
+
+/*
+    Source - Pose query
+ */
+
+    void cs_export_query(
+
+        cs_Query_t       * const csQuery,
+        long               const csIndex,
+        double     const * const csForced,
+        cs_Pose_t        * const csPose
+
+    ) {
+
+        /* Pose record variables */
+        lc_Pose_t         csRecord;
+        lc_Pose_t const * csSource = NULL;
+
+        /* Check pose cache */
+        if ( csQuery->qyCache.caPose != NULL ) {
+
+            /* Retrieve cached pose record */
+            csSource = csQuery->qyCache.caPose + csIndex;
+
+        } else {
+
+            /* Query trigger, position, orientation and still range */
+            lc_pose_query( & csRecord, & csQuery->qyTrigger, & csQuery->qyPosition, & csQuery->qyOrient, & csQuery->qyStill, csIndex );
+
+            /* Store pose record */
+            if ( csQuery->qyStore != NULL ) csQuery->qyStore[csIndex] = csRecord;
+
+            /* Assign queried pose record */
+            csSource = & csRecord;
+
+        }
+
+        /* Assign pose timestamp */
+        csPose->psMaster = csSource->pcMaster;
+
+        /* Assign pose still range */
+        csPose->psStill = ( csSource->pcStill == LC_TRUE ) ? LC_TRUE : LC_FALSE;
+
+        /* Reset forced position flag */
+        csPose->psForced = LC_FALSE;
+
+        /* Check position availability */
+        csPose->psLocated = (
+
+            ( csSource->pcLocated != LP_FALSE ) &&
+            ( isnormal( csSource->pcPosition[2] ) != 0 ) &&
+            ( isnormal( csSource->pcPosition[0] ) != 0 ) &&
+            ( isnormal( csSource->pcPosition[1] ) != 0 )
+
+        ) ? LC_TRUE : LC_FALSE;
+
+        /* Assign pose position */
+        memcpy( csPose->psPosition, csSource->pcPosition, sizeof( csPose->psPosition ) );
+
+        /* Check orientation availability */
+        csPose->psOriented = (
+
+            ( csSource->pcOriented != LP_FALSE ) &&
+            ( isnormal( csSource->pcFrame[0] ) != 0 ) &&
+            ( isnormal( csSource->pcFrame[1] ) != 0 ) &&
+            ( isnormal( csSource->pcFrame[2] ) != 0 ) &&
+            ( isnormal( csSource->pcFrame[3] ) != 0 ) &&
+            ( isnormal( csSource->pcFrame[4] ) != 0 ) &&
+            ( isnormal( csSource->pcFrame[5] ) != 0 ) &&
+            ( isnormal( csSource->pcFrame[6] ) != 0 ) &&
+            ( isnormal( csSource->pcFrame[7] ) != 0 ) &&
+            ( isnormal( csSource->pcFrame[8] ) != 0 )
+
+        ) ? LC_TRUE : LC_FALSE;
+
+        /* Assign pose orientation */
+        memcpy( csPose->psFrame, csSource->pcFrame, sizeof( csPose->psFrame ) );
+
+        /* Check forced position */
+        if ( csForced != NULL ) {
+
+            /* Assign forced position */
+            csPose->psForced      = LC_TRUE;
+            csPose->psLocated     = LC_TRUE;
+            csPose->psPosition[0] = csForced[0];
+            csPose->psPosition[1] = csForced[1];
+            csPose->psPosition[2] = csForced[2];
+            csPose->psPosition[3] = 0.0;
+
+        }
+
+    }
+
+/*
+    Source - Forced position analysis
+ */
+
+    int cs_export_get_forced(
+
+        char   const * const csGPSf,
+        double       * const csPosition
+
+    ) {
+
+        /* Check if GPS position are forced */
+        if ( strlen( csGPSf ) == 0 ) return( LC_FALSE );
+
+        /* Analyse forced position */
+        sscanf( csGPSf, "%lf,%lf,%lf", csPosition, csPosition + 1, csPosition + 2 );
+
+        /* Return forced state */
+        return( LC_TRUE );
+
+    }
+
+/*
+    Source - Poses computation
+ */
+
+    cs_Pose_t * cs_export_poses(
+
+        cs_Query_t        * const csQuery,
+        cs_Device_t const * const csDevice,
+        double      const * const csForced,
+        int                 const csThreads,
+        long              * const csSize
+
+    ) {
+
+        /* Parsing variables */
+        long csParse = 0;
+
+        /* Threads variables */
+        int csCount  = 1;
+        int csThread = 0;
+
+        /* Threads queries variables */
+        cs_Query_t * csQueries = NULL;
+
+        /* Poses variables */
+        cs_Pose_t * csPose = NULL;
+
+        /* Compute threads count */
+        # ifdef __OPENMP__
+        csCount = ( csThreads > 0 ) ? csThreads : omp_get_max_threads();
+        # endif
+
+        /* Trigger count query */
+        * csSize = csQuery->qySize;
+
+        /* Allocate and check poses array */
+        if ( ( csPose = ( cs_Pose_t * ) malloc( ( ( * csSize ) + 1 ) * sizeof( cs_Pose_t ) ) ) == NULL ) {
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : unable to allocate memory\n" );
+
+            /* Return null pointer */
+            return( NULL );
+
+        }
+
+        /* Create threads queries */
+        csCount = cs_export_set_threads( csQuery, csDevice, LC_FALSE, csCount, & csQueries, NULL );
+
+        /* Computation loop */
+        # ifdef __OPENMP__
+        # pragma omp parallel for num_threads( csCount ) private( csThread ) schedule( static, CS_EXPORT_CHUNK )
+        # endif
+        for ( csParse = 0; csParse < ( * csSize ); csParse ++ ) {
+
+            /* Retrieve thread index */
+            # ifdef __OPENMP__
+            csThread = omp_get_thread_num();
+            # endif
+
+            /* Query pose */
+            cs_export_query( csQueries + csThread, csParse, csForced, csPose + csParse );
+
+        }
+
+        /* Delete threads queries */
+        cs_export_set_threads( csQuery, csDevice, LC_FALSE, -csCount, & csQueries, NULL );
+
+        /* Export pose cache */
+        cs_export_query_commit( csQuery, csDevice );
+
+        /* Return poses array */
+        return( csPose );
+
+    }
+
+/*
+    Source - Formats list analysis
+ */
+
+    int cs_export_get_format(
+
+        char const * const csFormat
+
+    ) {
+
+        /* Format name variables */
+        char csName[256] = { 0 };
+
+        /* Parsing variables */
+        char const * csParse = csFormat;
+
+        /* Length variables */
+        size_t csLength = 0;
+
+        /* Flags variables */
+        int csFlags = 0;
+
+        /* Check default format */
+        if ( strlen( csFormat ) == 0 ) return( CS_FORMAT_JSON );
+
+        /* Parsing formats list */
+        while ( * csParse != '\0' ) {
+
+            /* Compute format name length */
+            csLength = strcspn( csParse, "," );
+
+            /* Extract format name */
+            snprintf( csName, sizeof( csName ), "%.*s", ( int ) csLength, csParse );
+
+            /* Update flags according to format name */
+            if ( strcmp( csName, "json"    ) == 0 ) csFlags |= CS_FORMAT_JSON;    else
+            if ( strcmp( csName, "bin"     ) == 0 ) csFlags |= CS_FORMAT_BIN;     else
+            if ( strcmp( csName, "csv"     ) == 0 ) csFlags |= CS_FORMAT_CSV;     else
+            if ( strcmp( csName, "geojson" ) == 0 ) csFlags |= CS_FORMAT_GEOJSON; else return( 0 );
+
+            /* Update parsing pointer */
+            csParse += csLength + ( ( csParse[csLength] == ',' ) ? 1 : 0 );
+
+        }
+
+        /* Return formats flags */
+        return( csFlags );
+
+    }
+
+/*
+    Source - Formats exportation
+ */
+
+    void cs_export_formats(
+
+        cs_Query_t        * const csQuery,
+        cs_Device_t const * const csDevice,
+        char              * const csGPSf,
+        char              * const csFile,
+        int                 const csFlags,
+        int                 const csLegacy,
+        int                 const csThreads
+
+    ) {
+
+        /* Formats names variables */
+        static char const * const csName[4] = { "json", "bin", "csv", "geojson" };
+
+        /* Exportation path variables */
+        char csPath[512] = { 0 };
+
+        /* Temporary file path variables */
+        char csTemp[528] = { 0 };
+
+        /* Poses count variables */
+        long csSize = 0;
+
+        /* Parsing variables */
+        int csParse = 0;
+
+        /* Formats count variables */
+        int csCount = 0;
+
+        /* GPS forced variables */
+        int csForced = LC_FALSE;
+
+        /* GPS forced position variables */
+        double csGPSfpos[3] = { 0.0 };
+
+        /* Stream variables */
+        FILE * csStream = NULL;
+
+        /* Buffer variables */
+        cs_Buffer_t csBuffer;
+
+        /* Previous exportation variables */
+        cs_Json_t csJson;
+
+        /* Previous exportation state variables */
+        int csImport = LC_FALSE;
+
+        /* Poses variables */
+        cs_Pose_t * csPose = NULL;
+
+        /* Count requested formats */
+        for ( csParse = 0; csParse < 4; csParse ++ ) if ( ( csFlags & ( 1 << csParse ) ) != 0 ) csCount ++;
+
+        /* Analyse forced position */
+        csForced = cs_export_get_forced( csGPSf, csGPSfpos );
+
+        /* Compute poses */
+        if ( ( csPose = cs_export_poses( csQuery, csDevice, ( csForced == LC_TRUE ) ? csGPSfpos : NULL, csThreads, & csSize ) ) == NULL ) return;
+
+        /* Parsing formats */
+        for ( csParse = 0; csParse < 4; csParse ++ ) {
+
+            /* Check requested format */
+            if ( ( csFlags & ( 1 << csParse ) ) == 0 ) continue;
+
+            /* Compose exportation path */
+            if ( csCount == 1 ) strcpy( csPath, csFile ); else sprintf( csPath, "%s.%s", csFile, csName[csParse] );
+
+            /* Reset previous exportation state */
+            csImport = LC_FALSE;
+
+            /* Check previous JSON file existence */
+            if ( ( ( 1 << csParse ) == CS_FORMAT_JSON ) && ( lc_file_detect( csPath, LC_FILE ) == LC_TRUE ) ) {
+
+                /* Import previous exportation */
+                if ( ( csImport = cs_export_json_import( & csJson, csPath ) ) == LC_FALSE ) {
+
+                    /* Display message */
+                    fprintf( LC_ERR, "Error : unable to import %s file content\n", basename( csPath ) );
+
+                    /* Skip format */
+                    continue;
+
+                }
+
+            }
+
+            /* Display message */
+            fprintf( LC_OUT, "%s %s %s file ...\n", ( csImport == LC_TRUE ) ? "Updating" : "Creating", basename( csPath ), csName[csParse] );
+
+            /* Create stream */
+            if ( ( csStream = lc_file_atomic_open( csPath, csTemp ) ) == NULL ) {
+
+                /* Display message */
+                fprintf( LC_ERR, "Error : unable to access %s\n", basename( csPath ) );
+
+            } else {
+
+                /* Create and check exportation buffer */
+                if ( cs_export_buffer_create( & csBuffer, csStream, csLegacy ) == LC_FALSE ) {
+
+                    /* Discard output stream */
+                    lc_file_atomic_close( csStream, csTemp, csPath, LC_FALSE );
+
+                } else {
+
+                    /* Export poses according to format */
+                    switch ( 1 << csParse ) {
+
+                        case ( CS_FORMAT_JSON    ) : { cs_export_write_json   ( & csBuffer, csPose, csSize, csForced, ( csImport == LC_TRUE ) ? & csJson : NULL ); } break;
+                        case ( CS_FORMAT_BIN     ) : { cs_export_write_bin    ( & csBuffer, csPose, csSize, csForced ); } break;
+                        case ( CS_FORMAT_CSV     ) : { cs_export_write_csv    ( & csBuffer, csPose, csSize ); } break;
+                        case ( CS_FORMAT_GEOJSON ) : { cs_export_write_geojson( & csBuffer, csPose, csSize ); } break;
+
+                    }
+
+                    /* Delete exportation buffer */
+                    cs_export_buffer_delete( & csBuffer );
+
+                    /* Commit output stream */
+                    if ( lc_file_atomic_close( csStream, csTemp, csPath, LC_TRUE ) == LC_FALSE ) {
+
+                        /* Display message */
+                        fprintf( LC_ERR, "Error : unable to write %s\n", basename( csPath ) );
+
+                    }
+
+                }
+
+            }
+
+            /* Delete previous exportation */
+            if ( csImport == LC_TRUE ) cs_export_json_delete( & csJson );
+
+        }
+
+        /* Release poses array */
+        free( csPose );
+
+    }
+
+/*
+    Source - JSON poses exportation
+ */
+
+    void cs_export_write_json(
+
+        cs_Buffer_t       * const csBuffer,
+        cs_Pose_t   const * const csPose,
+        long                const csSize,
+        int                 const csForced,
+        cs_Json_t   const * const csJson
+
+    ) {
+
+        /* Parsing variables */
+        long csParse = 0;
+
+        /* GPS availability variables */
+        int csSignal = LC_FALSE;
+
+        /* Index variables */
+        cs_Index_t csIndex;
+
+        /* Create previous poses index */
+        if ( cs_export_set_index( csJson, & csIndex ) == LC_FALSE ) return;
+
+        /* Export JSON head */
+        cs_export_head_json( csBuffer, csJson );
+
+        /* Parsing poses */
+        for ( csParse = 0; csParse < csSize; csParse ++ ) {
+
+            /* Update GPS availability */
+            if ( csPose[csParse].psLocated == LC_TRUE ) csSignal = LC_TRUE;
+
+            /* Export pose */
+            cs_export_pose_json( csBuffer, csPose + csParse, csJson, cs_export_get_pose( csJson, & csIndex, csPose[csParse].psMaster ), csParse == ( csSize - 1 ) );
+
+        }
+
+        /* Export JSON tail */
+        cs_export_tail_json( csBuffer, csForced, csSignal );
+
+        /* Delete previous poses index */
+        cs_export_index_delete( & csIndex );
+
+    }
+
+/*
+    Source - Binary poses exportation
+ */
+
+    void cs_export_write_bin(
+
+        cs_Buffer_t       * const csBuffer,
+        cs_Pose_t   const * const csPose,
+        long                const csSize,
+        int                 const csForced
+
+    ) {
+
+        /* Parsing variables */
+        long csParse = 0;
+        int  csComp  = 0;
+
+        /* Bitmap variables */
+        int csByte = 0;
+
+        /* Flags variables */
+        int csFlags = 0;
+
+        /* Compose flags */
+        if ( csForced == LC_TRUE ) csFlags |= CS_BINARY_SINGLE;
+
+        /* Parsing poses */
+        for ( csParse = 0; csParse < csSize; csParse ++ ) {
+
+            /* Update GPS availability */
+            if ( csPose[csParse].psLocated == LC_TRUE ) csFlags |= CS_BINARY_GPS;
+
+        }
+
+        /* Export header */
+        cs_export_buffer_memory( csBuffer, CS_BINARY_MAGIC, 8 );
+        cs_export_buffer_uint  ( csBuffer, CS_BINARY_VERSION, 4 );
+        cs_export_buffer_uint  ( csBuffer, csFlags, 4 );
+        cs_export_buffer_uint  ( csBuffer, csSize, 8 );
+        cs_export_buffer_uint  ( csBuffer, 0, 8 );
+
+        /* Export seconds array */
+        for ( csParse = 0; csParse < csSize; csParse ++ ) cs_export_buffer_uint( csBuffer, lp_timestamp_sec( csPose[csParse].psMaster ), 8 );
+
+        /* Export microseconds array */
+        for ( csParse = 0; csParse < csSize; csParse ++ ) cs_export_buffer_uint( csBuffer, lp_timestamp_usec( csPose[csParse].psMaster ), 8 );
+
+        /* Export positions array */
+        for ( csParse = 0; csParse < csSize; csParse ++ ) {
+
+            /* Export position components */
+            for ( csComp = 0; csComp < 4; csComp ++ ) cs_export_buffer_real( csBuffer, ( csPose[csParse].psLocated == LC_TRUE ) ? csPose[csParse].psPosition[csComp] : NAN );
+
+        }
+
+        /* Export orientations array */
+        for ( csParse = 0; csParse < csSize; csParse ++ ) {
+
+            /* Export orientation components */
+            for ( csComp = 0; csComp < 10; csComp ++ ) cs_export_buffer_real( csBuffer, ( csPose[csParse].psOriented == LC_TRUE ) ? csPose[csParse].psFrame[csComp] : NAN );
+
+        }
+
+        /* Export still range array */
+        for ( csParse = 0; csParse < csSize; csParse ++ ) cs_export_buffer_uint( csBuffer, ( csPose[csParse].psStill == LC_TRUE ) ? 1 : 0, 1 );
+
+        /* Export positions validity bitmap */
+        for ( csParse = 0, csByte = 0; csParse < csSize; csParse ++ ) {
+
+            /* Update bitmap byte */
+            if ( csPose[csParse].psLocated == LC_TRUE ) csByte |= 1 << ( csParse & 7 );
+
+            /* Export completed bitmap byte */
+            if ( ( ( csParse & 7 ) == 7 ) || ( csParse == ( csSize - 1 ) ) ) { cs_export_buffer_uint( csBuffer, csByte, 1 ); csByte = 0; }
+
+        }
+
+        /* Export orientations validity bitmap */
+        for ( csParse = 0, csByte = 0; csParse < csSize; csParse ++ ) {
+
+            /* Update bitmap byte */
+            if ( csPose[csParse].psOriented == LC_TRUE ) csByte |= 1 << ( csParse & 7 );
+
+            /* Export completed bitmap byte */
+            if ( ( ( csParse & 7 ) == 7 ) || ( csParse == ( csSize - 1 ) ) ) { cs_export_buffer_uint( csBuffer, csByte, 1 ); csByte = 0; }
+
+        }
+
+    }
+
+/*
+    Source - CSV poses exportation
+ */
+
+    void cs_export_write_csv(
+
+        cs_Buffer_t       * const csBuffer,
+        cs_Pose_t   const * const csPose,
+        long                const csSize
+
+    ) {
+
+        /* Parsing variables */
+        long csParse = 0;
+        int  csComp  = 0;
+
+        /* Export columns header */
+        cs_export_buffer_string( csBuffer, CS_CSV_HEADER );
+
+        /* Parsing poses */
+        for ( csParse = 0; csParse < csSize; csParse ++ ) {
+
+            /* Export timestamp and still range */
+            cs_export_buffer_time  ( csBuffer, lp_timestamp_sec ( csPose[csParse].psMaster ) );
+            cs_export_buffer_string( csBuffer, "," );
+            cs_export_buffer_time  ( csBuffer, lp_timestamp_usec( csPose[csParse].psMaster ) );
+            cs_export_buffer_string( csBuffer, ( csPose[csParse].psStill == LC_TRUE ) ? ",1" : ",0" );
+
+            /* Export position components, empty if not available */
+            for ( csComp = 0; csComp < 4; csComp ++ ) {
+
+                /* Export separator */
+                cs_export_buffer_string( csBuffer, "," );
+
+                /* Export component */
+                if ( csPose[csParse].psLocated == LC_TRUE ) cs_export_buffer_double( csBuffer, csPose[csParse].psPosition[csComp] );
+
+            }
+
+            /* Export orientation components, empty if not available */
+            for ( csComp = 0; csComp < 10; csComp ++ ) {
+
+                /* Export separator */
+                cs_export_buffer_string( csBuffer, "," );
+
+                /* Export component */
+                if ( csPose[csParse].psOriented == LC_TRUE ) cs_export_buffer_double( csBuffer, csPose[csParse].psFrame[csComp] );
+
+            }
+
+            /* Export record ending */
+            cs_export_buffer_string( csBuffer, "\n" );
+
+        }
+
+    }
+
+/*
+    Source - GeoJSON poses exportation
+ */
+
+    void cs_export_write_geojson(
+
+        cs_Buffer_t       * const csBuffer,
+        cs_Pose_t   const * const csPose,
+        long                const csSize
+
+    ) {
+
+        /* Parsing variables */
+        long csParse = 0;
+
+        /* Located poses variables */
+        long csLocated = 0;
+
+        /* Export collection head */
+        cs_export_buffer_string( csBuffer, "{\"type\":\"FeatureCollection\",\"features\":[\n" );
+
+        /* Parsing poses */
+        for ( csParse = 0; csParse < csSize; csParse ++ ) {
+
+            /* Check position availability */
+            if ( csPose[csParse].psLocated == LC_FALSE ) continue;
+
+            /* Export features separator */
+            if ( ( csLocated ++ ) > 0 ) cs_export_buffer_string( csBuffer, ",\n" );
+
+            /* Export point feature */
+            cs_export_buffer_string( csBuffer, "{\"type\":\"Feature\",\"geometry\":{\"type\":\"Point\",\"coordinates\":" );
+            cs_export_point_geojson( csBuffer, csPose + csParse );
+            cs_export_buffer_string( csBuffer, "},\"properties\":{\"sec\":" );
+            cs_export_buffer_time  ( csBuffer, lp_timestamp_sec ( csPose[csParse].psMaster ) );
+            cs_export_buffer_string( csBuffer, ",\"usec\":" );
+            cs_export_buffer_time  ( csBuffer, lp_timestamp_usec( csPose[csParse].psMaster ) );
+            cs_export_buffer_string( csBuffer, ( csPose[csParse].psStill == LC_TRUE ) ? ",\"still\":true}}" : ",\"still\":false}}" );
+
+        }
+
+        /* Check line string validity */
+        if ( csLocated > 1 ) {
+
+            /* Export line string feature */
+            cs_export_buffer_string( csBuffer, ",\n{\"type\":\"Feature\",\"geometry\":{\"type\":\"LineString\",\"coordinates\":[\n" );
+
+            /* Parsing poses */
+            for ( csParse = 0, csLocated = 0; csParse < csSize; csParse ++ ) {
+
+                /* Check position availability */
+                if ( csPose[csParse].psLocated == LC_FALSE ) continue;
+
+                /* Export coordinates separator */
+                if ( ( csLocated ++ ) > 0 ) cs_export_buffer_string( csBuffer, ",\n" );
+
+                /* Export coordinates */
+                cs_export_point_geojson( csBuffer, csPose + csParse );
+
+            }
+
+            /* Export line string ending */
+            cs_export_buffer_string( csBuffer, "\n]},\"properties\":{}}" );
+
+        }
+
+        /* Export collection ending */
+        cs_export_buffer_string( csBuffer, "\n]}\n" );
+
+    }
+
+/*
+    Source - GeoJSON coordinates exportation
+ */
+
+    void cs_export_point_geojson(
+
+        cs_Buffer_t       * const csBuffer,
+        cs_Pose_t   const * const csPose
+
+    ) {
+
+        /* Export coordinates */
+        cs_export_buffer_string( csBuffer, "[" );
+        cs_export_buffer_double( csBuffer, csPose->psPosition[0] );
+        cs_export_buffer_string( csBuffer, "," );
+        cs_export_buffer_double( csBuffer, csPose->psPosition[1] );
+        cs_export_buffer_string( csBuffer, "," );
+        cs_export_buffer_double( csBuffer, csPose->psPosition[2] );
+        cs_export_buffer_string( csBuffer, "]" );
+
+    }
+
+/*
+    Source - JSON head exportation
+ */
+
+    void cs_export_head_json(
+
+        cs_Buffer_t       * const csBuffer,
+        cs_Json_t   const * const csJson
+
+    ) {
+
+        /* Export format */
+        cs_export_buffer_string( csBuffer, "{\n" );
+
+        /* Export to stream */
+        cs_export_field( "split"  , "false", ",", csBuffer, csJson, ( csJson != NULL ) ? & csJson->jsSplit   : NULL );
+        cs_export_field( "preview", "false", ",", csBuffer, csJson, ( csJson != NULL ) ? & csJson->jsPreview : NULL );
+        cs_export_field( "trash"  , "false", ",", csBuffer, csJson, ( csJson != NULL ) ? & csJson->jsTrash   : NULL );
+        cs_export_field( "pose"   , ""     , "" , csBuffer, NULL  , NULL );
+
+        /* Export format */
+        cs_export_buffer_string( csBuffer, "[\n" );
+
+    }
+
+/*
+    Source - JSON tail exportation
+ */
+
+    void cs_export_tail_json(
+
+        cs_Buffer_t * const csBuffer,
+        int           const csForced,
+        int           const csSignal
+
+    ) {
+
+        /* Export format */
+        cs_export_buffer_string( csBuffer, "],\n" );
+
+        /* Export to stream */
+        cs_export_field( "single", ( csForced == LC_TRUE ) ? "true" : "false", ",", csBuffer, NULL, NULL );
+        cs_export_field( "gps"   , ( csSignal == LC_TRUE ) ? "true" : "false", "" , csBuffer, NULL, NULL );
+
+        /* Export format */
+        cs_export_buffer_string( csBuffer, "}\n" );
+
+    }
+
+/*
+    Source - JSON pose exportation
+ */
+
+    void cs_export_pose_json(
+
+        cs_Buffer_t       * const csBuffer,
+        cs_Pose_t   const * const csPose,
+        cs_Json_t   const * const csJson,
+        cs_Field_t  const * const csRaw,
+        int                 const csLast
+
+    ) {
+
+        /* Export format */
+        cs_export_buffer_string( csBuffer, "{\n" );
+
+        /* Export to stream */
+        cs_export_field( "still", ( csPose->psStill == LC_TRUE ) ? "true" : "false", ",", csBuffer, NULL, NULL );
+        cs_export_field( "raw", "\"unknown\"", ",", csBuffer, csJson, csRaw );
+
+        /* Export to stream */
+        cs_export_buffer_string( csBuffer, "\"sec\":" );
+        cs_export_buffer_time  ( csBuffer, lp_timestamp_sec ( csPose->psMaster ) );
+        cs_export_buffer_string( csBuffer, ",\n\"usec\":" );
+        cs_export_buffer_time  ( csBuffer, lp_timestamp_usec( csPose->psMaster ) );
+        cs_export_buffer_string( csBuffer, ",\n" );
+
+        /* Check position availability */
+        if ( csPose->psLocated == LC_FALSE ) {
+
+            /* Export to stream */
+            cs_export_field( "position", "null", ",", csBuffer, NULL, NULL );
+
+        } else {
+
+            /* Export to stream */
+            cs_export_field( "position", "", "", csBuffer, NULL, NULL );
+
+            /* Export format */
+            cs_export_buffer_string( csBuffer, "[\n" );
+
+            /* Check forced position */
+            if ( csPose->psForced == LC_TRUE ) {
+
+                /* Export to stream */
+                cs_export_vector( csBuffer, csPose->psPosition, 4 );
+
+            } else {
+
+                /* Export to stream */
+                cs_export_vector( csBuffer, ( double [4] ) {
+
+                    csPose->psPosition[2],
+                    csPose->psPosition[0],
+                    csPose->psPosition[1],
+                    csPose->psPosition[3]
+
+                }, 4 );
+
+            }
+
+            /* Export format */
+            cs_export_buffer_string( csBuffer, "],\n" );
+
+        }
+
+        /* Check orientation availability */
+        if ( csPose->psOriented == LC_FALSE ) {
+
+            /* Export to stream */
+            cs_export_field( "orientation", "null", "", csBuffer, NULL, NULL );
+
+        } else {
+
+            /* Export to stream */
+            cs_export_field( "orientation", "", "", csBuffer, NULL, NULL );
+
+            /* Export format */
+            cs_export_buffer_string( csBuffer, "[\n" );
+
+            /* Export to stream */
+            cs_export_vector( csBuffer, csPose->psFrame, 10 );
+
+            /* Export format */
+            cs_export_buffer_string( csBuffer, "]\n" );
+
+        }
+
+        /* Export format */
+        cs_export_buffer_string( csBuffer, ( csLast == LC_FALSE ) ? "},\n" : "}\n" );
+
+    }
+
+/*
+    Source - Template creation function
+ */
+
+    void cs_export_template( 
+
+        char * const csGPSf,
+        char * const csFile 
+
+    ) {
+
+        /* Stream variables */
+        FILE * csStream = NULL;
+
+        /* Temporary file path variables */
+        char csTemp[512] = { 0 };
+
+        /* Create and check output stream */
+        if ( ( csStream = lc_file_atomic_open( csFile, csTemp ) ) == NULL ) {
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : unable to write %s\n", basename( csFile ) );
+
+        } else {
+
+            /* Export header */
+            fprintf( csStream, "{\n\"split\":true,\n\"preview\":false,\n\"trash\":false,\n\"pose\":[\n{\n" );
+
+            /* Export template pose */
+            fprintf( csStream, "\"raw\":\"unknown\",\n\"still\":true,\n\"sec\":null,\n\"usec\":null,\n\"orientation\":null,\n\"position\":" );
+
+            /* Export GPS position */
+            if ( strlen( csGPSf ) > 0 ) {
+
+                /* Export forced position */
+                fprintf( csStream, "[%s,0.0]", csGPSf );
+
+            } else {
+
+                /* Export null field */
+                fprintf( csStream, "null" );
+
+            }
+
+            /* Export footer */
+            fprintf( csStream, "\n}\n],\n\"single\":%s,\n\"gps\":false\n}", ( strlen( csGPSf ) > 0 ) ? "true" : "false" );
+
+            /* Commit output stream */
+            if ( lc_file_atomic_close( csStream, csTemp, csFile, LC_TRUE ) == LC_FALSE ) {
+
+                /* Display message */
+                fprintf( LC_ERR, "Error : unable to write %s\n", basename( csFile ) );
+
+            }
+
+        }
+
+    }
+
+/*
+    Source - Previous poses indexation
+ */
+
+    int cs_export_set_index(
+
+        cs_Json_t  const * const csJson,
+        cs_Index_t       * const csIndex
+
+    ) {
+
+        /* Parsing variables */
+        long csParse = 0;
+
+        /* Size variables */
+        long csSize = 0;
+
+        /* Retrieve poses count */
+        if ( csJson != NULL ) csSize = csJson->jsCount;
+
+        /* Create and check index */
+        if ( cs_export_index_create( csIndex, csSize ) == LC_FALSE ) return( LC_FALSE );
+
+        /* Parsing poses */
+        for ( csParse = 0; csParse < csSize; csParse ++ ) {
+
+            /* Index pose position */
+            cs_export_index_insert( csIndex, csJson->jsMaster[csParse], csParse );
+
+        }
+
+        /* Return success */
+        return( LC_TRUE );
+
+    }
+
+/*
+    Source - Previous pose search
+ */
+
+    cs_Field_t const * cs_export_get_pose(
+
+        cs_Json_t  const * const csJson,
+        cs_Index_t const * const csIndex,
+        lp_Time_t          const csMaster
+
+    ) {
+
+        /* Position variables */
+        long csPosition = cs_export_index_search( csIndex, csMaster );
+
+        /* Return found pose raw field */
+        return( ( csPosition == CS_INDEX_EMPTY ) ? NULL : csJson->jsRaw + csPosition );
+
+    }
+
+/*
+    Source - Field exportation
+ */
+
+    void cs_export_field( 
+
+        char        const * const csKey,
+        char        const * const csValue,
+        char        const * const csComma,
+        cs_Buffer_t       * const csBuffer,
+        cs_Json_t   const * const csJson,
+        cs_Field_t  const * const csField
+
+    ) {
+
+        /* Field type variables */
+        int csType = ( csField != NULL ) ? csField->fdType : CS_JSON_ABSENT;
+
+        /* Export field key */
+        cs_export_buffer_string( csBuffer, "\"" );
+        cs_export_buffer_string( csBuffer, csKey );
+        cs_export_buffer_string( csBuffer, "\":" );
+
+        /* Check previous field type */
+        if ( csType == CS_JSON_STRING ) {
+
+            /* Export to stream */
+            cs_export_buffer_string( csBuffer, "\"" );
+            cs_export_buffer_string( csBuffer, cs_export_json_string( csJson, csField ) );
+            cs_export_buffer_string( csBuffer, "\"" );
+
+        } else
+        if ( ( csType == CS_JSON_TRUE ) || ( csType == CS_JSON_FALSE ) ) {
+
+            /* Export to stream */
+            cs_export_buffer_string( csBuffer, ( csType == CS_JSON_TRUE ) ? "true" : "false" );
+
+        } else {
+
+            /* Export to stream */
+            cs_export_buffer_string( csBuffer, csValue );
+
+        }
+
+        /* Export field ending */
+        cs_export_buffer_string( csBuffer, csComma );
+        cs_export_buffer_string( csBuffer, "\n" );
+
+    }
+
+/*
+    Source - Vector exportation
+ */
+
+    void cs_export_vector(
+
+        cs_Buffer_t       * const csBuffer,
+        double      const * const csVector,
+        int                 const csSize
+
+    ) {
+
+        /* Parsing variables */
+        int csParse = 0;
+
+        /* Parsing vector components */
+        for ( csParse = 0; csParse < csSize; csParse ++ ) {
+
+            /* Export component */
+            cs_export_buffer_double( csBuffer, csVector[csParse] );
+
+            /* Export format */
+            cs_export_buffer_string( csBuffer, ( csParse < ( csSize - 1 ) ) ? ",\n" : " \n" );
 
         }
 
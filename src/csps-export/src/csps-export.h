@@ -102,31 +102,65 @@
     # include <libgen.h>
     # include <csps-all.h>
     # include <common-all.h>
-    # include <json-c/json.h>
+    # ifdef __OPENMP__
+    # include <omp.h>
+    # endif
+    # include "csps-export-dtoa.h"
+    # include "csps-export-buffer.h"
+    # include "csps-export-index.h"
+    # include "csps-export-json.h"
 
 /* 
     Header - Preprocessor definitions
  */
 
     /* Standard help */
-    # define CS_HELP "Usage summary :\n\n"           \
-    "\tcsps-export [Arguments] [Parameters] ...\n\n" \
-    "Short arguments and parameters summary :\n\n"   \
-    "\t-p\tCSPS-processed structure path\n"          \
-    "\t-e\tJSON exportation file path\n"             \
-    "\t-c\tCapture trigger device CSPS-tag\n"        \
-    "\t-m\tCapture trigger device CSPS-module\n"     \
-    "\t-g\tGPS device CSPS-tag\n"                    \
-    "\t-n\tGPS device CSPS-module\n"                 \
-    "\t-i\tIMU device CSPS-tag\n"                    \
-    "\t-s\tIMU device CSPS-module\n"                 \
-    "\t-t\tStill range device CSPS-tag\n"            \
-    "\t-k\tStill range device CSPS-module\n"         \
-    "\t-f\tManual position coordinates\n"            \
-    "\t-l\tExport template JSON file\n\n"            \
-    "csps-export - csps-suite\n"                     \
+    # define CS_HELP "Usage summary :\n\n"                       \
+    "\tcsps-export [Arguments] [Parameters] ...\n\n"             \
+    "Short arguments and parameters summary :\n\n"               \
+    "\t-p\tCSPS-processed structure path\n"                      \
+    "\t-e\tExportation file path\n"                              \
+    "\t-c\tCapture trigger device CSPS-tag\n"                    \
+    "\t-m\tCapture trigger device CSPS-module\n"                 \
+    "\t-g\tGPS device CSPS-tag\n"                                \
+    "\t-n\tGPS device CSPS-module\n"                             \
+    "\t-i\tIMU device CSPS-tag\n"                                \
+    "\t-s\tIMU device CSPS-module\n"                             \
+    "\t-t\tStill range device CSPS-tag\n"                        \
+    "\t-k\tStill range device CSPS-module\n"                     \
+    "\t-f\tManual position coordinates\n"                        \
+    "\t-l\tExport template JSON file\n"                          \
+    "\t-x\tExport doubles using legacy formatting\n"             \
+    "\t-j\tNumber of threads used for exportation\n"             \
+    "\t-o\tExportation formats list (json, bin, csv, geojson)\n" \
+    "\t-r\tAppend only the new triggers poses (json alone)\n\n"  \
+    "csps-export - csps-suite\n"                                 \
     "Copyright (c) 2013-2015 FOXEL SA\n"
 
+    /* Define exportation chunk size, in poses */
+    # define CS_EXPORT_CHUNK 1024
+
+    /* Define binary format identification */
+    # define CS_BINARY_MAGIC   "CSPSPOSE"
+    # define CS_BINARY_VERSION 1
+
+    /* Define binary format flags */
+    # define CS_BINARY_SINGLE  0x01
+    # define CS_BINARY_GPS     0x02
+
+    /* Define exportation formats flags */
+    # define CS_FORMAT_JSON    0x01
+    # define CS_FORMAT_BIN     0x02
+    # define CS_FORMAT_CSV     0x04
+    # define CS_FORMAT_GEOJSON 0x08
+
+    /* Define last exportation record */
+    # define CS_LAST_SUFFIX    ".last"
+    # define CS_LAST_MAGIC     "csps-export-last-1"
+
+    /* Define CSV columns header */
+    # define CS_CSV_HEADER     "sec,usec,still,lon,lat,alt,weak,fxx,fxy,fxz,fyx,fyy,fyz,fzx,fzy,fzz,oweak\n"
+
 /* 
     Header - Preprocessor macros
  */
@@ -135,13 +169,156 @@
     Header - Typedefs
  */
 
-    /* Type definition simplification */
-    typedef struct json_object cs_Object_t;
-
 /* 
     Header - Structures
  */
 
+    /*! \struct cs_Device_struct
+     *  \brief Exportation devices
+     *
+     *  This structure holds the CSPS-processed structure path and the CSPS-tag
+     *  and CSPS-module of the devices used to create query structures.
+     *
+     *  \var cs_Device_struct::dvPath
+     *  CSPS-processed structure path
+     *  \var cs_Device_struct::dvCAMd
+     *  Capture trigger device CSPS-tag
+     *  \var cs_Device_struct::dvCAMm
+     *  Capture trigger device CSPS-module
+     *  \var cs_Device_struct::dvGPSd
+     *  GPS device CSPS-tag
+     *  \var cs_Device_struct::dvGPSm
+     *  GPS device CSPS-module
+     *  \var cs_Device_struct::dvIMUd
+     *  IMU device CSPS-tag
+     *  \var cs_Device_struct::dvIMUm
+     *  IMU device CSPS-module
+     *  \var cs_Device_struct::dvSTLd
+     *  Still range device CSPS-tag
+     *  \var cs_Device_struct::dvSTLm
+     *  Still range device CSPS-module
+     */
+
+    typedef struct cs_Device_struct {
+
+        char dvPath[256];
+        char dvCAMd[256];
+        char dvCAMm[256];
+        char dvGPSd[256];
+        char dvGPSm[256];
+        char dvIMUd[256];
+        char dvIMUm[256];
+        char dvSTLd[256];
+        char dvSTLm[256];
+
+    } cs_Device_t;
+
+    /*! \struct cs_Query_struct
+     *  \brief Exportation queries
+     *
+     *  This structure gathers the CSPS query structures needed to compute the
+     *  exported poses. Each exportation thread owns its own instance. When the
+     *  pose cache of the CSPS directory is valid, the CSPS query structures are
+     *  not created and the poses are read from the mapped cache, shared by all
+     *  the threads.
+     *
+     *  \var cs_Query_struct::qyTrigger
+     *  CSPS camera trigger query structure
+     *  \var cs_Query_struct::qyPosition
+     *  CSPS geoposition query structure
+     *  \var cs_Query_struct::qyOrient
+     *  CSPS orientation query structure
+     *  \var cs_Query_struct::qyStill
+     *  CSPS still range query structure
+     *  \var cs_Query_struct::qyCache
+     *  Pose cache descriptor
+     *  \var cs_Query_struct::qyStore
+     *  Pose records to export in cache, shared by threads, NULL if not stored
+     *  \var cs_Query_struct::qySize
+     *  Number of camera triggers
+     */
+
+    typedef struct cs_Query_struct {
+
+        lp_Trigger_t  qyTrigger;
+        lp_Position_t qyPosition;
+        lp_Orient_t   qyOrient;
+        lp_Still_t    qyStill;
+        lc_Cache_t    qyCache;
+        lc_Pose_t   * qyStore;
+        long          qySize;
+
+    } cs_Query_t;
+
+    /*! \struct cs_Last_struct
+     *  \brief Last exportation
+     *
+     *  This structure describes the state of the JSON file at the end of the
+     *  last exportation. It is stored in a record file next to the JSON file
+     *  and allows to only append the poses of the new camera triggers.
+     *
+     *  \var cs_Last_struct::lsCount
+     *  Number of exported camera triggers
+     *  \var cs_Last_struct::lsMaster
+     *  Master timestamp of the last exported camera trigger
+     *  \var cs_Last_struct::lsOffset
+     *  Offset, in bytes, of the poses array ending in the JSON file
+     *  \var cs_Last_struct::lsSize
+     *  Size, in bytes, of the JSON file
+     *  \var cs_Last_struct::lsSignal
+     *  GPS availability flag
+     *  \var cs_Last_struct::lsForced
+     *  Manual position flag
+     *  \var cs_Last_struct::lsLegacy
+     *  Legacy double formatting flag
+     */
+
+    typedef struct cs_Last_struct {
+
+        long      lsCount;
+        lp_Time_t lsMaster;
+        size_t    lsOffset;
+        size_t    lsSize;
+        int       lsSignal;
+        int       lsForced;
+        int       lsLegacy;
+
+    } cs_Last_t;
+
+    /*! \struct cs_Pose_struct
+     *  \brief Exportation pose
+     *
+     *  This structure holds the result of the queries performed for one camera
+     *  trigger, ready to be formatted.
+     *
+     *  \var cs_Pose_struct::psMaster
+     *  Pose master timestamp
+     *  \var cs_Pose_struct::psStill
+     *  Still range flag
+     *  \var cs_Pose_struct::psForced
+     *  Manual position flag
+     *  \var cs_Pose_struct::psLocated
+     *  Position availability flag
+     *  \var cs_Pose_struct::psPosition
+     *  Position longitude, latitude, altitude and weak flag
+     *  \var cs_Pose_struct::psOriented
+     *  Orientation availability flag
+     *  \var cs_Pose_struct::psFrame
+     *  Orientation frame components and weak flag
+     */
+
+    typedef struct cs_Pose_struct {
+
+        lp_Time_t psMaster;
+        int       psStill;
+        int       psForced;
+        int       psLocated;
+        double    psPosition[4];
+        int       psOriented;
+        double    psFrame[10];
+
+    } cs_Pose_t;
+
 /* 
     Header - Function prototypes
  */
@@ -153,8 +330,8 @@
      *  that realize JSON exportation. If a previous JSON file is available, it
      *  is erased after its content importation.
      *
-     *  The main function is also responsible of CSPS query structures creation
-     *  and deletion.
+     *  The main function is also responsible of the main thread CSPS query
+     *  structures creation and deletion.
      *  
      *  \param  argc Standard main parameter
      *  \param  argv Standard main parameter
@@ -171,24 +348,477 @@
      *  the previous exportation file if available. The function expects already
      *  created CSPS query structures.
      *
-     *  \param csTrigger  CSPS camera trigger query structure
-     *  \param csPosition CSPS geoposition query structure
-     *  \param csOrient   CSPS orientation query structure
-     *  \param csStill    CSPS still range query structure
-     *  \param csGPSf     GPS manual position coordinates.
-     *  \param csFile     JSON exportation file
-     *  \param csJson     Previous JSON file main object
+     *  The camera triggers are processed by chunks of CS_EXPORT_CHUNK poses
+     *  distributed over the threads. Each thread queries its poses through its
+     *  own query structures and formats them in its own memory buffer. After
+     *  each round of chunks, the threads buffers are appended in order to the
+     *  exportation buffer, so that the output does not depend on the number of
+     *  threads.
+     *
+     *  If a last exportation structure is provided, it is updated and stored
+     *  in the record file next to the JSON file once the exportation is done.
+     *  If it indicates already exported camera triggers, the content of the
+     *  JSON file is kept up to the last exported pose and only the poses of
+     *  the new camera triggers are computed and appended.
+     *
+     *  \param csQuery   Main thread CSPS query structures
+     *  \param csDevice  Devices used to create threads query structures
+     *  \param csGPSf    GPS manual position coordinates.
+     *  \param csFile    JSON exportation file
+     *  \param csJson    Previous JSON file imported document
+     *  \param csLegacy  Legacy double formatting flag
+     *  \param csThreads Number of threads, zero for default
+     *  \param csLast    Last exportation structure, can be NULL
      */
 
     void cs_export( 
 
-        lp_Trigger_t  * const csTrigger, 
-        lp_Position_t * const csPosition, 
-        lp_Orient_t   * const csOrient,
-        lp_Still_t    * const csStill,
-        char          * const csGPSf,
-        char          * const csFile,
-        cs_Object_t   * const csJson
+        cs_Query_t        * const csQuery,
+        cs_Device_t const * const csDevice,
+        char              * const csGPSf,
+        char              * const csFile,
+        cs_Json_t         * const csJson,
+        int                 const csLegacy,
+        int                 const csThreads,
+        cs_Last_t         * const csLast
+
+    );
+
+    /*! \brief Last exportation analysis
+     *
+     *  This function imports the last exportation record of the provided JSON
+     *  file and checks that the poses of the new camera triggers can simply be
+     *  appended : the JSON file has to be left unchanged since the record was
+     *  written, the last exported camera trigger has to be found at the same
+     *  index with the same timestamp, and the formatting options have to be
+     *  the same. Manual position exportations are always fully recomputed.
+     *
+     *  \param csQuery  Main thread CSPS query structures
+     *  \param csGPSf   GPS manual position coordinates.
+     *  \param csFile   JSON exportation file
+     *  \param csLegacy Legacy double formatting flag
+     *  \param csLast   Last exportation structure to fill
+     *
+     *  \return Returns LC_TRUE if poses can be appended, LC_FALSE otherwise
+     */
+
+    int cs_export_get_last(
+
+        cs_Query_t  * const csQuery,
+        char  const * const csGPSf,
+        char  const * const csFile,
+        int           const csLegacy,
+        cs_Last_t   * const csLast
+
+    );
+
+    /*! \brief Last exportation record
+     *
+     *  This function writes the provided last exportation structure in the
+     *  record file of the provided JSON file.
+     *
+     *  \param csFile JSON exportation file
+     *  \param csLast Last exportation structure
+     */
+
+    void cs_export_set_last(
+
+        char      const * const csFile,
+        cs_Last_t const * const csLast
+
+    );
+
+    /*! \brief Threads resources management
+     *
+     *  With a positive count, this function allocates the threads query
+     *  structures and, if the buffers pointer is not NULL, the threads memory
+     *  buffers. The first thread shares the main thread query structures, as
+     *  all the threads do when the poses are read from the pose cache. If
+     *  the resources of a thread can not be created, the threads count is
+     *  reduced accordingly. With a negative count, the function deletes the
+     *  resources created for the opposite count of threads.
+     *
+     *  \param csQuery   Main thread CSPS query structures
+     *  \param csDevice  Devices used to create threads query structures
+     *  \param csLegacy  Legacy double formatting flag
+     *  \param csCount   Number of threads, negative for deletion
+     *  \param csQueries Pointer to threads query structures array
+     *  \param csLocal   Pointer to threads memory buffers array, can be NULL
+     *
+     *  \return Returns the number of threads actually created
+     */
+
+    int cs_export_set_threads(
+
+        cs_Query_t        *  const csQuery,
+        cs_Device_t const *  const csDevice,
+        int                  const csLegacy,
+        int                  const csCount,
+        cs_Query_t        ** const csQueries,
+        cs_Buffer_t       ** const csLocal
+
+    );
+
+    /*! \brief Query structures creation
+     *
+     *  This function creates the CSPS query structures of the provided devices.
+     *  If the camera trigger query structure can not be created, the function
+     *  returns without creating the other structures. If the cache flag is
+     *  set, the pose cache of the CSPS directory is opened first. When it is
+     *  valid and holds the still range of the provided still device, no CSPS
+     *  query structure is created. Otherwise, the queried pose records are
+     *  stored to be exported in the cache by cs_export_query_commit.
+     *
+     *  \param csQuery  Query structures to create
+     *  \param csDevice Devices descriptor
+     *  \param csCache  Pose cache flag
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int cs_export_query_create(
+
+        cs_Query_t        * const csQuery,
+        cs_Device_t const * const csDevice,
+        int                 const csCache
+
+    );
+
+    /*! \brief Query structures deletion
+     *
+     *  This function deletes the CSPS query structures created by the query
+     *  structures creation function, or unmaps the pose cache, and releases
+     *  the pose records not exported in the cache.
+     *
+     *  \param csQuery Query structures to delete
+     */
+
+    void cs_export_query_delete(
+
+        cs_Query_t * const csQuery
+
+    );
+
+    /*! \brief Pose cache commitment
+     *
+     *  This function exports the stored pose records in the pose cache of the
+     *  CSPS directory and releases them. It has to be called only once the
+     *  poses of all the camera triggers have been queried.
+     *
+     *  \param csQuery  Main thread query structures
+     *  \param csDevice Devices descriptor
+     */
+
+    void cs_export_query_commit(
+
+        cs_Query_t        * const csQuery,
+        cs_Device_t const * const csDevice
+
+    );
+
+    /*! \brief Camera trigger timestamp query
+     *
+     *  This function returns the master timestamp of the camera trigger
+     *  pointed by the provided index.
+     *
+     *  \param csQuery  Query structures
+     *  \param csIndex  Camera trigger index
+     *
+     *  \return Returns the camera trigger master timestamp
+     */
+
+    lp_Time_t cs_export_query_master(
+
+        cs_Query_t * const csQuery,
+        long         const csIndex
+
+    );
+
+    /*! \brief Pose query
+     *
+     *  This function performs the CSPS queries of the camera trigger pointed by
+     *  the provided index, or reads its record from the pose cache, and fills
+     *  the pose structure. The queried records are stored for the pose cache
+     *  if needed. The availability flags
+     *  of the position and orientation take into account the query status and
+     *  the validity of the obtained values. If manual position coordinates are
+     *  provided, they replace the queried position.
+     *
+     *  \param csQuery  Query structures
+     *  \param csIndex  Camera trigger index
+     *  \param csForced Manual position coordinates, NULL if not forced
+     *  \param csPose   Pose structure to fill
+     */
+
+    void cs_export_query(
+
+        cs_Query_t       * const csQuery,
+        long               const csIndex,
+        double     const * const csForced,
+        cs_Pose_t        * const csPose
+
+    );
+
+    /*! \brief Forced position analysis
+     *
+     *  This function analyses the manual position coordinates string and
+     *  stores the longitude, latitude and altitude in the provided array.
+     *
+     *  \param csGPSf     GPS manual position coordinates (lon,lat,alt)
+     *  \param csPosition Array receiving the three coordinates
+     *
+     *  \return Returns LC_TRUE if a manual position is given, LC_FALSE otherwise
+     */
+
+    int cs_export_get_forced(
+
+        char   const * const csGPSf,
+        double       * const csPosition
+
+    );
+
+    /*! \brief Poses computation
+     *
+     *  This function queries the poses of all the camera triggers and returns
+     *  them in an allocated array that has to be released by the caller. The
+     *  queries are distributed over the threads by chunks of CS_EXPORT_CHUNK
+     *  poses, each thread using its own query structures.
+     *
+     *  \param csQuery   Main thread CSPS query structures
+     *  \param csDevice  Devices used to create threads query structures
+     *  \param csForced  Manual position coordinates, NULL if not forced
+     *  \param csThreads Number of threads, zero for default
+     *  \param csSize    Pointer to the variable that recieves poses count
+     *
+     *  \return Returns the poses array, NULL pointer on failure
+     */
+
+    cs_Pose_t * cs_export_poses(
+
+        cs_Query_t        * const csQuery,
+        cs_Device_t const * const csDevice,
+        double      const * const csForced,
+        int                 const csThreads,
+        long              * const csSize
+
+    );
+
+    /*! \brief Formats list analysis
+     *
+     *  This function analyses the comma-separated list of exportation formats
+     *  and returns the corresponding formats flags. An empty list selects the
+     *  JSON format.
+     *
+     *  \param csFormat Exportation formats list
+     *
+     *  \return Returns formats flags, zero if an unknown format is found
+     */
+
+    int cs_export_get_format(
+
+        char const * const csFormat
+
+    );
+
+    /*! \brief Formats exportation
+     *
+     *  This function queries the poses of all the camera triggers once and
+     *  exports them in each requested format. If a single format is requested,
+     *  the exportation file path is used as is. Otherwise, the format name is
+     *  appended to the path as extension for each exported file. The JSON
+     *  format considers the previous JSON file if available.
+     *
+     *  \param csQuery   Main thread CSPS query structures
+     *  \param csDevice  Devices used to create threads query structures
+     *  \param csGPSf    GPS manual position coordinates.
+     *  \param csFile    Exportation file path
+     *  \param csFlags   Exportation formats flags
+     *  \param csLegacy  Legacy double formatting flag
+     *  \param csThreads Number of threads, zero for default
+     */
+
+    void cs_export_formats(
+
+        cs_Query_t        * const csQuery,
+        cs_Device_t const * const csDevice,
+        char              * const csGPSf,
+        char              * const csFile,
+        int                 const csFlags,
+        int                 const csLegacy,
+        int                 const csThreads
+
+    );
+
+    /*! \brief JSON poses exportation
+     *
+     *  This function exports the provided poses in the standard JSON format,
+     *  considering the fields of the previous JSON file if available.
+     *
+     *  \param csBuffer Exportation buffer
+     *  \param csPose   Poses array
+     *  \param csSize   Poses count
+     *  \param csForced Manual position flag
+     *  \param csJson   Previous JSON file imported document, can be NULL
+     */
+
+    void cs_export_write_json(
+
+        cs_Buffer_t       * const csBuffer,
+        cs_Pose_t   const * const csPose,
+        long                const csSize,
+        int                 const csForced,
+        cs_Json_t   const * const csJson
+
+    );
+
+    /*! \brief Binary poses exportation
+     *
+     *  This function exports the provided poses in a columnar binary format
+     *  that can be mapped in memory and used without parsing. All values are
+     *  stored least significant byte first. The format starts with a 32 bytes
+     *  header :
+     *
+     *      magic   8 bytes "CSPSPOSE"
+     *      version 4 bytes unsigned integer
+     *      flags   4 bytes unsigned integer (0x01 single, 0x02 gps)
+     *      count   8 bytes unsigned integer, number of poses
+     *      reserved 8 bytes, zero
+     *
+     *  The header is followed by the arrays, each holding count elements :
+     *
+     *      sec         8 bytes unsigned integer
+     *      usec        8 bytes unsigned integer
+     *      position    4 doubles (lon, lat, alt, weak)
+     *      orientation 10 doubles (3x3 frame by rows, weak)
+     *      still       1 byte, 0 or 1
+     *
+     *  and by the position and orientation validity bitmaps, each holding one
+     *  bit per pose, least significant bit first. Invalid positions and
+     *  orientations are also stored as NaN.
+     *
+     *  \param csBuffer Exportation buffer
+     *  \param csPose   Poses array
+     *  \param csSize   Poses count
+     *  \param csForced Manual position flag
+     */
+
+    void cs_export_write_bin(
+
+        cs_Buffer_t       * const csBuffer,
+        cs_Pose_t   const * const csPose,
+        long                const csSize,
+        int                 const csForced
+
+    );
+
+    /*! \brief CSV poses exportation
+     *
+     *  This function exports the provided poses as CSV records, one per pose,
+     *  after the CS_CSV_HEADER columns header. The position and orientation
+     *  columns are left empty when not available.
+     *
+     *  \param csBuffer Exportation buffer
+     *  \param csPose   Poses array
+     *  \param csSize   Poses count
+     */
+
+    void cs_export_write_csv(
+
+        cs_Buffer_t       * const csBuffer,
+        cs_Pose_t   const * const csPose,
+        long                const csSize
+
+    );
+
+    /*! \brief GeoJSON poses exportation
+     *
+     *  This function exports the provided poses as a GeoJSON feature
+     *  collection. Each located pose gives a point feature holding its
+     *  timestamp and still range flag. A line string feature following the
+     *  located poses ends the collection when at least two poses are located.
+     *
+     *  \param csBuffer Exportation buffer
+     *  \param csPose   Poses array
+     *  \param csSize   Poses count
+     */
+
+    void cs_export_write_geojson(
+
+        cs_Buffer_t       * const csBuffer,
+        cs_Pose_t   const * const csPose,
+        long                const csSize
+
+    );
+
+    /*! \brief GeoJSON coordinates exportation
+     *
+     *  This function exports the longitude, latitude and altitude of the
+     *  provided pose as a GeoJSON position array.
+     *
+     *  \param csBuffer Exportation buffer
+     *  \param csPose   Located pose
+     */
+
+    void cs_export_point_geojson(
+
+        cs_Buffer_t       * const csBuffer,
+        cs_Pose_t   const * const csPose
+
+    );
+
+    /*! \brief JSON head exportation
+     *
+     *  This function exports the standard JSON file fields that precede the
+     *  poses array, considering the previous JSON file if available.
+     *
+     *  \param csBuffer Exportation buffer
+     *  \param csJson   Previous JSON file imported document, can be NULL
+     */
+
+    void cs_export_head_json(
+
+        cs_Buffer_t       * const csBuffer,
+        cs_Json_t   const * const csJson
+
+    );
+
+    /*! \brief JSON tail exportation
+     *
+     *  This function exports the standard JSON file fields that follow the
+     *  poses array.
+     *
+     *  \param csBuffer Exportation buffer
+     *  \param csForced Manual position flag
+     *  \param csSignal GPS availability flag
+     */
+
+    void cs_export_tail_json(
+
+        cs_Buffer_t * const csBuffer,
+        int           const csForced,
+        int           const csSignal
+
+    );
+
+    /*! \brief JSON pose exportation
+     *
+     *  This function formats the provided pose as a JSON object in the given
+     *  buffer, considering the raw field of the previous pose if available.
+     *
+     *  \param csBuffer Exportation buffer
+     *  \param csPose   Pose to export
+     *  \param csJson   Previous JSON file imported document
+     *  \param csRaw    Previous pose raw field, can be NULL
+     *  \param csLast   Last pose flag
+     */
+
+    void cs_export_pose_json(
+
+        cs_Buffer_t       * const csBuffer,
+        cs_Pose_t   const * const csPose,
+        cs_Json_t   const * const csJson,
+        cs_Field_t  const * const csRaw,
+        int                 const csLast
 
     );
 
@@ -209,25 +839,46 @@
 
     );
 
-    /*! \brief JSON array search
+    /*! \brief Previous poses indexation
      * 
-     *  This function expects a JSON object containing an array of camera pose
-     *  objects. It searches and return the JSON object that corresponds to the
-     *  camera pose defined by the master timestamp.
+     *  This function creates the index of the poses of the previous JSON file,
+     *  associating the master timestamp of each pose to its position in the
+     *  imported poses arrays. The index has to be deleted by the caller.
+     *
+     *  \param csJson  Previous JSON file imported document, can be NULL
+     *  \param csIndex Index structure to create
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int cs_export_set_index(
+
+        cs_Json_t  const * const csJson,
+        cs_Index_t       * const csIndex
+
+    );
+
+    /*! \brief Previous pose search
+     *
+     *  This function searches the pose of the previous JSON file that
+     *  corresponds to the camera pose defined by the master timestamp, and
+     *  returns its imported raw field.
      *
-     *  As a search is performed, the next search starts at the array index just
-     *  below the last found one for optimization purpose.
+     *  The search is performed in constant time through the index of the
+     *  previous poses, whatever the order of the poses in the previous file.
      *
-     *  \param csArray  JSON object containing a pose objects array
-     *  \param csMaster Master timestamp of searched pose object
+     *  \param csJson   Previous JSON file imported document
+     *  \param csIndex  Index of the previous poses
+     *  \param csMaster Master timestamp of searched pose
      *
-     *  \return Returns the found JSON object, NULL pointer otherwise
+     *  \return Returns the found pose raw field, NULL pointer otherwise
      */
 
-    cs_Object_t * cs_export_get_pose( 
+    cs_Field_t const * cs_export_get_pose(
 
-        cs_Object_t * const csArray, 
-        lp_Time_t     const csMaster 
+        cs_Json_t  const * const csJson,
+        cs_Index_t const * const csIndex,
+        lp_Time_t          const csMaster
 
     );
 
@@ -235,11 +886,10 @@
      * 
      *  This function is designed to simplify JSON field exportation when a
      *  previous version of the JSON file is available. The function considers
-     *  the provided key and checks if a previous field is available in the
-     *  provided JSON object. In this case, the found field value is considered
-     *  for value exportation. Otherwise, the provided value is used. In order
-     *  to force the exportation of the provided value, NULL can be sent as JSON
-     *  object.
+     *  the provided previous field. If it was found in the previous file with
+     *  a boolean or string value, this value is considered for value
+     *  exportation. Otherwise, the provided value is used. In order to force
+     *  the exportation of the provided value, NULL can be sent as field.
      *
      *  The function allows also to give the comma character in case the field
      *  is not the last field of the currently exported JSON object. The comma
@@ -248,8 +898,9 @@
      *  \param csKey    Field key
      *  \param csValue  Field value
      *  \param csComma  Field ending comma
-     *  \param csStream Open exportation file stream
-     *  \param csObject JSON object containing previous field
+     *  \param csBuffer Exportation buffer
+     *  \param csJson   Previous JSON file imported document
+     *  \param csField  Previous field
      */
 
     void cs_export_field( 
@@ -257,8 +908,28 @@
         char        const * const csKey,
         char        const * const csValue,
         char        const * const csComma,
-        FILE              * const csStream,
-        cs_Object_t       * const csObject
+        cs_Buffer_t       * const csBuffer,
+        cs_Json_t   const * const csJson,
+        cs_Field_t  const * const csField
+
+    );
+
+    /*! \brief Vector exportation
+     *
+     *  This function exports the components of the provided vector, one per
+     *  line and separated by commas, as expected in the content of the JSON
+     *  position and orientation arrays.
+     *
+     *  \param csBuffer Exportation buffer
+     *  \param csVector Vector components
+     *  \param csSize   Vector components count
+     */
+
+    void cs_export_vector(
+
+        cs_Buffer_t       * const csBuffer,
+        double      const * const csVector,
+        int                 const csSize
 
     );
 
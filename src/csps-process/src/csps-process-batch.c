@@ -0,0 +1,540 @@
+/*
+ * csps-suite - CSPS library front-end suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include <time.h>
+    # include <glob.h>
+    # include <fcntl.h>
+    # include <dirent.h>
+    # include <unistd.h>
+    # include <sys/stat.h>
+    # include <sys/wait.h>
+    # include "csps-process.h"
+
+/*
+    Source - Jobs list creation
+ */
+
+    cs_Job_t * cs_process_batch_list( 
+
+        char const * const csList, 
+        char const * const csGlob, 
+        long       * const csCount 
+
+    ) {
+
+        /* Returned variables */
+        cs_Job_t * csJobs = NULL;
+
+        /* Parsing variables */
+        long csIndex = 0;
+        long csClean = 0;
+
+        /* Line variables */
+        char csLine[256] = { 0 };
+
+        /* Stream variables */
+        FILE * csStream = NULL;
+
+        /* Glob variables */
+        glob_t csMatch;
+
+        /* Initialise jobs count */
+        * csCount = 0;
+
+        /* Check list file */
+        if ( strlen( csList ) > 0 ) {
+
+            /* Create and check list stream */
+            if ( ( csStream = fopen( csList, "r" ) ) == NULL ) {
+
+                /* Display message */
+                fprintf( LC_ERR, "Error : unable to access %s\n", basename( ( char * ) csList ) );
+
+            } else {
+
+                /* Read list lines */
+                while ( fgets( csLine, sizeof( csLine ), csStream ) != NULL ) {
+
+                    /* Remove trailing line ending and spaces */
+                    for ( csClean = strlen( csLine ) - 1; ( csClean >= 0 ) && ( ( unsigned char ) csLine[csClean] <= ' ' ); csClean -- ) csLine[csClean] = '\0';
+
+                    /* Check line content and append job */
+                    if ( ( csLine[0] != '\0' ) && ( csLine[0] != '#' ) ) cs_process_batch_append( & csJobs, csCount, csLine );
+
+                }
+
+                /* Delete list stream */
+                fclose( csStream );
+
+            }
+
+        }
+
+        /* Check glob pattern */
+        if ( strlen( csGlob ) > 0 ) {
+
+            /* Search pattern matches */
+            if ( glob( csGlob, GLOB_MARK, NULL, & csMatch ) == 0 ) {
+
+                /* Append matching jobs */
+                for ( csIndex = 0; csIndex < csMatch.gl_pathc; csIndex ++ ) cs_process_batch_append( & csJobs, csCount, csMatch.gl_pathv[csIndex] );
+
+            }
+
+            /* Release pattern matches */
+            globfree( & csMatch );
+
+        }
+
+        /* Return jobs array */
+        return( csJobs );
+
+    }
+
+/*
+    Source - Job appending
+ */
+
+    void cs_process_batch_append( 
+
+        cs_Job_t  **       csJobs, 
+        long       * const csCount, 
+        char const * const csPath 
+
+    ) {
+
+        /* Reallocation variables */
+        cs_Job_t * csSwap = NULL;
+
+        /* Path length variables */
+        size_t csLength = 0;
+
+        /* Check directory */
+        if ( lc_file_detect( csPath, LC_DIRECTORY ) == LC_FALSE ) {
+
+            /* Display message */
+            fprintf( LC_ERR, "Warning : ignoring %s, not a directory\n", csPath );
+
+        } else {
+
+            /* Reallocate and check jobs array */
+            if ( ( csSwap = ( cs_Job_t * ) realloc( * csJobs, ( * csCount + 1 ) * sizeof( cs_Job_t ) ) ) == NULL ) {
+
+                /* Display message */
+                fprintf( LC_ERR, "Error : unable to allocate memory\n" );
+
+            } else {
+
+                /* Update jobs array */
+                * csJobs = csSwap;
+
+                /* Initialise job */
+                memset( csSwap + ( * csCount ), 0, sizeof( cs_Job_t ) );
+
+                /* Assign job path */
+                strncpy( csSwap[* csCount].jbPath, csPath, sizeof( csSwap[* csCount].jbPath ) - 1 );
+
+                /* Remove trailing separators */
+                for ( csLength = strlen( csSwap[* csCount].jbPath ); ( csLength > 1 ) && ( csSwap[* csCount].jbPath[csLength - 1] == '/' ); csLength -- ) csSwap[* csCount].jbPath[csLength - 1] = '\0';
+
+                /* Compute job size */
+                csSwap[* csCount].jbSize = cs_process_batch_size( csSwap[* csCount].jbPath );
+
+                /* Update jobs count */
+                ( * csCount ) ++;
+
+            }
+
+        }
+
+    }
+
+/*
+    Source - Directory content size
+ */
+
+    size_t cs_process_batch_size( 
+
+        char const * const csPath 
+
+    ) {
+
+        /* Returned variables */
+        size_t csSize = 0;
+
+        /* Entity path variables */
+        char csEntity[512] = { 0 };
+
+        /* Directory variables */
+        DIR           * csDirect = NULL;
+        struct dirent * csRecord = NULL;
+
+        /* Status variables */
+        struct stat csStat;
+
+        /* Create and check directory handle */
+        if ( ( csDirect = opendir( csPath ) ) == NULL ) return( 0 );
+
+        /* Enumerate directory entities */
+        while ( ( csRecord = readdir( csDirect ) ) != NULL ) {
+
+            /* Ignore current and parent directories */
+            if ( ( strcmp( csRecord->d_name, "." ) == 0 ) || ( strcmp( csRecord->d_name, ".." ) == 0 ) ) continue;
+
+            /* Compose entity path */
+            snprintf( csEntity, sizeof( csEntity ), "%s/%s", csPath, csRecord->d_name );
+
+            /* Query entity status without following links */
+            if ( lstat( csEntity, & csStat ) != 0 ) continue;
+
+            /* Accumulate regular file size or recurse in directory */
+            if ( S_ISREG( csStat.st_mode ) ) {
+
+                /* Accumulate file size */
+                csSize += csStat.st_size;
+
+            } else if ( S_ISDIR( csStat.st_mode ) ) {
+
+                /* Accumulate directory size */
+                csSize += cs_process_batch_size( csEntity );
+
+            }
+
+        }
+
+        /* Delete directory handle */
+        closedir( csDirect );
+
+        /* Return directory content size */
+        return( csSize );
+
+    }
+
+/*
+    Source - Jobs ordering
+ */
+
+    int cs_process_batch_compare( 
+
+        void const * csFirst, 
+        void const * csSecond 
+
+    ) {
+
+        /* Jobs sizes variables */
+        size_t csfSize = ( ( cs_Job_t const * ) csFirst  )->jbSize;
+        size_t cssSize = ( ( cs_Job_t const * ) csSecond )->jbSize;
+
+        /* Return decreasing size order */
+        return( ( csfSize < cssSize ) ? 1 : ( ( csfSize > cssSize ) ? -1 : 0 ) );
+
+    }
+
+/*
+    Source - Processes pool
+ */
+
+    long cs_process_batch( 
+
+        cs_Job_t   * const csJobs, 
+        long         const csCount, 
+        char const * const csTopo, 
+        int          const csPool, 
+        int          const csForce, 
+        int          const csProfile 
+
+    ) {
+
+        /* Failed jobs variables */
+        long csFail = 0;
+
+        /* Jobs parsing variables */
+        long csNext = 0;
+        long csDone = 0;
+        long csScan = 0;
+
+        /* Running processes variables */
+        int csRunning = 0;
+
+        /* Process variables */
+        pid_t csPid = 0;
+
+        /* Process status variables */
+        int csStatus = 0;
+
+        /* Timing variables */
+        double csStart = cs_process_batch_time();
+
+        /* Order jobs by decreasing size */
+        qsort( csJobs, csCount, sizeof( cs_Job_t ), cs_process_batch_compare );
+
+        /* Processes pool */
+        while ( csDone < csCount ) {
+
+            /* Start jobs up to pool size */
+            while ( ( csRunning < csPool ) && ( csNext < csCount ) ) {
+
+                /* Assign job starting time */
+                csJobs[csNext].jbStart = cs_process_batch_time();
+
+                /* Check job necessity */
+                if ( ( csForce == LC_FALSE ) && ( cs_process_stamp_check( csJobs[csNext].jbPath, cs_process_stamp_signature( csJobs[csNext].jbPath, csTopo ) ) == LC_TRUE ) ) {
+
+                    /* Update job status */
+                    csJobs[csNext].jbStatus = EXIT_SUCCESS;
+
+                    /* Update jobs state */
+                    csDone ++;
+
+                    /* Display message */
+                    fprintf( LC_OUT, "[%ld/%ld] %s : Up to date\n", csDone, csCount, csJobs[csNext].jbPath );
+
+                } else {
+
+                    /* Flush standard outputs before fork */
+                    fflush( NULL );
+
+                    /* Create and check job process */
+                    if ( ( csPid = fork() ) < 0 ) {
+
+                        /* Update job status */
+                        csJobs[csNext].jbStatus = CS_BATCH_FAIL;
+
+                        /* Display message */
+                        fprintf( LC_ERR, "Error : unable to start %s processing\n", csJobs[csNext].jbPath );
+
+                        /* Update jobs state */
+                        csFail ++, csDone ++;
+
+                    } else if ( csPid == 0 ) {
+
+                        /* Job process */
+                        cs_process_batch_child( csJobs + csNext, csTopo, csForce, csProfile );
+
+                    } else {
+
+                        /* Assign job process */
+                        csJobs[csNext].jbPid = csPid;
+
+                        /* Update running processes */
+                        csRunning ++;
+
+                    }
+
+                }
+
+                /* Update next job */
+                csNext ++;
+
+            }
+
+            /* Check running processes */
+            if ( csRunning == 0 ) continue;
+
+            /* Wait for process termination */
+            if ( ( csPid = wait( & csStatus ) ) < 0 ) {
+
+                /* Retry on signal interruption */
+                if ( errno == EINTR ) continue;
+
+                /* Display message */
+                fprintf( LC_ERR, "Error : unable to wait for jobs processes\n" );
+
+                /* Parsing jobs */
+                for ( csScan = 0; csScan < csCount; csScan ++ ) {
+
+                    /* Check unfinished job */
+                    if ( ( csJobs[csScan].jbPid == 0 ) && ( csScan < csNext ) ) continue;
+
+                    /* Update job status */
+                    csJobs[csScan].jbStatus = CS_BATCH_FAIL;
+
+                    /* Reset job process */
+                    csJobs[csScan].jbPid = 0;
+
+                    /* Update failed jobs */
+                    csFail ++;
+
+                }
+
+                /* Abort processes pool */
+                break;
+
+            }
+
+            /* Search terminated job */
+            for ( csScan = 0; ( csScan < csNext ) && ( csJobs[csScan].jbPid != csPid ); csScan ++ );
+
+            /* Check terminated job */
+            if ( csScan == csNext ) continue;
+
+            /* Compute job duration */
+            csJobs[csScan].jbTime = cs_process_batch_time() - csJobs[csScan].jbStart;
+
+            /* Assign job status */
+            csJobs[csScan].jbStatus = WIFEXITED( csStatus ) ? WEXITSTATUS( csStatus ) : 128 + WTERMSIG( csStatus );
+
+            /* Reset job process */
+            csJobs[csScan].jbPid = 0;
+
+            /* Update jobs state */
+            csRunning --, csDone ++;
+
+            /* Update failed jobs */
+            if ( csJobs[csScan].jbStatus != EXIT_SUCCESS ) csFail ++;
+
+            /* Display message */
+            fprintf( LC_OUT, "[%ld/%ld] %s : %s (%.1f s)\n", csDone, csCount, csJobs[csScan].jbPath, ( csJobs[csScan].jbStatus == EXIT_SUCCESS ) ? "Done" : "Failed", csJobs[csScan].jbTime );
+
+        }
+
+        /* Display summary */
+        cs_process_batch_summary( csJobs, csCount, cs_process_batch_time() - csStart );
+
+        /* Return failed jobs count */
+        return( csFail );
+
+    }
+
+/*
+    Source - Job process
+ */
+
+    void cs_process_batch_child( 
+
+        cs_Job_t   const * const csJob, 
+        char       const * const csTopo, 
+        int                const csForce, 
+        int                const csProfile 
+
+    ) {
+
+        /* Log file path variables */
+        char csLog[512] = { 0 };
+
+        /* Descriptor variables */
+        int csDesc = -1;
+
+        /* Status variables */
+        int csStatus = EXIT_FAILURE;
+
+        /* Compose log file path */
+        snprintf( csLog, sizeof( csLog ), "%s/" CS_BATCH_LOG, csJob->jbPath );
+
+        /* Create and check log file */
+        if ( ( csDesc = open( csLog, O_WRONLY | O_CREAT | O_TRUNC, 0644 ) ) >= 0 ) {
+
+            /* Redirect standard outputs */
+            dup2( csDesc, STDOUT_FILENO );
+            dup2( csDesc, STDERR_FILENO );
+
+            /* Delete descriptor */
+            close( csDesc );
+
+        }
+
+        /* Process directory */
+        csStatus = cs_process( csJob->jbPath, csTopo, csForce, csProfile );
+
+        /* Flush outputs before exit */
+        fflush( NULL );
+
+        /* Terminate job process */
+        _exit( csStatus );
+
+    }
+
+/*
+    Source - Jobs summary
+ */
+
+    void cs_process_batch_summary( 
+
+        cs_Job_t const * const csJobs, 
+        long             const csCount, 
+        double           const csTime 
+
+    ) {
+
+        /* Parsing variables */
+        long csIndex = 0;
+
+        /* Failed jobs variables */
+        long csFail = 0;
+
+        /* Count failed jobs */
+        for ( csIndex = 0; csIndex < csCount; csIndex ++ ) if ( csJobs[csIndex].jbStatus != EXIT_SUCCESS ) csFail ++;
+
+        /* Display message */
+        fprintf( LC_OUT, "Summary : %ld succeeded, %ld failed in %.1f s\n", csCount - csFail, csFail, csTime );
+
+        /* Display failed jobs */
+        for ( csIndex = 0; csIndex < csCount; csIndex ++ ) {
+
+            /* Check job status */
+            if ( csJobs[csIndex].jbStatus == EXIT_SUCCESS ) continue;
+
+            /* Display message */
+            fprintf( LC_OUT, "    %s : exit code %d, see %s/" CS_BATCH_LOG "\n", csJobs[csIndex].jbPath, csJobs[csIndex].jbStatus, csJobs[csIndex].jbPath );
+
+        }
+
+    }
+
+/*
+    Source - Monotonic time
+ */
+
+    double cs_process_batch_time( void ) {
+
+        /* Time variables */
+        struct timespec csTime;
+
+        /* Query monotonic clock */
+        clock_gettime( CLOCK_MONOTONIC, & csTime );
+
+        /* Return time in seconds */
+        return( ( double ) csTime.tv_sec + ( double ) csTime.tv_nsec * 1e-9 );
+
+    }
+
@@ -0,0 +1,302 @@
+/*
+ * csps-suite - CSPS library front-end suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   csps-process-batch.h
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *   
+     *  Multi-segment processing pool
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __CS_PROCESS_BATCH__
+    # define __CS_PROCESS_BATCH__
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    extern "C" {
+    # endif
+
+/* 
+    Header - Includes
+ */
+
+    # include <stdio.h>
+    # include <stdlib.h>
+    # include <string.h>
+    # include <errno.h>
+    # include <libgen.h>
+    # include <csps-all.h>
+    # include <common-all.h>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define job log file name */
+    # define CS_BATCH_LOG    "csps-process.log"
+
+    /* Define failed job status */
+    # define CS_BATCH_FAIL   -1
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+    /*! \struct cs_Job_struct
+     *  \brief Processing job
+     *
+     *  This structure describes the processing of one CSPS directory in the
+     *  processes pool.
+     *
+     *  \var cs_Job_struct::jbPath
+     *  CSPS directory structure path
+     *  \var cs_Job_struct::jbSize
+     *  Size, in bytes, of the CSPS directory content
+     *  \var cs_Job_struct::jbPid
+     *  Identifier of the process in charge of the job
+     *  \var cs_Job_struct::jbStatus
+     *  Exit code of the job, CS_BATCH_FAIL if it could not be started
+     *  \var cs_Job_struct::jbStart
+     *  Job starting time, in seconds
+     *  \var cs_Job_struct::jbTime
+     *  Job duration, in seconds
+     */
+
+    typedef struct cs_Job_struct {
+
+        char   jbPath[256];
+        size_t jbSize;
+        long   jbPid;
+        int    jbStatus;
+        double jbStart;
+        double jbTime;
+
+    } cs_Job_t;
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Jobs list creation
+     *
+     *  This function creates the list of the CSPS directories to process. The
+     *  directories are read, one per line, from the provided list file, empty
+     *  lines and lines starting with '#' being ignored, and are searched using
+     *  the provided glob pattern. Both sources can be used at once. Only the
+     *  entities that are directories are kept. The function returns an
+     *  allocated array that has to be released by the caller.
+     *
+     *  \param  csList  Path of the directories list file, can be empty
+     *  \param  csGlob  Directories glob pattern, can be empty
+     *  \param  csCount Pointer to the variable that recieves jobs count
+     *
+     *  \return Returns jobs array, NULL pointer if no job is found
+     */
+
+    cs_Job_t * cs_process_batch_list( 
+
+        char const * const csList, 
+        char const * const csGlob, 
+        long       * const csCount 
+
+    );
+
+    /*! \brief Job appending
+     *
+     *  This function appends a job to the provided jobs array, reallocating
+     *  it as needed, if the provided path is an accessible directory.
+     *
+     *  \param  csJobs  Pointer to the jobs array
+     *  \param  csCount Pointer to the jobs count
+     *  \param  csPath  CSPS directory structure path
+     */
+
+    void cs_process_batch_append( 
+
+        cs_Job_t  **       csJobs, 
+        long       * const csCount, 
+        char const * const csPath 
+
+    );
+
+    /*! \brief Directory content size
+     *
+     *  This function returns the size, in bytes, of the regular files found
+     *  in the provided directory and its sub-directories, symbolic links being
+     *  ignored. It is used as an estimation of the processing cost of the CSPS
+     *  directory.
+     *
+     *  \param  csPath Directory path
+     *
+     *  \return Returns the directory content size
+     */
+
+    size_t cs_process_batch_size( 
+
+        char const * const csPath 
+
+    );
+
+    /*! \brief Jobs ordering
+     *
+     *  This function is the comparison function used to sort the jobs by
+     *  decreasing size, so that the largest directories are started first and
+     *  the total processing time is kept short.
+     *
+     *  \param  csFirst  Pointer to the first job
+     *  \param  csSecond Pointer to the second job
+     *
+     *  \return Returns comparison result
+     */
+
+    int cs_process_batch_compare( 
+
+        void const * csFirst, 
+        void const * csSecond 
+
+    );
+
+    /*! \brief Processes pool
+     *
+     *  This function processes the provided jobs using a pool of at most the
+     *  provided count of processes. The jobs are started by decreasing size.
+     *  Each job is processed in a child process that writes its messages in
+     *  the CS_BATCH_LOG file of its CSPS directory. The jobs that are up to
+     *  date are not started, unless processing is forced. The completion of
+     *  each job is displayed as it occurs. The resources profile of each job,
+     *  if requested, is written in its log file. If waiting for the processes
+     *  fails, the unfinished jobs are considered as failed.
+     *
+     *  \param  csJobs    Jobs array
+     *  \param  csCount   Jobs count
+     *  \param  csTopo    CSPS topology file path
+     *  \param  csPool    Maximum number of simultaneous processes
+     *  \param  csForce   Processing forcing flag
+     *  \param  csProfile Profile mode
+     *
+     *  \return Returns the number of failed jobs
+     */
+
+    long cs_process_batch( 
+
+        cs_Job_t   * const csJobs, 
+        long         const csCount, 
+        char const * const csTopo, 
+        int          const csPool, 
+        int          const csForce, 
+        int          const csProfile 
+
+    );
+
+    /*! \brief Job process
+     *
+     *  This function is executed by the child process of a job. It redirects
+     *  the standard outputs to the job log file and processes the CSPS
+     *  directory. It never returns.
+     *
+     *  \param  csJob     Job to process
+     *  \param  csTopo    CSPS topology file path
+     *  \param  csForce   Processing forcing flag
+     *  \param  csProfile Profile mode
+     */
+
+    void cs_process_batch_child( 
+
+        cs_Job_t   const * const csJob, 
+        char       const * const csTopo, 
+        int                const csForce, 
+        int                const csProfile 
+
+    );
+
+    /*! \brief Jobs summary
+     *
+     *  This function displays the summary of the processed jobs : the number
+     *  of succeeded and failed jobs, the total duration and the list of the
+     *  failed jobs with their exit code.
+     *
+     *  \param  csJobs  Jobs array
+     *  \param  csCount Jobs count
+     *  \param  csTime  Total duration, in seconds
+     */
+
+    void cs_process_batch_summary( 
+
+        cs_Job_t const * const csJobs, 
+        long             const csCount, 
+        double           const csTime 
+
+    );
+
+    /*! \brief Monotonic time
+     *
+     *  This function returns the monotonic clock time, in seconds.
+     *
+     *  \return Returns monotonic time
+     */
+
+    double cs_process_batch_time( void );
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    }
+    # endif
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
@@ -0,0 +1,240 @@
+/*
+ * csps-suite - CSPS library front-end suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include <time.h>
+    # include <sys/time.h>
+    # include <sys/resource.h>
+    # include "csps-process.h"
+
+/*
+    Source - Profile mode detection
+ */
+
+    int cs_process_profile_mode( 
+
+        char const * const csMode 
+
+    ) {
+
+        /* Return profile mode */
+        if ( strcmp( csMode, "text" ) == 0 ) return( CS_PROFILE_TEXT );
+        if ( strcmp( csMode, "json" ) == 0 ) return( CS_PROFILE_JSON );
+
+        /* Return unknown mode */
+        return( CS_PROFILE_NONE );
+
+    }
+
+/*
+    Source - Profile snapshot
+ */
+
+    void cs_process_profile_get( 
+
+        cs_Profile_t * const csProfile 
+
+    ) {
+
+        /* Time variables */
+        struct timespec csTime;
+
+        /* Resources usage variables */
+        struct rusage csUsage;
+
+        /* Io statistics variables */
+        char     csKey[32] = { 0 };
+        uint64_t csValue   = 0;
+
+        /* Stream variables */
+        FILE * csStream = NULL;
+
+        /* Initialise snapshot */
+        memset( csProfile, 0, sizeof( cs_Profile_t ) );
+
+        /* Query monotonic clock */
+        clock_gettime( CLOCK_MONOTONIC, & csTime );
+
+        /* Assign wall-clock time */
+        csProfile->pfWall = ( double ) csTime.tv_sec + ( double ) csTime.tv_nsec * 1e-9;
+
+        /* Query resources usage */
+        if ( getrusage( RUSAGE_SELF, & csUsage ) == 0 ) {
+
+            /* Assign CPU times */
+            csProfile->pfUser   = ( double ) csUsage.ru_utime.tv_sec + ( double ) csUsage.ru_utime.tv_usec * 1e-6;
+            csProfile->pfSystem = ( double ) csUsage.ru_stime.tv_sec + ( double ) csUsage.ru_stime.tv_usec * 1e-6;
+
+            /* Assign peak resident set size */
+            csProfile->pfPeak = csUsage.ru_maxrss;
+
+        }
+
+        /* Create and check io statistics stream */
+        if ( ( csStream = fopen( CS_PROFILE_IO, "r" ) ) != NULL ) {
+
+            /* Read io statistics */
+            while ( fscanf( csStream, "%31s %" SCNu64, csKey, & csValue ) == 2 ) {
+
+                /* Assign io statistics */
+                if ( strcmp( csKey, "rchar:"       ) == 0 ) csProfile->pfRchar = csValue;
+                if ( strcmp( csKey, "wchar:"       ) == 0 ) csProfile->pfWchar = csValue;
+                if ( strcmp( csKey, "read_bytes:"  ) == 0 ) csProfile->pfRead  = csValue;
+                if ( strcmp( csKey, "write_bytes:" ) == 0 ) csProfile->pfWrite = csValue;
+
+            }
+
+            /* Delete io statistics stream */
+            fclose( csStream );
+
+        }
+
+    }
+
+/*
+    Source - Profile difference
+ */
+
+    void cs_process_profile_diff( 
+
+        cs_Profile_t const * const csStart, 
+        cs_Profile_t       * const csStop 
+
+    ) {
+
+        /* Compute time differences */
+        csStop->pfWall   -= csStart->pfWall;
+        csStop->pfUser   -= csStart->pfUser;
+        csStop->pfSystem -= csStart->pfSystem;
+
+        /* Compute io differences */
+        csStop->pfRchar  -= csStart->pfRchar;
+        csStop->pfWchar  -= csStart->pfWchar;
+        csStop->pfRead   -= csStart->pfRead;
+        csStop->pfWrite  -= csStart->pfWrite;
+
+    }
+
+/*
+    Source - Profile exportation
+ */
+
+    void cs_process_profile_print( 
+
+        FILE               * const csStream, 
+        char         const * const csPath, 
+        char         const * const csTopo, 
+        cs_Profile_t const * const csProfile, 
+        int                  const csMode 
+
+    ) {
+
+        /* Check profile mode */
+        if ( csMode == CS_PROFILE_TEXT ) {
+
+            /* Display profile */
+            fprintf( csStream, "Profile : %s\n", csPath );
+            fprintf( csStream, "    Wall-clock time : %.3f s\n", csProfile->pfWall );
+            fprintf( csStream, "    CPU time        : %.3f s user, %.3f s system\n", csProfile->pfUser, csProfile->pfSystem );
+            fprintf( csStream, "    Peak memory     : %ld kB\n", csProfile->pfPeak );
+            fprintf( csStream, "    Read            : %" PRIu64 " bytes, %" PRIu64 " from storage\n", csProfile->pfRchar, csProfile->pfRead );
+            fprintf( csStream, "    Written         : %" PRIu64 " bytes, %" PRIu64 " to storage\n", csProfile->pfWchar, csProfile->pfWrite );
+
+        } else if ( csMode == CS_PROFILE_JSON ) {
+
+            /* Export profile */
+            fprintf( csStream, "{\"path\":" );
+            cs_process_profile_string( csStream, csPath );
+            fprintf( csStream, ",\"topology\":" );
+            cs_process_profile_string( csStream, csTopo );
+            fprintf( csStream, ",\"wall\":%.6f,\"user\":%.6f,\"system\":%.6f,\"peak_rss_kb\":%ld", csProfile->pfWall, csProfile->pfUser, csProfile->pfSystem, csProfile->pfPeak );
+            fprintf( csStream, ",\"rchar\":%" PRIu64 ",\"wchar\":%" PRIu64 ",\"read_bytes\":%" PRIu64 ",\"write_bytes\":%" PRIu64 "}\n", csProfile->pfRchar, csProfile->pfWchar, csProfile->pfRead, csProfile->pfWrite );
+
+        }
+
+    }
+
+/*
+    Source - JSON string exportation
+ */
+
+    void cs_process_profile_string( 
+
+        FILE       * const csStream, 
+        char const * const csString 
+
+    ) {
+
+        /* Parsing variables */
+        char const * csChar = csString;
+
+        /* Open string */
+        fputc( '"', csStream );
+
+        /* Export string characters */
+        for ( ; * csChar != '\0'; csChar ++ ) {
+
+            /* Check character */
+            if ( ( * csChar == '"' ) || ( * csChar == '\\' ) ) {
+
+                /* Export escaped character */
+                fprintf( csStream, "\\%c", * csChar );
+
+            } else if ( ( unsigned char ) * csChar < 0x20 ) {
+
+                /* Export control character */
+                fprintf( csStream, "\\u%04x", ( unsigned char ) * csChar );
+
+            } else {
+
+                /* Export character */
+                fputc( * csChar, csStream );
+
+            }
+
+        }
+
+        /* Close string */
+        fputc( '"', csStream );
+
+    }
+
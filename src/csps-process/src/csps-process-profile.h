@@ -0,0 +1,236 @@
+/*
+ * csps-suite - CSPS library front-end suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   csps-process-profile.h
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *   
+     *  Processing resources profile
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __CS_PROCESS_PROFILE__
+    # define __CS_PROCESS_PROFILE__
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    extern "C" {
+    # endif
+
+/* 
+    Header - Includes
+ */
+
+    # include <stdio.h>
+    # include <stdlib.h>
+    # include <string.h>
+    # include <stdint.h>
+    # include <inttypes.h>
+    # include <csps-all.h>
+    # include <common-all.h>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define profile modes */
+    # define CS_PROFILE_NONE 0
+    # define CS_PROFILE_TEXT 1
+    # define CS_PROFILE_JSON 2
+
+    /* Define process io statistics file */
+    # define CS_PROFILE_IO   "/proc/self/io"
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+    /*! \struct cs_Profile_struct
+     *  \brief Resources profile
+     *
+     *  This structure holds a snapshot, or the difference of two snapshots, of
+     *  the resources used by the process.
+     *
+     *  \var cs_Profile_struct::pfWall
+     *  Monotonic wall-clock time, in seconds
+     *  \var cs_Profile_struct::pfUser
+     *  User CPU time, in seconds
+     *  \var cs_Profile_struct::pfSystem
+     *  System CPU time, in seconds
+     *  \var cs_Profile_struct::pfPeak
+     *  Peak resident set size, in kilobytes
+     *  \var cs_Profile_struct::pfRchar
+     *  Bytes read through system calls
+     *  \var cs_Profile_struct::pfWchar
+     *  Bytes written through system calls
+     *  \var cs_Profile_struct::pfRead
+     *  Bytes read from the storage
+     *  \var cs_Profile_struct::pfWrite
+     *  Bytes written to the storage
+     */
+
+    typedef struct cs_Profile_struct {
+
+        double   pfWall;
+        double   pfUser;
+        double   pfSystem;
+        long     pfPeak;
+        uint64_t pfRchar;
+        uint64_t pfWchar;
+        uint64_t pfRead;
+        uint64_t pfWrite;
+
+    } cs_Profile_t;
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Profile mode detection
+     *
+     *  This function converts the provided profile mode string, "text" or
+     *  "json", into its corresponding mode value.
+     *
+     *  \param  csMode Profile mode string
+     *
+     *  \return Returns profile mode, CS_PROFILE_NONE for an unknown mode
+     */
+
+    int cs_process_profile_mode( 
+
+        char const * const csMode 
+
+    );
+
+    /*! \brief Profile snapshot
+     *
+     *  This function takes a snapshot of the resources used by the process
+     *  using the monotonic clock, getrusage and the CS_PROFILE_IO file. The
+     *  io counters are left to zero if the file is not available.
+     *
+     *  \param  csProfile Profile structure that recieves the snapshot
+     */
+
+    void cs_process_profile_get( 
+
+        cs_Profile_t * const csProfile 
+
+    );
+
+    /*! \brief Profile difference
+     *
+     *  This function computes the resources used between the two provided
+     *  snapshots. The peak resident set size is not a cumulative value and
+     *  is taken from the last snapshot.
+     *
+     *  \param  csStart   Starting snapshot
+     *  \param  csStop    Ending snapshot, recieves the difference
+     */
+
+    void cs_process_profile_diff( 
+
+        cs_Profile_t const * const csStart, 
+        cs_Profile_t       * const csStop 
+
+    );
+
+    /*! \brief Profile exportation
+     *
+     *  This function displays the provided profile in the provided stream, as
+     *  a text summary or as a single line JSON object depending on the mode.
+     *
+     *  \param  csStream  Output stream
+     *  \param  csPath    CSPS directory structure path
+     *  \param  csTopo    CSPS topology file path
+     *  \param  csProfile Profile to display
+     *  \param  csMode    Profile mode
+     */
+
+    void cs_process_profile_print( 
+
+        FILE               * const csStream, 
+        char         const * const csPath, 
+        char         const * const csTopo, 
+        cs_Profile_t const * const csProfile, 
+        int                  const csMode 
+
+    );
+
+    /*! \brief JSON string exportation
+     *
+     *  This function writes the provided string in the provided stream as a
+     *  JSON string, escaping quotes, backslashes and control characters.
+     *
+     *  \param  csStream Output stream
+     *  \param  csString String to write
+     */
+
+    void cs_process_profile_string( 
+
+        FILE       * const csStream, 
+        char const * const csString 
+
+    );
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    }
+    # endif
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
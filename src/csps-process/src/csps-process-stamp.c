@@ -0,0 +1,170 @@
+/*
+ * csps-suite - CSPS library front-end suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include <unistd.h>
+    # include "csps-process.h"
+
+/*
+    Source - Processing inputs signature
+ */
+
+    uint64_t cs_process_stamp_signature( 
+
+        char const * const csPath, 
+        char const * const csTopo 
+
+    ) {
+
+        /* Ignored entities variables */
+        char const * csIgnore[] = { CS_STAMP_OUTPUT, CS_BATCH_LOG, NULL };
+
+        /* Signatures variables */
+        uint64_t csdSign = lc_file_signature( csPath, csIgnore );
+        uint64_t cstSign = lc_file_hash_file( csTopo );
+
+        /* Return combined signature */
+        return( lc_file_hash( lc_file_hash( LC_HASH, & csdSign, sizeof( uint64_t ) ), & cstSign, sizeof( uint64_t ) ) );
+
+    }
+
+/*
+    Source - Stamp verification
+ */
+
+    int cs_process_stamp_check( 
+
+        char const * const csPath, 
+        uint64_t     const csSignature 
+
+    ) {
+
+        /* Returned variables */
+        int csValid = LC_FALSE;
+
+        /* Stamp path variables */
+        char csStamp[512] = { 0 };
+
+        /* Stamp content variables */
+        char     csMagic[64] = { 0 };
+        uint64_t csSign = 0;
+
+        /* Stream variables */
+        FILE * csStream = NULL;
+
+        /* Compose stamp path */
+        snprintf( csStamp, sizeof( csStamp ), "%s/" CS_STAMP, csPath );
+
+        /* Create and check stream */
+        if ( ( csStream = fopen( csStamp, "r" ) ) == NULL ) return( LC_FALSE );
+
+        /* Read and check stamp content */
+        if ( fscanf( csStream, "%63s %" SCNx64, csMagic, & csSign ) == 2 ) {
+
+            /* Check stamp magic and signature */
+            if ( ( strcmp( csMagic, CS_STAMP_MAGIC ) == 0 ) && ( csSign == csSignature ) ) csValid = LC_TRUE;
+
+        }
+
+        /* Close stream */
+        fclose( csStream );
+
+        /* Return stamp state */
+        return( csValid );
+
+    }
+
+/*
+    Source - Stamp exportation
+ */
+
+    int cs_process_stamp_write( 
+
+        char const * const csPath, 
+        uint64_t     const csSignature 
+
+    ) {
+
+        /* Stamp path variables */
+        char csStamp[512] = { 0 };
+
+        /* Temporary file path variables */
+        char csTemp[528] = { 0 };
+
+        /* Stream variables */
+        FILE * csStream = NULL;
+
+        /* Compose stamp path */
+        snprintf( csStamp, sizeof( csStamp ), "%s/" CS_STAMP, csPath );
+
+        /* Create and check stream */
+        if ( ( csStream = lc_file_atomic_open( csStamp, csTemp ) ) == NULL ) return( LC_FALSE );
+
+        /* Export stamp content */
+        fprintf( csStream, CS_STAMP_MAGIC "\n%016" PRIx64 "\n", csSignature );
+
+        /* Commit stream */
+        return( lc_file_atomic_close( csStream, csTemp, csStamp, LC_TRUE ) );
+
+    }
+
+/*
+    Source - Stamp removal
+ */
+
+    void cs_process_stamp_remove( 
+
+        char const * const csPath 
+
+    ) {
+
+        /* Stamp path variables */
+        char csStamp[512] = { 0 };
+
+        /* Compose stamp path */
+        snprintf( csStamp, sizeof( csStamp ), "%s/" CS_STAMP, csPath );
+
+        /* Remove stamp file */
+        unlink( csStamp );
+
+    }
+
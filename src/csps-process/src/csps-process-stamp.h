@@ -0,0 +1,188 @@
+/*
+ * csps-suite - CSPS library front-end suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   csps-process-stamp.h
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *   
+     *  Processing up-to-date stamps
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __CS_PROCESS_STAMP__
+    # define __CS_PROCESS_STAMP__
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    extern "C" {
+    # endif
+
+/* 
+    Header - Includes
+ */
+
+    # include <stdio.h>
+    # include <stdlib.h>
+    # include <string.h>
+    # include <stdint.h>
+    # include <inttypes.h>
+    # include <csps-all.h>
+    # include <common-all.h>
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define stamp file name */
+    # define CS_STAMP        ".csps-process.stamp"
+
+    /* Define stamp file magic */
+    # define CS_STAMP_MAGIC  "csps-process-stamp-1"
+
+    /* Define CSPS processing output directory */
+    # define CS_STAMP_OUTPUT "streams"
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Processing inputs signature
+     *
+     *  This function computes the signature of the inputs of the processing
+     *  of the provided CSPS directory. It covers the content of the topology
+     *  file and the size and modification time of every file of the CSPS
+     *  directory, the CSPS processing output directory and the processing log
+     *  file being excluded.
+     *
+     *  \param  csPath CSPS directory structure path
+     *  \param  csTopo CSPS topology file path
+     *
+     *  \return Returns processing inputs signature
+     */
+
+    uint64_t cs_process_stamp_signature( 
+
+        char const * const csPath, 
+        char const * const csTopo 
+
+    );
+
+    /*! \brief Stamp verification
+     *
+     *  This function checks if the stamp file of the provided CSPS directory
+     *  holds the provided signature, indicating that the processing results
+     *  are up to date.
+     *
+     *  \param  csPath      CSPS directory structure path
+     *  \param  csSignature Processing inputs signature
+     *
+     *  \return Returns LC_TRUE if processing is up to date, LC_FALSE otherwise
+     */
+
+    int cs_process_stamp_check( 
+
+        char const * const csPath, 
+        uint64_t     const csSignature 
+
+    );
+
+    /*! \brief Stamp exportation
+     *
+     *  This function writes the provided signature in the stamp file of the
+     *  provided CSPS directory. It has to be called only after a successful
+     *  processing.
+     *
+     *  \param  csPath      CSPS directory structure path
+     *  \param  csSignature Processing inputs signature
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int cs_process_stamp_write( 
+
+        char const * const csPath, 
+        uint64_t     const csSignature 
+
+    );
+
+    /*! \brief Stamp removal
+     *
+     *  This function removes the stamp file of the provided CSPS directory. It
+     *  is called before processing so that an interrupted processing is never
+     *  considered as up to date.
+     *
+     *  \param  csPath CSPS directory structure path
+     */
+
+    void cs_process_stamp_remove( 
+
+        char const * const csPath 
+
+    );
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    }
+    # endif
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
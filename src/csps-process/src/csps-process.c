@@ -53,9 +53,40 @@
         char csPath[256] = { 0 };
         char csTopo[256] = { 0 };
 
+        /* Batch mode variables */
+        char csList[256] = { 0 };
+        char csGlob[256] = { 0 };
+
+        /* Processes pool variables */
+        int csPool = sysconf( _SC_NPROCESSORS_ONLN );
+
+        /* Jobs variables */
+        cs_Job_t * csJobs  = NULL;
+        long       csCount = 0;
+
+        /* Forcing variables */
+        int csForce = LC_FALSE;
+
+        /* Profile variables */
+        char csMode[16] = { 0 };
+        int  csProfile  = CS_PROFILE_NONE;
+
+        /* Returned variables */
+        int csReturn = EXIT_SUCCESS;
+
         /* Search in parameters */
-        lc_stdp( lc_stda( argc, argv, "--path"    , "-p" ), argv, csPath , LC_STRING );
-        lc_stdp( lc_stda( argc, argv, "--topology", "-t" ), argv, csTopo , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--path"    , "-p" ), argv,   csPath , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--topology", "-t" ), argv,   csTopo , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--batch"   , "-b" ), argv,   csList , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--glob"    , "-g" ), argv,   csGlob , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--jobs"    , "-j" ), argv, & csPool , LC_INT    );
+        lc_stdp( lc_stda( argc, argv, "--profile" , "-r" ), argv,   csMode , LC_STRING );
+
+        /* Search in arguments */
+        csForce = lc_stda( argc, argv, "--force", "-f" ) ? LC_TRUE : LC_FALSE;
+
+        /* Detect profile mode */
+        if ( strlen( csMode ) > 0 ) csProfile = cs_process_profile_mode( csMode );
 
         /* Execution switch */
         if ( lc_stda( argc, argv, "--help", "-h" ) || ( argc <= 1 ) ) {
@@ -63,33 +94,168 @@
             /* Display help summary */
             printf( CS_HELP );
 
-        } else {
+        } else if ( ( strlen( csMode ) > 0 ) && ( csProfile == CS_PROFILE_NONE ) ) {
 
-            /* Check processing directory */
-            if ( lc_file_detect( csPath, LC_DIRECTORY ) == LC_TRUE ) {
+            /* Display message */
+            fprintf( LC_ERR, "Error : unknown profile mode %s\n", csMode );
+
+            /* Update returned value */
+            csReturn = EXIT_FAILURE;
+
+        } else if( ( strlen( csList ) > 0 ) || ( strlen( csGlob ) > 0 ) ) {
 
-                /* Check processing topology file */
-                if ( lc_file_detect( csTopo, LC_FILE ) == LC_TRUE ) {
+            /* Check processing topology file */
+            if ( lc_file_detect( csTopo, LC_FILE ) == LC_FALSE ) {
+
+                /* Display message */
+                fprintf( LC_ERR, "Error : unable to access %s file\n", csTopo );
+
+                /* Update returned value */
+                csReturn = EXIT_FAILURE;
+
+            } else {
+
+                /* Create and check jobs list */
+                if ( ( csJobs = cs_process_batch_list( csList, csGlob, & csCount ) ) == NULL ) {
 
                     /* Display message */
-                    fprintf( LC_OUT, "Processing : %s using %s topology ...", basename( csPath ), basename( csTopo ) );
+                    fprintf( LC_ERR, "Error : no CSPS directory to process\n" );
+
+                    /* Update returned value */
+                    csReturn = EXIT_FAILURE;
 
-                    /* CSPS processing */
-                    lp_system( csPath, csTopo );
+                } else {
+
+                    /* Check processes pool size */
+                    if ( csPool < 1 ) csPool = 1;
 
                     /* Display message */
-                    fprintf( LC_OUT, "Done\n" );
+                    fprintf( LC_OUT, "Processing : %ld directories using %s topology on %d processes\n", csCount, basename( csTopo ), csPool );
 
-                /* Display message */
-                } else { fprintf( LC_ERR, "Error : unable to access %s file\n", csTopo ); }
+                    /* Process jobs and check failures */
+                    if ( cs_process_batch( csJobs, csCount, csTopo, csPool, csForce, csProfile )> 0 ) csReturn = EXIT_FAILURE;
 
-            /* Display message */
-            } else { fprintf( LC_ERR, "Error : unable to access %s directory\n", csPath ); }
+                    /* Release jobs list */
+                    free( csJobs );
+
+                }
+
+            }
+
+        } else {
+
+            /* Process directory */
+            csReturn = cs_process( csPath, csTopo, csForce, csProfile );
 
         }
 
         /* Return to system */
-        return( EXIT_SUCCESS );
+        return( csReturn );
+
+    }
+
+/*
+    Source - CSPS directory processing
+ */
+
+    int cs_process( 
+
+        char const * const csPath, 
+        char const * const csTopo, 
+        int          const csForce, 
+        int          const csProfile 
+
+    ) {
+
+        /* Signature variables */
+        uint64_t csSign = 0;
+
+        /* Profile variables */
+        cs_Profile_t csStart;
+        cs_Profile_t csStop;
+
+        /* Messages stream variables */
+        FILE * csMessage = LC_OUT;
+
+        /* Path copies variables */
+        char cspPath[256] = { 0 };
+        char cstPath[256] = { 0 };
+
+        /* Create path copies */
+        strncpy( cspPath, csPath, sizeof( cspPath ) - 1 );
+        strncpy( cstPath, csTopo, sizeof( cstPath ) - 1 );
+
+        /* Keep standard output for json profile only */
+        if ( csProfile == CS_PROFILE_JSON ) csMessage = LC_ERR;
+
+        /* Check processing directory */
+        if ( lc_file_detect( csPath, LC_DIRECTORY ) == LC_TRUE ) {
+
+            /* Check processing topology file */
+            if ( lc_file_detect( csTopo, LC_FILE ) == LC_TRUE ) {
+
+                /* Compute processing inputs signature */
+                csSign = cs_process_stamp_signature( csPath, csTopo );
+
+                /* Check processing necessity */
+                if ( ( csForce == LC_FALSE ) && ( cs_process_stamp_check( csPath, csSign ) == LC_TRUE ) ) {
+
+                    /* Display message */
+                    fprintf( csMessage, "Processing : %s is up to date\n", basename( cspPath ) );
+
+                    /* Return success */
+                    return( EXIT_SUCCESS );
+
+                }
+
+                /* Invalidate previous stamp */
+                cs_process_stamp_remove( csPath );
+
+                /* Display message */
+                fprintf( csMessage, "Processing : %s using %s topology ...", basename( cspPath ), basename( cstPath ) );
+
+                /* Profile snapshot */
+                cs_process_profile_get( & csStart );
+
+                /* CSPS processing */
+                lp_system( csPath, csTopo );
+
+                /* Profile snapshot */
+                cs_process_profile_get( & csStop );
+
+                /* Display message */
+                fprintf( csMessage, "Done\n" );
+
+                /* Display profile */
+                if ( csProfile != CS_PROFILE_NONE ) {
+
+                    /* Compute used resources */
+                    cs_process_profile_diff( & csStart, & csStop );
+
+                    /* Display used resources */
+                    cs_process_profile_print( LC_OUT, csPath, csTopo, & csStop, csProfile );
+
+                }
+
+                /* Update stamp */
+                if ( cs_process_stamp_write( csPath, csSign ) == LC_FALSE ) {
+
+                    /* Display message */
+                    fprintf( LC_ERR, "Warning : unable to write %s stamp\n", basename( cspPath ) );
+
+                }
+
+                /* Return success */
+                return( EXIT_SUCCESS );
+
+            /* Display message */
+            } else { fprintf( LC_ERR, "Error : unable to access %s file\n", csTopo ); }
+
+        /* Display message */
+        } else { fprintf( LC_ERR, "Error : unable to access %s directory\n", csPath ); }
+
+        /* Return failure */
+        return( EXIT_FAILURE );
 
     }
 
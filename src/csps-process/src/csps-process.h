@@ -98,21 +98,31 @@
 
     # include <stdio.h>
     # include <stdlib.h>
+    # include <string.h>
+    # include <unistd.h>
     # include <libgen.h>
     # include <csps-all.h>
     # include <common-all.h>
+    # include "csps-process-batch.h"
+    # include "csps-process-stamp.h"
+    # include "csps-process-profile.h"
 
 /* 
     Header - Preprocessor definitions
  */
 
     /* Standard help */
-    # define CS_HELP "Usage summary :\n\n"            \
-    "\tcsps-process [Arguments] [Parameters] ...\n\n" \
-    "Short arguments and parameters summary :\n\n"    \
-    "\t-p\tCSPS directory structure path\n"           \
-    "\t-t\tCSPS topology file path\n\n"               \
-    "csps-process - csps-suite\n"                     \
+    # define CS_HELP "Usage summary :\n\n"                    \
+    "\tcsps-process [Arguments] [Parameters] ...\n\n"         \
+    "Short arguments and parameters summary :\n\n"            \
+    "\t-p\tCSPS directory structure path\n"                   \
+    "\t-t\tCSPS topology file path\n"                         \
+    "\t-b\tCSPS directories list file path (batch mode)\n"    \
+    "\t-g\tCSPS directories glob pattern (batch mode)\n"      \
+    "\t-j\tNumber of simultaneous processings (batch mode)\n" \
+    "\t-f\tForce processing of up to date directories\n"      \
+    "\t-r\tResources profile display mode (text, json)\n\n"   \
+    "csps-process - csps-suite\n"                             \
     "Copyright (c) 2013-2015 FOXEL SA\n"
 
 /* 
@@ -134,7 +144,9 @@
     /*! \brief Software main function
      *  
      *  The main function, after provided path verification, calls the CSPS
-     *  process on the desired structure using the provided topology file.
+     *  process on the desired structure using the provided topology file. In
+     *  batch mode, the CSPS directories given by the list file and the glob
+     *  pattern are processed using a pool of processes.
      *  
      *  \param  argc Standard main parameter
      *  \param  argv Standard main parameter
@@ -144,6 +156,34 @@
 
     int main ( int argc, char ** argv );
 
+    /*! \brief CSPS directory processing
+     *
+     *  This function verifies the provided paths and calls the CSPS process on
+     *  the desired structure using the provided topology file. The processing
+     *  is skipped if the stamp of the structure indicates that neither its
+     *  logs-files nor the topology changed since the last successful
+     *  processing, unless it is forced. If a profile mode is provided, the
+     *  resources used by the CSPS process are displayed after processing. In
+     *  json profile mode, the processing messages are sent to the standard
+     *  error so that the standard output only carries the json profile.
+     *
+     *  \param  csPath    CSPS directory structure path
+     *  \param  csTopo    CSPS topology file path
+     *  \param  csForce   Processing forcing flag
+     *  \param  csProfile Profile mode
+     *
+     *  \return Returns EXIT_SUCCESS on success, EXIT_FAILURE otherwise
+     */
+
+    int cs_process( 
+
+        char const * const csPath, 
+        char const * const csTopo, 
+        int          const csForce, 
+        int          const csProfile 
+
+    );
+
 /* 
     Header - C/C++ compatibility
  */
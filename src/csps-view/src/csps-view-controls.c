@@ -51,7 +51,9 @@
     extern cs_View_Keyboard_t csKeyboard;
     extern cs_View_Mouse_t    csMouse;
     extern cs_View_List_t     csList;
+    extern cs_View_Survey_t   csSurvey;
     extern cs_View_Path_t     csPath;
+    extern cs_View_Stats_t    csStats;
 
 /*
     Source - Camera position and orientation reset
@@ -51,7 +51,9 @@
     extern cs_View_Keyboard_t csKeyboard;
     extern cs_View_Mouse_t    csMouse;
     extern cs_View_List_t     csList;
+    extern cs_View_Survey_t   csSurvey;
     extern cs_View_Path_t     csPath;
+    extern cs_View_Stats_t    csStats;
 
 /*
     Source - Window reshape callback function
@@ -90,6 +92,9 @@
                 /* Leave software */
                 csKeyboard.kbExit = 1;
 
+                /* Leave main loop */
+                glutLeaveMainLoop();
+
             } break;
 
             case ( 'r' ) : {
@@ -97,6 +102,19 @@
                 /* Reset position */
                 cs_view_controls_reset( CS_VIEW_CONTROLS_RESET, 0.0, 0.0, 0.0 );
 
+                /* Request redisplay */
+                glutPostRedisplay();
+
+            } break;
+
+            case ( 'h' ) : {
+
+                /* Toggle heads-up display */
+                csStats.stShow = ( csStats.stShow == LC_FALSE ) ? LC_TRUE : LC_FALSE;
+
+                /* Request redisplay */
+                glutPostRedisplay();
+
             } break;
 
             case ( 'v' ) : {
@@ -149,6 +167,9 @@
             /* Update position */
             csPosition.psAlt -= csPosition.psVel * ( ( button == 3 ) ? - CS_VIEW_EVENT_VELOCITY_ALTM : + CS_VIEW_EVENT_VELOCITY_ALTM );
 
+            /* Request redisplay */
+            glutPostRedisplay();
+
         } else if ( state == GLUT_UP ) {
 
             /* Clear mode */
@@ -198,5 +219,33 @@
 
         }
 
+        /* Request redisplay */
+        if ( csMouse.msMode != 0 ) glutPostRedisplay();
+
+    }
+
+/*
+    Source - Loading timer callback function
+*/
+
+    void cs_view_event_timer( int value ) {
+
+        /* Request redisplay */
+        glutPostRedisplay();
+
+        /* Rearm timer until loading termination */
+        if ( cs_view_survey_done( & csSurvey ) == LC_FALSE ) glutTimerFunc( CS_VIEW_EVENT_TIMER, cs_view_event_timer, value );
+
+    }
+
+/*
+    Source - Window closure callback function
+*/
+
+    void cs_view_event_close( void ) {
+
+        /* Delete scene */
+        cs_view_scene_compile( CS_FLAG_DELETE );
+
     }
 
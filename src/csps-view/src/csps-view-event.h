@@ -64,6 +64,7 @@
     # include "csps-view-features.h"
     # include "csps-view-scene.h"
     # include "csps-view-controls.h"
+    # include "csps-view-survey.h"
 
 /* 
     Header - Preprocessor definitions
@@ -74,6 +75,9 @@
     # define CS_VIEW_EVENT_VELOCITY_ALTM 1.0
     # define CS_VIEW_EVENT_VELOCITY_MOVE 0.1
 
+    /* Define loading redisplay period, in milliseconds */
+    # define CS_VIEW_EVENT_TIMER         40
+
 /* 
     Header - Preprocessor macros
  */
@@ -134,6 +138,25 @@
 
     void cs_view_event_move ( int x, int y );
 
+    /*! \brief Loading timer callback function
+     *
+     *  This function is called as GLUT timer callback while the survey is
+     *  loaded. It requests a redisplay, so that the loaded chunks are shown,
+     *  and rearms itself until the loading is terminated.
+     *
+     *  \param value Timer value
+     */
+
+    void cs_view_event_timer ( int value );
+
+    /*! \brief Window closure callback function
+     *
+     *  This function is called as GLUT callback when the window is destroyed,
+     *  while its context is still current, to delete the scene.
+     */
+
+    void cs_view_event_close ( void );
+
 /* 
     Header - C/C++ compatibility
  */
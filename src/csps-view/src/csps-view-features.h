@@ -66,12 +66,17 @@
     # include <stdlib.h>
     # include <unistd.h>
     # include <math.h>
+    # include <string.h>
     # include <libgen.h>
+    # include <time.h>
+    # include <pthread.h>
 
     /* OpenGL includes */
+    # define GL_GLEXT_PROTOTYPES
     # include <GL/gl.h>
     # include <GL/glu.h>
-    # include <GL/glut.h>
+    # include <GL/glx.h>
+    # include <GL/freeglut.h>
 
     /* CSPS includes */
     # include <csps-all.h>
@@ -87,6 +92,13 @@
     # define CS_FLAG_CREATE 0
     # define CS_FLAG_DELETE 1
 
+    /* Define track rendering modes */
+    # define CS_MODE_BUFFER 0
+    # define CS_MODE_LIST   1
+
+    /* Define track levels of detail count */
+    # define CS_LEVELS      6
+
     /* Define pi constant */
     # define CS_PI          3.1415926535
 
@@ -180,7 +192,8 @@
      *  This structure stores information about OpenGL display lists.
      *
      *  \var cs_View_List_struct::lsTrack
-     *  Display list index of camera position and orientation
+     *  Display list index of the first segment camera positions and
+     *  orientations, each segment using the following index
      */
 
     typedef struct cs_View_List_struct {
@@ -189,14 +202,246 @@
 
     } cs_View_List_t;
 
+    /*! \struct cs_View_Pose_struct
+     *  \brief Camera pose structure
+     *
+     *  This structure stores the position of the camera at a record, relative
+     *  to the first valid position of the track, and the extremities of its
+     *  orientation frame vectors.
+     *
+     *  \var cs_View_Pose_struct::poPoint
+     *  Camera position
+     *  \var cs_View_Pose_struct::poFrame
+     *  Extremities of the x, y and z frame vectors
+     */
+
+    typedef struct cs_View_Pose_struct {
+
+        GLfloat poPoint[3];
+        GLfloat poFrame[9];
+
+    } cs_View_Pose_t;
+
+    /*! \struct cs_View_Chunk_struct
+     *  \brief Track chunk structure
+     *
+     *  This structure describes a contiguous portion of the track through its
+     *  bounding box and the ranges of the vertex buffer holding its geometry
+     *  at each level of detail.
+     *
+     *  \var cs_View_Chunk_struct::ckMin
+     *  Bounding box minimum corner
+     *  \var cs_View_Chunk_struct::ckMax
+     *  Bounding box maximum corner
+     *  \var cs_View_Chunk_struct::ckFirst
+     *  Index of the first vertex of each level
+     *  \var cs_View_Chunk_struct::ckCount
+     *  Number of vertices of each level
+     */
+
+    typedef struct cs_View_Chunk_struct {
+
+        GLfloat ckMin[3];
+        GLfloat ckMax[3];
+        GLint   ckFirst[CS_LEVELS];
+        GLsizei ckCount[CS_LEVELS];
+
+    } cs_View_Chunk_t;
+
+    /*! \struct cs_View_Track_struct
+     *  \brief Track vertex buffer structure
+     *
+     *  This structure stores the track geometry as an interleaved array of
+     *  float vertices, each made of a position, relative to the first valid
+     *  position of the track, followed by a color. The array starts with the
+     *  ground quad and the referential frame lines, followed by the lines of
+     *  each chunk of the track at each level of detail. The poses are loaded
+     *  by a worker thread in the poses array, the chunks being built and
+     *  uploaded by the rendering thread as the poses become available.
+     *
+     *  \var cs_View_Track_struct::tkPath
+     *  CSPS structure path of the segment
+     *  \var cs_View_Track_struct::tkMode
+     *  Track rendering mode, CS_MODE_BUFFER or CS_MODE_LIST
+     *  \var cs_View_Track_struct::tkBuffer
+     *  OpenGL vertex buffer object name
+     *  \var cs_View_Track_struct::tkData
+     *  Interleaved vertices array, released after upload
+     *  \var cs_View_Track_struct::tkSize
+     *  Number of vertices stored in the array
+     *  \var cs_View_Track_struct::tkAlloc
+     *  Number of vertices allocated in the array
+     *  \var cs_View_Track_struct::tkChunk
+     *  Track chunks array
+     *  \var cs_View_Track_struct::tkChunks
+     *  Number of track chunks
+     *  \var cs_View_Track_struct::tkThread
+     *  Loading worker thread
+     *  \var cs_View_Track_struct::tkMutex
+     *  Loading state mutex, protecting tkLoad, tkCancel, tkPose, tkPoses,
+     *  tkRecords and tkParsed
+     *  \var cs_View_Track_struct::tkLoad
+     *  Loading state
+     *  \var cs_View_Track_struct::tkCancel
+     *  Loading cancellation flag
+     *  \var cs_View_Track_struct::tkPose
+     *  Loaded poses array
+     *  \var cs_View_Track_struct::tkPoses
+     *  Number of loaded poses
+     *  \var cs_View_Track_struct::tkRecords
+     *  Number of camera records to load
+     *  \var cs_View_Track_struct::tkParsed
+     *  Number of camera records already parsed by the loading worker
+     *  \var cs_View_Track_struct::tkUpload
+     *  Number of vertices uploaded in the vertex buffer object
+     *  \var cs_View_Track_struct::tkCapacity
+     *  Number of vertices allocated in the vertex buffer object
+     *  \var cs_View_Track_struct::tkList
+     *  Number of vertices compiled in display list
+     *  \var cs_View_Track_struct::tkMin
+     *  Track positions minimums
+     *  \var cs_View_Track_struct::tkMax
+     *  Track positions maximums
+     *  \var cs_View_Track_struct::tkBound
+     *  Extremums availability flag
+     *  \var cs_View_Track_struct::tkOrigin
+     *  Cartesian coordinates, in meters, of the first valid position of the
+     *  track, written by the loading worker before the first poses are
+     *  published
+     *  \var cs_View_Track_struct::tkMean
+     *  Mean of the first loaded positions
+     */
+
+    typedef struct cs_View_Track_struct {
+
+        char              tkPath[256];
+        int               tkMode;
+        GLuint            tkBuffer;
+        GLfloat         * tkData;
+        GLsizei           tkSize;
+        GLsizei           tkAlloc;
+        cs_View_Chunk_t * tkChunk;
+        GLsizei           tkChunks;
+        pthread_t         tkThread;
+        pthread_mutex_t   tkMutex;
+        int               tkLoad;
+        int               tkCancel;
+        cs_View_Pose_t  * tkPose;
+        GLsizei           tkPoses;
+        GLsizei           tkRecords;
+        GLsizei           tkParsed;
+        GLsizei           tkUpload;
+        GLsizei           tkCapacity;
+        GLsizei           tkList;
+        GLfloat           tkMin[3];
+        GLfloat           tkMax[3];
+        int               tkBound;
+        double            tkOrigin[3];
+        double            tkMean[3];
+
+    } cs_View_Track_t;
+
+    /*! \struct cs_View_Survey_struct
+     *  \brief Survey segments structure
+     *
+     *  This structure stores the tracks of the segments displayed together.
+     *  Each track holds its geometry relatively to its own origin, in its own
+     *  vertex buffer. The scene coordinates are relative to the origin of the
+     *  first track providing poses, the anchor track, so that the camera and
+     *  the tracks keep their precision wherever the segments are located.
+     *
+     *  \var cs_View_Survey_struct::svMode
+     *  Tracks rendering mode, CS_MODE_BUFFER or CS_MODE_LIST
+     *  \var cs_View_Survey_struct::svTrack
+     *  Segments tracks array
+     *  \var cs_View_Survey_struct::svCount
+     *  Number of segments
+     *  \var cs_View_Survey_struct::svAnchor
+     *  Index of the anchor track, negative until a track provides poses
+     *  \var cs_View_Survey_struct::svOrigin
+     *  Origin of the scene, in meters, being the origin of the anchor track
+     *  \var cs_View_Survey_struct::svMin
+     *  Survey positions minimums, in scene coordinates
+     *  \var cs_View_Survey_struct::svMax
+     *  Survey positions maximums, in scene coordinates
+     */
+
+    typedef struct cs_View_Survey_struct {
+
+        int               svMode;
+        cs_View_Track_t * svTrack;
+        int               svCount;
+        int               svAnchor;
+        double            svOrigin[3];
+        double            svMin[3];
+        double            svMax[3];
+
+    } cs_View_Survey_t;
+
+    /*! \struct cs_View_Stats_struct
+     *  \brief Rendering statistics structure
+     *
+     *  This structure stores the timings and drawing statistics of the last
+     *  rendered frame, displayed by the heads-up display.
+     *
+     *  \var cs_View_Stats_struct::stShow
+     *  Heads-up display flag
+     *  \var cs_View_Stats_struct::stTimer
+     *  Timer queries availability flag
+     *  \var cs_View_Stats_struct::stQuery
+     *  Timer queries names, used alternately by successive frames
+     *  \var cs_View_Stats_struct::stFrame
+     *  Number of measured frames
+     *  \var cs_View_Stats_struct::stBegin
+     *  Frame begining time, in seconds
+     *  \var cs_View_Stats_struct::stCPU
+     *  Frame CPU time, in milliseconds
+     *  \var cs_View_Stats_struct::stGPU
+     *  Frame GPU time, in milliseconds, negative if not available
+     *  \var cs_View_Stats_struct::stVertices
+     *  Number of track vertices drawn
+     *  \var cs_View_Stats_struct::stChunks
+     *  Number of track chunks drawn
+     *  \var cs_View_Stats_struct::stLevels
+     *  Sum of the levels of detail of the drawn chunks
+     *  \var cs_View_Stats_struct::stLevel
+     *  Coarsest level of detail drawn
+     *  \var cs_View_Stats_struct::stParsed
+     *  Number of camera records parsed by the loading worker
+     *  \var cs_View_Stats_struct::stRecords
+     *  Number of camera records to load
+     *  \var cs_View_Stats_struct::stSegments
+     *  Number of segments of the survey
+     *  \var cs_View_Stats_struct::stVisible
+     *  Number of segments drawn, the others being outside the view frustum
+     */
+
+    typedef struct cs_View_Stats_struct {
+
+        int     stShow;
+        int     stTimer;
+        GLuint  stQuery[2];
+        long    stFrame;
+        double  stBegin;
+        double  stCPU;
+        double  stGPU;
+        long    stVertices;
+        long    stChunks;
+        long    stLevels;
+        int     stLevel;
+        GLsizei stParsed;
+        GLsizei stRecords;
+        int     stSegments;
+        int     stVisible;
+
+    } cs_View_Stats_t;
+
     /*! \struct cs_View_Path_struct 
      *  \brief Path storage structure
      *
      *  This structure stores information path used to import camera position
      *  and orientation at each record.
      *
-     *  \var cs_View_Path_struct::ptRoot
-     *  CSPS structure to display segment path
      *  \var cs_View_Path_struct::ptCAMm
      *  Stream initiator module to consider for camera record
      *  \var cs_View_Path_struct::ptGPSm
@@ -213,7 +458,6 @@
 
     typedef struct cs_View_Path_struct {
 
-        char ptRoot[256];
         char ptCAMm[256];
         char ptGPSm[256];
         char ptIMUm[256];
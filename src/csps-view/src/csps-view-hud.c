@@ -0,0 +1,299 @@
+/*
+ * csps-suite - CSPS library front-end suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "csps-view-hud.h"
+
+/* 
+    Source - Global variables (GLUT!)
+ */
+
+    extern cs_View_Position_t csPosition;
+    extern cs_View_Keyboard_t csKeyboard;
+    extern cs_View_Mouse_t    csMouse;
+    extern cs_View_List_t     csList;
+    extern cs_View_Survey_t   csSurvey;
+    extern cs_View_Path_t     csPath;
+    extern cs_View_Stats_t    csStats;
+
+/*
+    Source - Statistics creation
+ */
+
+    void cs_view_hud_create( void ) {
+
+        /* Version variables */
+        int csMajor = 0, csMinor = 0;
+
+        /* Version and extensions strings variables */
+        char const * csVersion   = ( char const * ) glGetString( GL_VERSION    );
+        char const * csExtension = ( char const * ) glGetString( GL_EXTENSIONS );
+
+        /* Reset frame statistics */
+        csStats.stFrame = 0;
+        csStats.stCPU   = 0.0;
+        csStats.stGPU   = -1.0;
+
+        /* Read version */
+        if ( csVersion != NULL ) sscanf( csVersion, "%d.%d", & csMajor, & csMinor );
+
+        /* Check timer queries availability */
+        csStats.stTimer = ( ( csMajor > 3 ) || ( ( csMajor == 3 ) && ( csMinor >= 3 ) ) || ( ( csExtension != NULL ) && ( strstr( csExtension, "GL_ARB_timer_query" ) != NULL ) ) ) ? LC_TRUE : LC_FALSE;
+
+        /* Create timer queries */
+        if ( csStats.stTimer == LC_TRUE ) glGenQueries( 2, csStats.stQuery );
+
+    }
+
+/*
+    Source - Statistics deletion
+ */
+
+    void cs_view_hud_delete( void ) {
+
+        /* Check timer queries */
+        if ( csStats.stTimer == LC_TRUE ) {
+
+            /* Delete timer queries */
+            glDeleteQueries( 2, csStats.stQuery );
+
+            /* Update timer queries availability */
+            csStats.stTimer = LC_FALSE;
+
+        }
+
+    }
+
+/*
+    Source - Monotonic time
+ */
+
+    double cs_view_hud_time( void ) {
+
+        /* Time variables */
+        struct timespec csTime;
+
+        /* Query monotonic clock */
+        clock_gettime( CLOCK_MONOTONIC, & csTime );
+
+        /* Return time */
+        return( csTime.tv_sec + csTime.tv_nsec * 1e-9 );
+
+    }
+
+/*
+    Source - Frame measure begining
+ */
+
+    void cs_view_hud_begin( void ) {
+
+        /* Reset drawing statistics */
+        csStats.stVertices = 0;
+        csStats.stChunks   = 0;
+        csStats.stLevels   = 0;
+        csStats.stLevel    = 0;
+
+        /* Memorize frame begining */
+        csStats.stBegin = cs_view_hud_time();
+
+        /* Start timer query */
+        if ( csStats.stTimer == LC_TRUE ) glBeginQuery( GL_TIME_ELAPSED, csStats.stQuery[csStats.stFrame & 1] );
+
+    }
+
+/*
+    Source - Frame measure end
+ */
+
+    void cs_view_hud_end( void ) {
+
+        /* Query result variables */
+        GLint    csAvailable = GL_FALSE;
+        GLuint64 csElapsed   = 0;
+
+        /* Check timer queries */
+        if ( csStats.stTimer == LC_TRUE ) {
+
+            /* End timer query */
+            glEndQuery( GL_TIME_ELAPSED );
+
+            /* Check previous frame query */
+            if ( csStats.stFrame > 0 ) {
+
+                /* Check previous frame query result availability */
+                glGetQueryObjectiv( csStats.stQuery[( csStats.stFrame + 1 ) & 1], GL_QUERY_RESULT_AVAILABLE, & csAvailable );
+
+                /* Check availability */
+                if ( csAvailable == GL_TRUE ) {
+
+                    /* Read previous frame GPU time */
+                    glGetQueryObjectui64v( csStats.stQuery[( csStats.stFrame + 1 ) & 1], GL_QUERY_RESULT, & csElapsed );
+
+                    /* Assign GPU time */
+                    csStats.stGPU = csElapsed * 1e-6;
+
+                }
+
+            }
+
+        }
+
+        /* Compute CPU time */
+        csStats.stCPU = ( cs_view_hud_time() - csStats.stBegin ) * 1e3;
+
+        /* Update frames count */
+        csStats.stFrame ++;
+
+    }
+
+/*
+    Source - Chunk drawing statistics
+ */
+
+    void cs_view_hud_chunk( int const csLevel, GLsizei const csCount ) {
+
+        /* Accumulate chunk statistics */
+        csStats.stVertices += csCount;
+        csStats.stChunks   += 1;
+        csStats.stLevels   += csLevel;
+
+        /* Update coarsest level */
+        if ( csLevel > csStats.stLevel ) csStats.stLevel = csLevel;
+
+    }
+
+/*
+    Source - Heads-up display drawing
+ */
+
+    void cs_view_hud_draw( void ) {
+
+        /* Text lines variables */
+        char csLine[5][128] = { { 0 } };
+
+        /* Viewport variables */
+        GLint csViewport[4] = { 0 };
+
+        /* Parsing variables */
+        int csParse = 0;
+
+        /* Check heads-up display */
+        if ( csStats.stShow == LC_FALSE ) return;
+
+        /* Compose frame times line */
+        if ( csStats.stGPU < 0.0 ) {
+
+            /* Compose line without GPU time */
+            snprintf( csLine[0], sizeof( csLine[0] ), "Frame    : %.2f ms CPU, GPU n/a", csStats.stCPU );
+
+        } else {
+
+            /* Compose line with GPU time */
+            snprintf( csLine[0], sizeof( csLine[0] ), "Frame    : %.2f ms CPU, %.2f ms GPU", csStats.stCPU, csStats.stGPU );
+
+        }
+
+        /* Compose drawing lines */
+        snprintf( csLine[1], sizeof( csLine[1] ), "Vertices : %ld in %ld chunks", csStats.stVertices, csStats.stChunks );
+        snprintf( csLine[2], sizeof( csLine[2] ), "Level    : %.2f mean, %d coarsest", ( csStats.stChunks > 0 ) ? ( double ) csStats.stLevels / csStats.stChunks : 0.0, csStats.stLevel );
+
+        /* Compose culling line */
+        snprintf( csLine[3], sizeof( csLine[3] ), "Segments : %d of %d drawn", csStats.stVisible, csStats.stSegments );
+
+        /* Compose loading line */
+        snprintf( csLine[4], sizeof( csLine[4] ), "Loading  : %.1f %% of %d records", ( csStats.stRecords > 0 ) ? 100.0 * csStats.stParsed / csStats.stRecords : 0.0, csStats.stRecords );
+
+        /* Query viewport */
+        glGetIntegerv( GL_VIEWPORT, csViewport );
+
+        /* Save enable and color states */
+        glPushAttrib( GL_ENABLE_BIT | GL_CURRENT_BIT );
+
+        /* Disable depth test */
+        glDisable( GL_DEPTH_TEST );
+
+        /* Update matrix mode */
+        glMatrixMode( GL_PROJECTION );
+
+        /* Save and reset matrix */
+        glPushMatrix();
+        glLoadIdentity();
+
+        /* Compute pixel projection matrix */
+        gluOrtho2D( 0.0, csViewport[2], 0.0, csViewport[3] );
+
+        /* Update matrix mode */
+        glMatrixMode( GL_MODELVIEW );
+
+        /* Save and reset matrix */
+        glPushMatrix();
+        glLoadIdentity();
+
+        /* Update text color */
+        glColor3f( 0.0, 0.0, 0.0 );
+
+        /* Draw text lines from the top-left corner */
+        for ( csParse = 0; csParse < 5; csParse ++ ) {
+
+            /* Update raster position */
+            glRasterPos2i( CS_VIEW_HUD_MARGIN, csViewport[3] - CS_VIEW_HUD_MARGIN - ( csParse + 1 ) * CS_VIEW_HUD_LINE );
+
+            /* Draw text line */
+            glutBitmapString( CS_VIEW_HUD_FONT, ( unsigned char const * ) csLine[csParse] );
+
+        }
+
+        /* Restore modelview matrix */
+        glPopMatrix();
+
+        /* Restore projection matrix */
+        glMatrixMode( GL_PROJECTION );
+        glPopMatrix();
+
+        /* Restore matrix mode */
+        glMatrixMode( GL_MODELVIEW );
+
+        /* Restore enable and color states */
+        glPopAttrib();
+
+    }
+
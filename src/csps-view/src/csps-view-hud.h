@@ -0,0 +1,169 @@
+/*
+ * csps-suite - CSPS library front-end suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   csps-view-hud.h
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *   
+     *  Heads-up display and rendering statistics
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __CS_VIEW_HUD__
+    # define __CS_VIEW_HUD__
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    extern "C" {
+    # endif
+
+/* 
+    Header - Includes
+ */
+
+    # include "csps-view-features.h"
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define heads-up display font and line height, in pixels */
+    # define CS_VIEW_HUD_FONT   GLUT_BITMAP_8_BY_13
+    # define CS_VIEW_HUD_LINE   16
+
+    /* Define heads-up display margin, in pixels */
+    # define CS_VIEW_HUD_MARGIN 12
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Statistics creation
+     *  
+     *  This function checks the availability of the OpenGL timer queries,
+     *  provided by OpenGL 3.3 or by the ARB timer query extension, and
+     *  creates the timer queries used to measure the frames GPU time.
+     */
+
+    void cs_view_hud_create ( void );
+
+    /*! \brief Statistics deletion
+     *  
+     *  This function deletes the timer queries created by the statistics
+     *  creation function.
+     */
+
+    void cs_view_hud_delete ( void );
+
+    /*! \brief Monotonic time
+     *  
+     *  This function returns the time of the system monotonic clock.
+     *
+     *  \return Returns time, in seconds
+     */
+
+    double cs_view_hud_time ( void );
+
+    /*! \brief Frame measure begining
+     *  
+     *  This function starts the measure of a frame : it resets the drawing
+     *  statistics, memorizes the CPU time and starts the GPU timer query.
+     */
+
+    void cs_view_hud_begin ( void );
+
+    /*! \brief Frame measure end
+     *  
+     *  This function terminates the measure of a frame. The CPU time of the
+     *  frame is computed and the GPU timer query is ended. As waiting for the
+     *  result would stall the pipeline, the GPU time is read from the query of
+     *  the previous frame, if available.
+     */
+
+    void cs_view_hud_end ( void );
+
+    /*! \brief Chunk drawing statistics
+     *  
+     *  This function accumulates the statistics of a drawn track chunk.
+     *  
+     *  \param csLevel  Level of detail of the drawn chunk
+     *  \param csCount  Number of vertices drawn
+     */
+
+    void cs_view_hud_chunk ( int const csLevel, GLsizei const csCount );
+
+    /*! \brief Heads-up display drawing
+     *  
+     *  This function draws, if enabled, the statistics of the last frame over
+     *  the scene : CPU and GPU frame times, drawn vertices and chunks, levels
+     *  of detail, drawn segments and survey loading progress.
+     */
+
+    void cs_view_hud_draw ( void );
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    }
+    # endif
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
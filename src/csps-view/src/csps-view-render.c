@@ -0,0 +1,771 @@
+/*
+ * csps-suite - CSPS library front-end suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "csps-view-render.h"
+
+/* 
+    Source - Global variables (GLUT!)
+ */
+
+    extern cs_View_Position_t csPosition;
+    extern cs_View_Keyboard_t csKeyboard;
+    extern cs_View_Mouse_t    csMouse;
+    extern cs_View_List_t     csList;
+    extern cs_View_Survey_t   csSurvey;
+    extern cs_View_Path_t     csPath;
+    extern cs_View_Stats_t    csStats;
+
+/*
+    Source - Camera preset detection
+ */
+
+    int cs_view_render_camera( char const * const csName ) {
+
+        /* Return camera preset */
+        if ( strcmp( csName, "top"     ) == 0 ) return( CS_VIEW_RENDER_TOP     );
+        if ( strcmp( csName, "oblique" ) == 0 ) return( CS_VIEW_RENDER_OBLIQUE );
+        if ( strcmp( csName, "front"   ) == 0 ) return( CS_VIEW_RENDER_FRONT   );
+
+        /* Return unknown preset */
+        return( CS_VIEW_RENDER_NONE );
+
+    }
+
+/*
+    Source - Headless rendering
+ */
+
+    int cs_view_render( char const * const csImage, char const * const csList, int const csWidth, int const csHeight, int const csCamera ) {
+
+    # ifdef __HEADLESS__
+
+        /* Returned variables */
+        int csReturn = LC_TRUE;
+
+        /* Offscreen rendering context variables */
+        cs_View_Render_t csRender;
+
+        /* Line variables */
+        char csLine[1024] = { 0 };
+
+        /* List entry variables */
+        char csSegment[256] = { 0 };
+        char csOutput [256] = { 0 };
+
+        /* Stream variables */
+        FILE * csStream = NULL;
+
+        /* Create and check offscreen context */
+        if ( cs_view_render_create( & csRender, csWidth, csHeight ) == LC_FALSE ) return( LC_FALSE );
+
+        /* Check list file */
+        if ( strlen( csList ) == 0 ) {
+
+            /* Render segment */
+            csReturn = cs_view_render_segment( & csRender, NULL, csImage, csCamera );
+
+        } else {
+
+            /* Create and check list stream */
+            if ( ( csStream = fopen( csList, "r" ) ) == NULL ) {
+
+                /* Display message */
+                fprintf( LC_ERR, "Error : unable to access %s\n", basename( ( char * ) csList ) );
+
+                /* Update status */
+                csReturn = LC_FALSE;
+
+            } else {
+
+                /* Read list lines */
+                while ( fgets( csLine, sizeof( csLine ), csStream ) != NULL ) {
+
+                    /* Read and check line entries */
+                    if ( ( sscanf( csLine, "%255s %255s", csSegment, csOutput ) != 2 ) || ( csSegment[0] == '#' ) ) continue;
+
+                    /* Render segment */
+                    if ( cs_view_render_segment( & csRender, csSegment, csOutput, csCamera ) == LC_FALSE ) csReturn = LC_FALSE;
+
+                }
+
+                /* Delete list stream */
+                fclose( csStream );
+
+            }
+
+        }
+
+        /* Delete offscreen context */
+        cs_view_render_delete( & csRender );
+
+        /* Send message */
+        return( csReturn );
+
+    # else
+
+        /* Display message */
+        fprintf( LC_ERR, "Error : headless rendering not available in this build (make HEADLESS=true)\n" );
+
+        /* Send message */
+        return( LC_FALSE );
+
+    # endif
+
+    }
+
+/*
+    Source - Headless rendering benchmark
+ */
+
+    int cs_view_render_bench( int const csWidth, int const csHeight ) {
+
+    # ifdef __HEADLESS__
+
+        /* Returned variables */
+        int csReturn = LC_TRUE;
+
+        /* Offscreen rendering context variables */
+        cs_View_Render_t csRender;
+
+        /* Frame times variables */
+        double * csCPU = NULL;
+        double * csGPU = NULL;
+        int      csGPUs = 0;
+
+        /* Frame variables */
+        int csFrame = 0;
+
+        /* Timing variables */
+        double csStart = 0.0;
+        double csLoad  = 0.0;
+
+        /* Drawing statistics variables */
+        double csVertices = 0.0;
+
+        /* Create and check offscreen context */
+        if ( cs_view_render_create( & csRender, csWidth, csHeight ) == LC_FALSE ) return( LC_FALSE );
+
+        /* Allocate and check frame times arrays */
+        if ( ( ( csCPU = ( double * ) malloc( CS_VIEW_RENDER_BENCH * sizeof( double ) ) ) == NULL ) || ( ( csGPU = ( double * ) malloc( CS_VIEW_RENDER_BENCH * sizeof( double ) ) ) == NULL ) ) {
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : unable to allocate benchmark memory\n" );
+
+            /* Update status */
+            csReturn = LC_FALSE;
+
+        } else {
+
+            /* Memorize loading begining */
+            csStart = cs_view_hud_time();
+
+            /* Load segment */
+            if ( ( csReturn = cs_view_render_load( NULL ) ) == LC_TRUE ) {
+
+                /* Compute loading time */
+                csLoad = ( cs_view_hud_time() - csStart ) * 1e3;
+
+                /* Benchmark frames, warm-up frames included */
+                for ( csFrame = - CS_VIEW_RENDER_WARMUP; csFrame < CS_VIEW_RENDER_BENCH; csFrame ++ ) {
+
+                    /* Set camera along path */
+                    cs_view_render_path( ( csFrame < 0 ) ? 0 : csFrame, CS_VIEW_RENDER_BENCH, ( double ) csWidth / ( double ) csHeight );
+
+                    /* Memorize frame begining */
+                    csStart = cs_view_hud_time();
+
+                    /* Draw measured scene */
+                    cs_view_hud_begin();
+                    cs_view_scene_draw();
+                    cs_view_hud_end();
+
+                    /* Wait rendering completion */
+                    glFinish();
+
+                    /* Check warm-up frames */
+                    if ( csFrame < 0 ) continue;
+
+                    /* Memorize frame time */
+                    csCPU[csFrame] = ( cs_view_hud_time() - csStart ) * 1e3;
+
+                    /* Memorize previous frame GPU time */
+                    if ( csStats.stGPU >= 0.0 ) csGPU[csGPUs ++] = csStats.stGPU;
+
+                    /* Accumulate drawn vertices */
+                    csVertices += csStats.stVertices;
+
+                }
+
+                /* Display benchmark summary */
+                fprintf( LC_OUT, "Benchmark : %d frames at %dx%d, %d records loaded in %.1f ms, %.0f vertices per frame\n", CS_VIEW_RENDER_BENCH, csWidth, csHeight, csStats.stRecords, csLoad, csVertices / CS_VIEW_RENDER_BENCH );
+
+                /* Display frame times percentiles */
+                cs_view_render_percentile( "Frame time", csCPU, CS_VIEW_RENDER_BENCH );
+
+                /* Display GPU times percentiles */
+                if ( csGPUs > 0 ) cs_view_render_percentile( "GPU time  ", csGPU, csGPUs ); else fprintf( LC_OUT, "GPU time   : timer queries not available\n" );
+
+            }
+
+            /* Delete scene */
+            cs_view_scene_compile( CS_FLAG_DELETE );
+
+        }
+
+        /* Release frame times arrays */
+        free( csCPU );
+        free( csGPU );
+
+        /* Delete offscreen context */
+        cs_view_render_delete( & csRender );
+
+        /* Send message */
+        return( csReturn );
+
+    # else
+
+        /* Display message */
+        fprintf( LC_ERR, "Error : headless rendering not available in this build (make HEADLESS=true)\n" );
+
+        /* Send message */
+        return( LC_FALSE );
+
+    # endif
+
+    }
+
+    # ifdef __HEADLESS__
+
+/*
+    Source - Offscreen context creation
+ */
+
+    int cs_view_render_create( cs_View_Render_t * const csRender, int const csWidth, int const csHeight ) {
+
+        /* Platform display variables */
+        PFNEGLGETPLATFORMDISPLAYEXTPROC csPlatform = ( PFNEGLGETPLATFORMDISPLAYEXTPROC ) eglGetProcAddress( "eglGetPlatformDisplayEXT" );
+
+        /* Reset structure */
+        memset( csRender, 0, sizeof( cs_View_Render_t ) );
+
+        /* Assign framebuffer size */
+        csRender->rdWidth  = csWidth;
+        csRender->rdHeight = csHeight;
+
+        /* Query surfaceless display */
+        if ( csPlatform != NULL ) csRender->rdDisplay = csPlatform( EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL );
+
+        /* Query default display */
+        if ( csRender->rdDisplay == EGL_NO_DISPLAY ) csRender->rdDisplay = eglGetDisplay( EGL_DEFAULT_DISPLAY );
+
+        /* Initialise display and bind OpenGL */
+        if ( ( csRender->rdDisplay == EGL_NO_DISPLAY ) || ( eglInitialize( csRender->rdDisplay, NULL, NULL ) == EGL_FALSE ) || ( eglBindAPI( EGL_OPENGL_API ) == EGL_FALSE ) ) {
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : unable to initialise EGL display\n" );
+
+            /* Send message */
+            return( LC_FALSE );
+
+        }
+
+        /* Create context and make it current without surface */
+        if ( ( ( csRender->rdContext = eglCreateContext( csRender->rdDisplay, EGL_NO_CONFIG_KHR, EGL_NO_CONTEXT, NULL ) ) == EGL_NO_CONTEXT ) || ( eglMakeCurrent( csRender->rdDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, csRender->rdContext ) == EGL_FALSE ) ) {
+
+            /* Delete context and display */
+            cs_view_render_delete( csRender );
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : unable to create EGL surfaceless context\n" );
+
+            /* Send message */
+            return( LC_FALSE );
+
+        }
+
+        /* Allocate and check pixels array */
+        if ( ( csRender->rdPixels = ( unsigned char * ) malloc( csWidth * csHeight * 3 ) ) == NULL ) {
+
+            /* Delete context and display */
+            cs_view_render_delete( csRender );
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : unable to allocate image memory\n" );
+
+            /* Send message */
+            return( LC_FALSE );
+
+        }
+
+        /* Create framebuffer object */
+        glGenFramebuffers( 1, & csRender->rdFrame );
+        glBindFramebuffer( GL_FRAMEBUFFER, csRender->rdFrame );
+
+        /* Create color renderbuffer */
+        glGenRenderbuffers( 1, & csRender->rdColor );
+        glBindRenderbuffer( GL_RENDERBUFFER, csRender->rdColor );
+        glRenderbufferStorage( GL_RENDERBUFFER, GL_RGBA8, csWidth, csHeight );
+        glFramebufferRenderbuffer( GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, csRender->rdColor );
+
+        /* Create depth and stencil renderbuffer */
+        glGenRenderbuffers( 1, & csRender->rdDepth );
+        glBindRenderbuffer( GL_RENDERBUFFER, csRender->rdDepth );
+        glRenderbufferStorage( GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, csWidth, csHeight );
+        glFramebufferRenderbuffer( GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, csRender->rdDepth );
+
+        /* Check framebuffer object */
+        if ( glCheckFramebufferStatus( GL_FRAMEBUFFER ) != GL_FRAMEBUFFER_COMPLETE ) {
+
+            /* Delete context and display */
+            cs_view_render_delete( csRender );
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : unable to create %dx%d framebuffer\n", csWidth, csHeight );
+
+            /* Send message */
+            return( LC_FALSE );
+
+        }
+
+        /* Update viewport */
+        glViewport( 0, 0, csWidth, csHeight );
+
+        /* Send message */
+        return( LC_TRUE );
+
+    }
+
+/*
+    Source - Offscreen context deletion
+ */
+
+    void cs_view_render_delete( cs_View_Render_t * const csRender ) {
+
+        /* Check context */
+        if ( csRender->rdContext != EGL_NO_CONTEXT ) {
+
+            /* Delete framebuffer object and renderbuffers */
+            if ( csRender->rdFrame != 0 ) glDeleteFramebuffers ( 1, & csRender->rdFrame );
+            if ( csRender->rdColor != 0 ) glDeleteRenderbuffers( 1, & csRender->rdColor );
+            if ( csRender->rdDepth != 0 ) glDeleteRenderbuffers( 1, & csRender->rdDepth );
+
+            /* Release context */
+            eglMakeCurrent( csRender->rdDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT );
+
+            /* Delete context */
+            eglDestroyContext( csRender->rdDisplay, csRender->rdContext );
+
+        }
+
+        /* Terminate display */
+        if ( csRender->rdDisplay != EGL_NO_DISPLAY ) eglTerminate( csRender->rdDisplay );
+
+        /* Release pixels array */
+        free( csRender->rdPixels );
+
+        /* Reset structure */
+        memset( csRender, 0, sizeof( cs_View_Render_t ) );
+
+    }
+
+/*
+    Source - Segment rendering
+ */
+
+    int cs_view_render_segment( cs_View_Render_t * const csRender, char const * const csSegment, char const * const csImage, int const csCamera ) {
+
+        /* Returned variables */
+        int csReturn = LC_TRUE;
+
+        /* Display message */
+        fprintf( LC_OUT, "Rendering : %s\n", csImage );
+
+        /* Load segment */
+        if ( ( csReturn = cs_view_render_load( csSegment ) ) == LC_TRUE ) {
+
+            /* Frame track according to camera preset */
+            cs_view_render_frame( csCamera, ( double ) csRender->rdWidth / ( double ) csRender->rdHeight );
+
+            /* Draw scene */
+            cs_view_scene_draw();
+
+            /* Read framebuffer pixels */
+            glPixelStorei( GL_PACK_ALIGNMENT, 1 );
+            glReadPixels( 0, 0, csRender->rdWidth, csRender->rdHeight, GL_RGB, GL_UNSIGNED_BYTE, csRender->rdPixels );
+
+            /* Export and check image */
+            if ( ( csReturn = cs_view_render_png( csImage, csRender->rdWidth, csRender->rdHeight, csRender->rdPixels ) ) == LC_FALSE ) {
+
+                /* Display message */
+                fprintf( LC_ERR, "Error : unable to write %s\n", basename( ( char * ) csImage ) );
+
+            }
+
+        }
+
+        /* Delete scene */
+        cs_view_scene_compile( CS_FLAG_DELETE );
+
+        /* Send message */
+        return( csReturn );
+
+    }
+
+/*
+    Source - Segment loading
+ */
+
+    int cs_view_render_load( char const * const csSegment ) {
+
+        /* Check segment path */
+        if ( csSegment != NULL ) {
+
+            /* Remove survey segments */
+            cs_view_survey_delete( & csSurvey );
+
+            /* Append and check segment */
+            if ( cs_view_survey_append( & csSurvey, csSegment ) == LC_FALSE ) return( LC_FALSE );
+
+        }
+
+        /* Request vertex buffer rendering */
+        csSurvey.svMode = CS_MODE_BUFFER;
+
+        /* Compile scene */
+        cs_view_scene_compile( CS_FLAG_CREATE );
+
+        /* Wait survey loading */
+        while ( cs_view_survey_done( & csSurvey ) == LC_FALSE ) {
+
+            /* Update survey loading */
+            cs_view_survey_update( & csSurvey, csList.lsTrack );
+
+            /* Wait loading workers */
+            if ( cs_view_survey_done( & csSurvey ) == LC_FALSE ) usleep( CS_VIEW_RENDER_WAIT );
+
+        }
+
+        /* Check tracks geometry */
+        if ( csSurvey.svAnchor < 0 ) {
+
+            /* Display message */
+            if ( csSegment != NULL ) fprintf( LC_ERR, "Error : no pose to render in %s\n", basename( ( char * ) csSegment ) ); else fprintf( LC_ERR, "Error : no pose to render\n" );
+
+            /* Send message */
+            return( LC_FALSE );
+
+        }
+
+        /* Send message */
+        return( LC_TRUE );
+
+    }
+
+/*
+    Source - Camera preset framing
+ */
+
+    void cs_view_render_frame( int const csCamera, double const csAspect ) {
+
+        /* Survey center and half extent variables */
+        double csCenter[3] = { 0.0 };
+        double csExtent[3] = { 0.0 };
+
+        /* Field of view variables */
+        double csVertical   = CS_VIEW_RENDER_FOV * 0.5 * CS_DEG2RAD;
+        double csHorizontal = atan( tan( csVertical ) * csAspect );
+
+        /* Framing variables */
+        double csRadius   = 0.0;
+        double csDistance = 0.0;
+
+        /* Parsing variables */
+        int csAxis = 0;
+
+        /* Compute survey center and half extent, ground included */
+        for ( csAxis = 0; csAxis < 3; csAxis ++ ) {
+
+            /* Compute center and half extent */
+            csCenter[csAxis] = 0.5 * ( csSurvey.svMax[csAxis] + csSurvey.svMin[csAxis] );
+            csExtent[csAxis] = 0.5 * ( csSurvey.svMax[csAxis] - csSurvey.svMin[csAxis] ) + CS_VIEW_TRACK_BOX;
+
+        }
+
+        /* Compute bounding sphere radius */
+        csRadius = sqrt( csExtent[0] * csExtent[0] + csExtent[1] * csExtent[1] + csExtent[2] * csExtent[2] );
+
+        /* Switch on camera preset */
+        switch ( csCamera ) {
+
+            case ( CS_VIEW_RENDER_TOP ) : {
+
+                /* Compute distance fitting the horizontal extent */
+                csDistance = CS_VIEW_RENDER_MARGIN * fmax( csExtent[0] / tan( csHorizontal ), csExtent[2] / tan( csVertical ) ) + csExtent[1];
+
+                /* Assign camera looking down, north up */
+                csPosition.psAX  = -90.0;
+                csPosition.psAY  = 0.0;
+                csPosition.psLon = csCenter[0];
+                csPosition.psAlt = csCenter[1] + csDistance;
+                csPosition.psLat = csCenter[2];
+
+            } break;
+
+            case ( CS_VIEW_RENDER_FRONT ) : {
+
+                /* Compute distance fitting the bounding sphere */
+                csDistance = CS_VIEW_RENDER_MARGIN * csRadius / sin( fmin( csVertical, csHorizontal ) );
+
+                /* Assign camera looking north from the south */
+                csPosition.psAX  = 0.0;
+                csPosition.psAY  = 0.0;
+                csPosition.psLon = csCenter[0];
+                csPosition.psAlt = csCenter[1];
+                csPosition.psLat = csCenter[2] - csDistance;
+
+            } break;
+
+            default : {
+
+                /* Compute distance fitting the bounding sphere */
+                csDistance = CS_VIEW_RENDER_MARGIN * csRadius / sin( fmin( csVertical, csHorizontal ) );
+
+                /* Assign camera looking north and down from the south */
+                csPosition.psAX  = -45.0;
+                csPosition.psAY  = 0.0;
+                csPosition.psLon = csCenter[0];
+                csPosition.psAlt = csCenter[1] + csDistance * sin( 45.0 * CS_DEG2RAD );
+                csPosition.psLat = csCenter[2] - csDistance * cos( 45.0 * CS_DEG2RAD );
+
+            } break;
+
+        };
+
+        /* Update matrix mode */
+        glMatrixMode( GL_PROJECTION );
+
+        /* Reset matrix */
+        glLoadIdentity();
+
+        /* Compute projection matrix enclosing the track */
+        gluPerspective( CS_VIEW_RENDER_FOV, csAspect, 1.0, 2.0 * ( csDistance + csRadius ) );
+
+    }
+
+/*
+    Source - Benchmark camera path
+ */
+
+    void cs_view_render_path( int const csFrame, int const csFrames, double const csAspect ) {
+
+        /* Survey center and half extent variables */
+        double csCenter[3] = { 0.0 };
+        double csExtent[3] = { 0.0 };
+
+        /* Field of view variables */
+        double csVertical   = CS_VIEW_RENDER_FOV * 0.5 * CS_DEG2RAD;
+        double csHorizontal = atan( tan( csVertical ) * csAspect );
+
+        /* Framing variables */
+        double csRadius   = 0.0;
+        double csFar      = 0.0;
+        double csDistance = 0.0;
+
+        /* Path variables */
+        double csPhase = ( double ) csFrame / ( double ) csFrames;
+        double csYaw   = 0.0;
+        double csPitch = 0.0;
+
+        /* Parsing variables */
+        int csAxis = 0;
+
+        /* Compute survey center and half extent, ground included */
+        for ( csAxis = 0; csAxis < 3; csAxis ++ ) {
+
+            /* Compute center and half extent */
+            csCenter[csAxis] = 0.5 * ( csSurvey.svMax[csAxis] + csSurvey.svMin[csAxis] );
+            csExtent[csAxis] = 0.5 * ( csSurvey.svMax[csAxis] - csSurvey.svMin[csAxis] ) + CS_VIEW_TRACK_BOX;
+
+        }
+
+        /* Compute bounding sphere radius */
+        csRadius = sqrt( csExtent[0] * csExtent[0] + csExtent[1] * csExtent[1] + csExtent[2] * csExtent[2] );
+
+        /* Compute distance fitting the bounding sphere */
+        csFar = CS_VIEW_RENDER_MARGIN * csRadius / sin( fmin( csVertical, csHorizontal ) );
+
+        /* Compute distance approaching the center at half path */
+        csDistance = csFar * ( 1.0 - ( 1.0 - CS_VIEW_RENDER_APPROACH ) * sin( CS_PI * csPhase ) );
+
+        /* Compute full turn heading and oscillating pitch, in degrees */
+        csYaw   = 360.0 * csPhase;
+        csPitch = 45.0 + 30.0 * sin( 2.0 * CS_PI * csPhase );
+
+        /* Assign camera looking at the survey center */
+        csPosition.psAX  = - csPitch;
+        csPosition.psAY  = + csYaw;
+        csPosition.psLon = csCenter[0] + csDistance * sin( csYaw * CS_DEG2RAD ) * cos( csPitch * CS_DEG2RAD );
+        csPosition.psAlt = csCenter[1] + csDistance * sin( csPitch * CS_DEG2RAD );
+        csPosition.psLat = csCenter[2] - csDistance * cos( csYaw * CS_DEG2RAD ) * cos( csPitch * CS_DEG2RAD );
+
+        /* Update matrix mode */
+        glMatrixMode( GL_PROJECTION );
+
+        /* Reset matrix */
+        glLoadIdentity();
+
+        /* Compute projection matrix enclosing the track */
+        gluPerspective( CS_VIEW_RENDER_FOV, csAspect, 1.0, 2.0 * ( csFar + csRadius ) );
+
+    }
+
+/*
+    Source - Frame times percentiles
+ */
+
+    void cs_view_render_percentile( char const * const csLabel, double * const csTime, int const csCount ) {
+
+        /* Percentiles variables */
+        static double const csRank[4] = { 50.0, 90.0, 95.0, 99.0 };
+
+        /* Parsing variables */
+        int csParse = 0;
+
+        /* Index variables */
+        int csIndex = 0;
+
+        /* Sort frame times */
+        qsort( csTime, csCount, sizeof( double ), cs_view_render_compare );
+
+        /* Display label */
+        fprintf( LC_OUT, "%s :", csLabel );
+
+        /* Display percentiles */
+        for ( csParse = 0; csParse < 4; csParse ++ ) {
+
+            /* Compute nearest rank index */
+            csIndex = ( int ) ceil( csRank[csParse] * 0.01 * csCount ) - 1;
+
+            /* Display percentile */
+            fprintf( LC_OUT, " p%.0f %.3f ms,", csRank[csParse], csTime[( csIndex < 0 ) ? 0 : csIndex] );
+
+        }
+
+        /* Display maximum */
+        fprintf( LC_OUT, " max %.3f ms\n", csTime[csCount - 1] );
+
+    }
+
+/*
+    Source - Frame times comparison
+ */
+
+    int cs_view_render_compare( void const * csA, void const * csB ) {
+
+        /* Return frame times order */
+        return( ( * ( double const * ) csA > * ( double const * ) csB ) - ( * ( double const * ) csA < * ( double const * ) csB ) );
+
+    }
+
+/*
+    Source - PNG image exportation
+ */
+
+    int cs_view_render_png( char const * const csImage, int const csWidth, int const csHeight, unsigned char const * const csPixels ) {
+
+        /* Parsing variables */
+        int csRow = 0;
+
+        /* Temporary file path variables */
+        char csTemp[512] = { 0 };
+
+        /* Stream variables */
+        FILE * csStream = NULL;
+
+        /* PNG variables */
+        png_structp csPNG  = NULL;
+        png_infop   csInfo = NULL;
+
+        /* Create and check output stream */
+        if ( ( csStream = lc_file_atomic_open( csImage, csTemp ) ) == NULL ) return( LC_FALSE );
+
+        /* Create PNG structures */
+        if ( ( csPNG = png_create_write_struct( PNG_LIBPNG_VER_STRING, NULL, NULL, NULL ) ) != NULL ) csInfo = png_create_info_struct( csPNG );
+
+        /* Check PNG structures and errors */
+        if ( ( csInfo == NULL ) || ( setjmp( png_jmpbuf( csPNG ) ) != 0 ) ) {
+
+            /* Delete PNG structures */
+            png_destroy_write_struct( & csPNG, & csInfo );
+
+            /* Discard output stream */
+            lc_file_atomic_close( csStream, csTemp, csImage, LC_FALSE );
+
+            /* Send message */
+            return( LC_FALSE );
+
+        }
+
+        /* Assign output stream */
+        png_init_io( csPNG, csStream );
+
+        /* Write image header */
+        png_set_IHDR( csPNG, csInfo, csWidth, csHeight, 8, PNG_COLOR_TYPE_RGB, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT );
+        png_write_info( csPNG, csInfo );
+
+        /* Write image rows from top to bottom */
+        for ( csRow = csHeight - 1; csRow >= 0; csRow -- ) png_write_row( csPNG, ( png_const_bytep ) ( csPixels + csRow * csWidth * 3 ) );
+
+        /* Terminate image */
+        png_write_end( csPNG, csInfo );
+
+        /* Delete PNG structures */
+        png_destroy_write_struct( & csPNG, & csInfo );
+
+        /* Commit output stream */
+        return( lc_file_atomic_close( csStream, csTemp, csImage, LC_TRUE ) );
+
+    }
+
+    # endif
+
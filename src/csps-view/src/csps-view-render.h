@@ -0,0 +1,347 @@
+/*
+ * csps-suite - CSPS library front-end suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   csps-view-render.h
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *   
+     *  Headless offscreen rendering
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __CS_VIEW_RENDER__
+    # define __CS_VIEW_RENDER__
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    extern "C" {
+    # endif
+
+/* 
+    Header - Includes
+ */
+
+    # include "csps-view-features.h"
+    # include "csps-view-scene.h"
+    # include "csps-view-track.h"
+    # include "csps-view-survey.h"
+    # include "csps-view-hud.h"
+
+    /* Headless includes */
+    # ifdef __HEADLESS__
+    # include <EGL/egl.h>
+    # include <EGL/eglext.h>
+    # include <png.h>
+    # endif
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define camera presets */
+    # define CS_VIEW_RENDER_NONE        -1
+    # define CS_VIEW_RENDER_TOP         0
+    # define CS_VIEW_RENDER_OBLIQUE     1
+    # define CS_VIEW_RENDER_FRONT       2
+
+    /* Define vertical field of view, in degrees */
+    # define CS_VIEW_RENDER_FOV         45.0
+
+    /* Define framing margin factor */
+    # define CS_VIEW_RENDER_MARGIN      1.1
+
+    /* Define loading polling period, in microseconds */
+    # define CS_VIEW_RENDER_WAIT        1000
+
+    /* Define benchmark measured and warm-up frames count */
+    # define CS_VIEW_RENDER_BENCH       600
+    # define CS_VIEW_RENDER_WARMUP      30
+
+    /* Define benchmark closest approach, as fraction of framing distance */
+    # define CS_VIEW_RENDER_APPROACH    0.05
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+    # ifdef __HEADLESS__
+
+    /*! \struct cs_View_Render_struct
+     *  \brief Offscreen rendering context structure
+     *
+     *  This structure stores the EGL context and the OpenGL framebuffer used
+     *  to render the scene without window.
+     *
+     *  \var cs_View_Render_struct::rdDisplay
+     *  EGL display
+     *  \var cs_View_Render_struct::rdContext
+     *  EGL context
+     *  \var cs_View_Render_struct::rdFrame
+     *  OpenGL framebuffer object name
+     *  \var cs_View_Render_struct::rdColor
+     *  OpenGL color renderbuffer name
+     *  \var cs_View_Render_struct::rdDepth
+     *  OpenGL depth and stencil renderbuffer name
+     *  \var cs_View_Render_struct::rdWidth
+     *  Framebuffer width, in pixels
+     *  \var cs_View_Render_struct::rdHeight
+     *  Framebuffer height, in pixels
+     *  \var cs_View_Render_struct::rdPixels
+     *  Framebuffer pixels array
+     */
+
+    typedef struct cs_View_Render_struct {
+
+        EGLDisplay      rdDisplay;
+        EGLContext      rdContext;
+        GLuint          rdFrame;
+        GLuint          rdColor;
+        GLuint          rdDepth;
+        int             rdWidth;
+        int             rdHeight;
+        unsigned char * rdPixels;
+
+    } cs_View_Render_t;
+
+    # endif
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Camera preset detection
+     *  
+     *  This function returns the camera preset corresponding to the provided
+     *  name, CS_VIEW_RENDER_NONE if the name is unknown.
+     *  
+     *  \param csName   Camera preset name (top, oblique or front)
+     *
+     *  \return Returns camera preset
+     */
+
+    int cs_view_render_camera ( char const * const csName );
+
+    /*! \brief Headless rendering
+     *  
+     *  This function renders the tracks of the survey segments together in the
+     *  provided image or, if a list file is provided, the track of each
+     *  segment of the list in its image. Each line of the list
+     *  gives a segment path followed by its image path, separated by spaces.
+     *  Empty lines and lines starting with # are ignored. The rendering is
+     *  performed in an offscreen framebuffer of an EGL surfaceless context,
+     *  so that no display is needed.
+     *  
+     *  \param csImage  Image path, used if no list is provided
+     *  \param csList   List file path, empty string for none
+     *  \param csWidth  Image width, in pixels
+     *  \param csHeight Image height, in pixels
+     *  \param csCamera Camera preset
+     *
+     *  \return Returns LC_TRUE if every image is rendered, LC_FALSE otherwise
+     */
+
+    int cs_view_render ( char const * const csImage, char const * const csList, int const csWidth, int const csHeight, int const csCamera );
+
+    /*! \brief Headless rendering benchmark
+     *  
+     *  This function loads the tracks of the survey segments in an offscreen
+     *  framebuffer and renders them along a scripted camera path. The time of each frame, up to the completion of its
+     *  rendering, is measured and the percentiles of the frames CPU and, if
+     *  timer queries are available, GPU times are printed. Being performed
+     *  offscreen, the benchmark does not depend on the display and its
+     *  synchronisation.
+     *  
+     *  \param csWidth  Framebuffer width, in pixels
+     *  \param csHeight Framebuffer height, in pixels
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int cs_view_render_bench ( int const csWidth, int const csHeight );
+
+    # ifdef __HEADLESS__
+
+    /*! \brief Offscreen context creation
+     *  
+     *  This function creates an EGL surfaceless context with a framebuffer 
+     *  object of the provided size and makes it current.
+     *  
+     *  \param csRender Offscreen rendering context structure
+     *  \param csWidth  Framebuffer width, in pixels
+     *  \param csHeight Framebuffer height, in pixels
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int cs_view_render_create ( cs_View_Render_t * const csRender, int const csWidth, int const csHeight );
+
+    /*! \brief Offscreen context deletion
+     *  
+     *  This function deletes the framebuffer object and the EGL context.
+     *  
+     *  \param csRender Offscreen rendering context structure
+     */
+
+    void cs_view_render_delete ( cs_View_Render_t * const csRender );
+
+    /*! \brief Segment rendering
+     *  
+     *  This function loads the track of the provided segment, or the tracks of
+     *  the survey segments, frames them using the provided camera preset,
+     *  renders them in the offscreen framebuffer and writes the image in PNG
+     *  format.
+     *  
+     *  \param csRender     Offscreen rendering context structure
+     *  \param csSegment    Segment path, NULL for the survey segments
+     *  \param csImage      Image path
+     *  \param csCamera     Camera preset
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int cs_view_render_segment ( cs_View_Render_t * const csRender, char const * const csSegment, char const * const csImage, int const csCamera );
+
+    /*! \brief Segment loading
+     *  
+     *  This function compiles the scene for the provided segment, replacing the
+     *  survey segments, or for the survey segments, and waits the completion
+     *  of the tracks loading.
+     *  
+     *  \param csSegment    Segment path, NULL for the survey segments
+     *
+     *  \return Returns LC_TRUE if a track holds poses, LC_FALSE otherwise
+     */
+
+    int cs_view_render_load ( char const * const csSegment );
+
+    /*! \brief Camera preset framing
+     *  
+     *  This function sets the camera position, orientation and projection so
+     *  that the loaded tracks and their ground are entirely seen according to 
+     *  the provided camera preset.
+     *  
+     *  \param csCamera Camera preset
+     *  \param csAspect Image aspect ratio
+     */
+
+    void cs_view_render_frame ( int const csCamera, double const csAspect );
+
+    /*! \brief Benchmark camera path
+     *  
+     *  This function sets the camera position, orientation and projection for
+     *  the provided frame of the benchmark path. The camera performs a full
+     *  turn around the survey center while approaching from the distance seeing
+     *  the whole survey up to a close view and going back, so that every level
+     *  of detail is drawn.
+     *  
+     *  \param csFrame  Frame index
+     *  \param csFrames Frames count of the path
+     *  \param csAspect Image aspect ratio
+     */
+
+    void cs_view_render_path ( int const csFrame, int const csFrames, double const csAspect );
+
+    /*! \brief Frame times percentiles
+     *  
+     *  This function sorts the provided frame times and prints their median,
+     *  90th, 95th and 99th percentiles and maximum, using the nearest rank
+     *  method.
+     *  
+     *  \param csLabel  Line label
+     *  \param csTime   Frame times array, in milliseconds
+     *  \param csCount  Number of frame times
+     */
+
+    void cs_view_render_percentile ( char const * const csLabel, double * const csTime, int const csCount );
+
+    /*! \brief Frame times comparison
+     *  
+     *  This function is the frame times comparison used for sorting.
+     *  
+     *  \param csA  Pointer to first frame time
+     *  \param csB  Pointer to second frame time
+     *
+     *  \return Returns the frame times order
+     */
+
+    int cs_view_render_compare ( void const * csA, void const * csB );
+
+    /*! \brief PNG image exportation
+     *  
+     *  This function writes the provided bottom-up RGB pixels array in the
+     *  provided PNG image. The image is written atomically.
+     *  
+     *  \param csImage  Image path
+     *  \param csWidth  Image width, in pixels
+     *  \param csHeight Image height, in pixels
+     *  \param csPixels Pixels array
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int cs_view_render_png ( char const * const csImage, int const csWidth, int const csHeight, unsigned char const * const csPixels );
+
+    # endif
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    }
+    # endif
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
@@ -51,7 +51,9 @@
     extern cs_View_Keyboard_t csKeyboard;
     extern cs_View_Mouse_t    csMouse;
     extern cs_View_List_t     csList;
+    extern cs_View_Survey_t   csSurvey;
     extern cs_View_Path_t     csPath;
+    extern cs_View_Stats_t    csStats;
 
 /*
     Source - Scene rendering function
@@ -59,6 +61,32 @@
 
     void cs_view_scene( void ) {
 
+        /* Begin frame measure */
+        cs_view_hud_begin();
+
+        /* Update survey loading */
+        cs_view_survey_update( & csSurvey, csList.lsTrack );
+
+        /* Draw scene */
+        cs_view_scene_draw();
+
+        /* End frame measure */
+        cs_view_hud_end();
+
+        /* Draw heads-up display */
+        cs_view_hud_draw();
+
+        /* Swap buffers */
+        glutSwapBuffers();
+
+    }
+
+/*
+    Source - Scene drawing function
+ */
+
+    void cs_view_scene_draw( void ) {
+
         /* Clear buffers */
         glClear( GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT );
 
@@ -78,298 +106,107 @@
             glRotated( +csPosition.psAX, 1.0, 0.0, 0.0 );
             glRotated( +csPosition.psAY, 0.0, 1.0, 0.0 );
 
-            /* Transfromation - Translation */
-            glTranslated( - csPosition.psLon, - csPosition.psAlt, - csPosition.psLat );
-
-            /* Call display list */
-            glCallList( csList.lsTrack );
+            /* Draw survey segments */
+            cs_view_survey_draw( & csSurvey, csList.lsTrack );
 
         } glPopMatrix();
 
-        /* Force primitives draw */
-        glFlush();
-
-        /* Wait for primitives draw */
-        glFinish();
-
     }
 
 /*
-    Source - Scene creation/deletion function
+    Source - Swap interval function
  */
 
-    void cs_view_scene_compile( int const csFlag ) {
-
-        /* Verify exectution flag */
-        if ( csFlag == CS_FLAG_CREATE ) {
-
-            /* Update clear color */
-            glClearColor( 1.0, 1.0, 1.0, 0.0 );
-
-            /* Enable depth test */
-            glEnable( GL_DEPTH_TEST );
-            glDepthFunc( GL_LEQUAL );
-            glDepthMask( GL_TRUE );
-            glClearDepth( 1.0 );
-
-            /* Set shade model */
-            glShadeModel( GL_SMOOTH );
-
-            /* Assign display list index */
-            csList.lsTrack = 1;
-
-            /* Compile camera display list */
-            cs_view_scene_track( csList.lsTrack );
-
-        } else {
-
-            /* Delete display list */
-            glDeleteLists( csList.lsTrack, 1 );
-
-        }
-
-    }
-
-/*
-    Source - Specific scene compilation function
- */
-
-    void cs_view_scene_track( GLuint const csTag ) {
-
-        /* Parsing variables */
-        lp_Size_t csParse = 0;
-
-        /* CSPS query variables */
-        lp_Trigger_t  csTrigger;
-        lp_Position_t csPosition;
-        lp_Orient_t   csOrient;
-
-        /* Define flags */
-        int csMF = 0, csFF = 0, csIF = 0;
-
-        /* Cartesian coordinates variables */
-        double csPX = 0.0, csPY = 0.0, csPZ = 0.0;
+    int cs_view_scene_interval( int const csInterval ) {
 
-        /* Cartesian coordinates memory variables */
-        double csMX = 0.0, csMY = 0.0, csMZ = 0.0;
+        /* Display variables */
+        Display * csDisplay = glXGetCurrentDisplay();
 
-        /* Cartesian coordinates frame variables */
-        double csXX = 0.0, csXY = 0.0, csXZ = 0.0;
-        double csYX = 0.0, csYY = 0.0, csYZ = 0.0;
-        double csZX = 0.0, csZY = 0.0, csZZ = 0.0;
+        /* Extensions string variables */
+        char const * csExtension = NULL;
 
-        /* Cartesian coordinates frame memory variables */
-        double csMXX = 0.0, csMXY = 0.0, csMXZ = 0.0;
-        double csMYX = 0.0, csMYY = 0.0, csMYZ = 0.0;
-        double csMZX = 0.0, csMZY = 0.0, csMZZ = 0.0;
+        /* Check display */
+        if ( csDisplay == NULL ) return( LC_FALSE );
 
-        /* Initial position memory */
-        double csIX = 0.0, csIY = 0.0, csIZ = 0.0;
+        /* Query extensions string */
+        csExtension = glXQueryExtensionsString( csDisplay, DefaultScreen( csDisplay ) );
 
-        /* Mean position accumulators variables */
-        double csLon = 0.0, csLat = 0.0, csAlt = 0.0, csAcc = 0.0;
+        /* Check extensions string */
+        if ( csExtension == NULL ) return( LC_FALSE );
 
-        /* Position extremums */
-        double csMinLon = 1e100, csMaxLon = -1e100;
-        double csMinLat = 1e100, csMaxLat = -1e100;
-        double csMinAlt = 1e100, csMaxAlt = -1e100;
+        /* Search available extension */
+        if ( strstr( csExtension, "GLX_EXT_swap_control" ) != NULL ) {
 
-        /* Create query descriptors */
-        csTrigger  = lp_query_trigger_create    ( csPath.ptRoot, csPath.ptCAMd, csPath.ptCAMm );
-        csPosition = lp_query_position_create   ( csPath.ptRoot, csPath.ptGPSd, csPath.ptGPSm );
-        csOrient   = lp_query_orientation_create( csPath.ptRoot, csPath.ptIMUd, csPath.ptIMUm );
+            /* Set swap interval */
+            ( ( PFNGLXSWAPINTERVALEXTPROC ) glXGetProcAddressARB( ( GLubyte const * ) "glXSwapIntervalEXT" ) )( csDisplay, glXGetCurrentDrawable(), csInterval );
 
-        /* Declare display list begining */
-        glNewList( csTag, GL_COMPILE ); {
+        } else if ( strstr( csExtension, "GLX_MESA_swap_control" ) != NULL ) {
 
-            /* Update line width */
-            glLineWidth( 2.0 );
+            /* Set swap interval */
+            ( ( PFNGLXSWAPINTERVALMESAPROC ) glXGetProcAddressARB( ( GLubyte const * ) "glXSwapIntervalMESA" ) )( csInterval );
 
-            /* Begin primitive */
-            glBegin( GL_LINES ); {
+        } else if ( strstr( csExtension, "GLX_SGI_swap_control" ) != NULL ) {
 
-                /* Loop on camera records */
-                for ( csParse = 0; csParse < lp_query_trigger_size( & csTrigger ); csParse ++ ) {
+            /* Set swap interval */
+            ( ( PFNGLXSWAPINTERVALSGIPROC ) glXGetProcAddressARB( ( GLubyte const * ) "glXSwapIntervalSGI" ) )( csInterval );
 
-                    /* Query position and orientation by timestamp */
-                    lp_query_trigger_byindex( & csTrigger, csParse );
-                    lp_query_position( & csPosition, csTrigger.qrSynch );
-                    lp_query_orientation( & csOrient, csTrigger.qrSynch );
-
-                    /* Check query results */
-                    if ( ( csPosition.qrStatus == LP_TRUE ) && ( csOrient.qrStatus == LP_TRUE ) ) {
-
-                        /* Compute flat meters using equatorial radius */
-                        csPosition.qrLongitude *= CS_VIEW_SCENE_RAD2METER; 
-                        csPosition.qrLatitude  *= CS_VIEW_SCENE_RAD2METER;
-
-                        /* Save initial position */
-                        if ( csIF == 0 ) {
-
-                            /* Save components */
-                            csIX = + csPosition.qrLongitude;
-                            csIY = + csPosition.qrAltitude;
-                            csIZ = + csPosition.qrLatitude;
-
-                        } csIF = 1;
-
-                        /* Compute cartesian coordinates */
-                        csPX = csPosition.qrLongitude - csIX;
-                        csPY = csPosition.qrAltitude  - csIY;
-                        csPZ = csPosition.qrLatitude  - csIZ;
-
-                        /* Verify previous point memory */
-                        if ( csMF != 0 ) { 
-
-                            /* Update color */
-                            glColor3f( 0.92941, 0.69412, 0.0 );
-
-                            /* Send position vertex */
-                            glVertex3d( csMX, csMY, csMZ );
-                            glVertex3d( csPX, csPY, csPZ );
-
-                            /* Update color */
-                            glColor3f( 0.94, 0.94, 0.94 );
-
-                            /* Send position vertex */
-                            glVertex3d( csPX, csPY - CS_VIEW_SCENE_GRAVITY, csPZ );
-                            glVertex3d( csPX, csPY, csPZ );
-
-                            /* Send position vertex */
-                            glVertex3d( csMX, csMY - CS_VIEW_SCENE_GRAVITY, csMZ );
-                            glVertex3d( csPX, csPY - CS_VIEW_SCENE_GRAVITY, csPZ );
-
-                        } csMF = 1;
-
-                        /* Memorize position */
-                        csMX = csPX; csMY = csPY; csMZ = csPZ;
-
-                        /* Compute frame vectors */
-                        csXX = csPX + csOrient.qrfxx * CS_VIEW_SCENE_FRAME; csXY = csPY + csOrient.qrfxz * CS_VIEW_SCENE_FRAME; csXZ = csPZ + csOrient.qrfxy * CS_VIEW_SCENE_FRAME;
-                        csYX = csPX + csOrient.qrfyx * CS_VIEW_SCENE_FRAME; csYY = csPY + csOrient.qrfyz * CS_VIEW_SCENE_FRAME; csYZ = csPZ + csOrient.qrfyy * CS_VIEW_SCENE_FRAME;
-                        csZX = csPX + csOrient.qrfzx * CS_VIEW_SCENE_FRAME; csZY = csPY + csOrient.qrfzz * CS_VIEW_SCENE_FRAME; csZZ = csPZ + csOrient.qrfzy * CS_VIEW_SCENE_FRAME;
-
-                        /* Update color */
-                        glColor3f( 0.70, 0.20, 0.10 );
-
-                        /* Display body x-vector */
-                        glVertex3d( csPX, csPY, csPZ ); 
-                        glVertex3d( csXX, csXY, csXZ );
-
-                        /* Update color */
-                        glColor3f( 0.20, 0.50, 0.30 );
-
-                        /* Display body y-vector */
-                        glVertex3d( csPX, csPY, csPZ ); 
-                        glVertex3d( csYX, csYY, csYZ );
-
-                        /* Update color */
-                        glColor3f( 0.20, 0.30, 0.60 );
-
-                        /* Display body z-vector */
-                        glVertex3d( csPX, csPY, csPZ ); 
-                        glVertex3d( csZX, csZY, csZZ );
-
-                        /* Verify previous point memory */
-                        if ( csFF != 0 ) {
-
-                            /* Update color */
-                            glColor3f( 0.70, 0.20, 0.10 );
-
-                            /* Display body x-vector */
-                            glVertex3d( csMXX, csMXY, csMXZ );
-                            glVertex3d( csXX , csXY , csXZ  );
-
-                            /* Update color */
-                            glColor3f( 0.20, 0.50, 0.30 );
-
-                            /* Display body y-vector */
-                            glVertex3d( csMYX, csMYY, csMYZ );
-                            glVertex3d( csYX , csYY , csYZ  );
-
-                            /* Update color */
-                            glColor3f( 0.20, 0.30, 0.60 );
-
-                            /* Display body z-vector */
-                            glVertex3d( csMZX, csMZY, csMZZ );
-                            glVertex3d( csZX , csZY , csZZ  );
-
-                        } csFF = 1;
+        } else {
 
-                        /* Memorize frame */
-                        csMXX = csXX; csMXY = csXY; csMXZ = csXZ;
-                        csMYX = csYX; csMYY = csYY; csMYZ = csYZ;
-                        csMZX = csZX; csMZY = csZY; csMZZ = csZZ; 
+            /* Send message */
+            return( LC_FALSE );
 
-                        /* Accumulates position */
-                        csLon += csPX;
-                        csAlt += csPY;
-                        csLat += csPZ;
+        }
 
-                        /* Update index */
-                        csAcc += 1.0;
+        /* Send message */
+        return( LC_TRUE );
 
-                        /* Compute extremums */
-                        if ( csPX > csMaxLon ) csMaxLon = csPX;
-                        if ( csPX < csMinLon ) csMinLon = csPX;
-                        if ( csPZ > csMaxLat ) csMaxLat = csPZ;
-                        if ( csPZ < csMinLat ) csMinLat = csPZ;
-                        if ( csPY > csMaxAlt ) csMaxAlt = csPY;
-                        if ( csPY < csMinAlt ) csMinAlt = csPY;
+    }
 
-                    }
+/*
+    Source - Scene creation/deletion function
+ */
 
-                }
+    void cs_view_scene_compile( int const csFlag ) {
 
-                /* Update color */
-                glColor3f( 0.70, 0.20, 0.10 );
+        /* Verify exectution flag */
+        if ( csFlag == CS_FLAG_CREATE ) {
 
-                /* Draw referential frame - x-vector */
-                glVertex3f( csMinLon - CS_VIEW_SCENE_BOX, csMinAlt - CS_VIEW_SCENE_BOX, csMinLat - CS_VIEW_SCENE_BOX );
-                glVertex3f( csMaxLon + CS_VIEW_SCENE_BOX, csMinAlt - CS_VIEW_SCENE_BOX, csMinLat - CS_VIEW_SCENE_BOX );
+            /* Update clear color */
+            glClearColor( 1.0, 1.0, 1.0, 0.0 );
 
-                /* Update color */
-                glColor3f( 0.20, 0.50, 0.30 );
+            /* Enable depth test */
+            glEnable( GL_DEPTH_TEST );
+            glDepthFunc( GL_LEQUAL );
+            glDepthMask( GL_TRUE );
+            glClearDepth( 1.0 );
 
-                /* Draw referential frame - y-vector */
-                glVertex3f( csMinLon - CS_VIEW_SCENE_BOX, csMinAlt - CS_VIEW_SCENE_BOX, csMinLat - CS_VIEW_SCENE_BOX );
-                glVertex3f( csMinLon - CS_VIEW_SCENE_BOX, csMinAlt - CS_VIEW_SCENE_BOX, csMaxLat + CS_VIEW_SCENE_BOX );
+            /* Set shade model */
+            glShadeModel( GL_SMOOTH );
 
-                /* Update color */
-                glColor3f( 0.20, 0.30, 0.60 );
+            /* Check vertex buffer availability */
+            if ( cs_view_track_support() == LC_FALSE ) csSurvey.svMode = CS_MODE_LIST;
 
-                /* Draw referential frame - z-vector */
-                glVertex3f( csMinLon - CS_VIEW_SCENE_BOX, csMinAlt - CS_VIEW_SCENE_BOX, csMinLat - CS_VIEW_SCENE_BOX );
-                glVertex3f( csMinLon - CS_VIEW_SCENE_BOX, csMaxAlt + CS_VIEW_SCENE_BOX, csMinLat - CS_VIEW_SCENE_BOX );
+            /* Assign display lists indexes, one per segment */
+            csList.lsTrack = glGenLists( csSurvey.svCount );
 
-            /* End primitive */
-            } glEnd();
+            /* Create rendering statistics */
+            cs_view_hud_create();
 
-            /* Begin primitive */
-            glBegin( GL_QUADS );
+            /* Prepare survey loading */
+            cs_view_survey_create( & csSurvey );
 
-                /* Update color */
-                glColor3f( 0.90, 0.90, 0.90 );
-                
-                /* Send vertex */
-                glVertex3f( csMinLon - CS_VIEW_SCENE_BOX, csMinAlt - CS_VIEW_SCENE_BOX, csMinLat - CS_VIEW_SCENE_BOX );
-                glVertex3f( csMaxLon + CS_VIEW_SCENE_BOX, csMinAlt - CS_VIEW_SCENE_BOX, csMinLat - CS_VIEW_SCENE_BOX );
-                glVertex3f( csMaxLon + CS_VIEW_SCENE_BOX, csMinAlt - CS_VIEW_SCENE_BOX, csMaxLat + CS_VIEW_SCENE_BOX );
-                glVertex3f( csMinLon - CS_VIEW_SCENE_BOX, csMinAlt - CS_VIEW_SCENE_BOX, csMaxLat + CS_VIEW_SCENE_BOX );
+        } else {
 
-            /* End primitive */
-            glEnd();
+            /* Delete display lists */
+            if ( csList.lsTrack != 0 ) glDeleteLists( csList.lsTrack, csSurvey.svCount );
 
-        /* Declare display list end */
-        } glEndList();
+            /* Delete survey segments */
+            cs_view_survey_delete( & csSurvey );
 
-        /* Delete queries descriptors */
-        lp_query_trigger_delete    ( & csTrigger );
-        lp_query_position_delete   ( & csPosition  );
-        lp_query_orientation_delete( & csOrient  );
+            /* Delete rendering statistics */
+            cs_view_hud_delete();
 
-        /* Reset initial position and assign initial means */
-        cs_view_controls_reset( CS_VIEW_CONTROLS_SET, ( csLon / csAcc ), ( csLat / csAcc ), ( csAlt / csAcc ) );
+        }
 
     }
 
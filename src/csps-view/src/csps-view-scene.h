@@ -64,23 +64,14 @@
     # include "csps-view-features.h"
     # include "csps-view-controls.h"
     # include "csps-view-event.h"
+    # include "csps-view-track.h"
+    # include "csps-view-survey.h"
+    # include "csps-view-hud.h"
 
 /* 
     Header - Preprocessor definitions
  */
 
-    /* Define geoposition to meter factor */
-    # define CS_VIEW_SCENE_RAD2METER    111134.093193
-
-    /* Define frame size */
-    # define CS_VIEW_SCENE_FRAME        2.0
-
-    /* Define box factor */
-    # define CS_VIEW_SCENE_BOX          50.0
-
-    /* Define gravity indicator depth */
-    # define CS_VIEW_SCENE_GRAVITY      10.0
-
 /* 
     Header - Preprocessor macros
  */
@@ -99,34 +90,50 @@
 
     /*! \brief Scene rendering function
      *  
-     *  This function is called in software main infinite loop for entire scene
-     *  rendering.
+     *  This function is called as GLUT display callback for entire scene
+     *  rendering. It updates the survey loading, draws the scene, measures the
+     *  frame, draws the heads-up display and swaps the window buffers.
      */
 
     void cs_view_scene ( void );
 
-    /*! \brief Scene creation/deletion function
+    /*! \brief Scene drawing function
      *  
-     *  This function create OpenGL display lists at startup that contains the 
-     *  parts of the entire scene rendered by the software.
-     *
-     *  If CS_FLAG_CREATE is provided as csFlag, the function create the display
-     *  lists. Otherwise, the display lists are deleted.
+     *  This function draws the scene in the current framebuffer according to
+     *  the camera point of view, the segments outside the view frustum being
+     *  skipped.
+     */
+
+    void cs_view_scene_draw ( void );
+
+    /*! \brief Swap interval function
      *  
-     *  \param csFlag Creation/deletion flag
+     *  This function sets the number of display refreshes to wait between two
+     *  buffers swaps of the current window, using the GLX EXT, MESA or SGI swap
+     *  control extension, the first available being used. An interval of one
+     *  synchronises rendering with the display refresh.
+     *  
+     *  \param csInterval Swap interval
+     *
+     *  \return Returns LC_TRUE if an extension is available, LC_FALSE otherwise
      */
 
-    void cs_view_scene_compile ( int const csFlag );
+    int cs_view_scene_interval ( int const csInterval );
 
-    /*! \brief Specific scene compilation function
+    /*! \brief Scene creation/deletion function
      *  
-     *  This function creates a display list that contains positions and
-     *  orientations of the camera and the flat earth model frame.
+     *  This function creates at startup the tracks geometry of the survey
+     *  segments rendered by the software. The geometry of each segment is
+     *  stored in its own vertex buffer object, or in its own display list if
+     *  the immediate mode is requested or if vertex buffers are not available.
+     *
+     *  If CS_FLAG_CREATE is provided as csFlag, the function create the tracks
+     *  geometry. Otherwise, the geometry is deleted.
      *  
-     *  \param csTag OpenGL display list index
+     *  \param csFlag Creation/deletion flag
      */
 
-    void cs_view_scene_track( GLuint const csTag );
+    void cs_view_scene_compile ( int const csFlag );
 
 /* 
     Header - C/C++ compatibility
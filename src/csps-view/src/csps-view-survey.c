@@ -0,0 +1,466 @@
+/*
+ * csps-suite - CSPS library front-end suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "csps-view-survey.h"
+
+/* 
+    Source - Global variables (GLUT!)
+ */
+
+    extern cs_View_Position_t csPosition;
+    extern cs_View_Keyboard_t csKeyboard;
+    extern cs_View_Mouse_t    csMouse;
+    extern cs_View_List_t     csList;
+    extern cs_View_Survey_t   csSurvey;
+    extern cs_View_Path_t     csPath;
+    extern cs_View_Stats_t    csStats;
+
+/*
+    Source - Survey segment insertion
+ */
+
+    int cs_view_survey_append( cs_View_Survey_t * const csSurvey, char const * const csSegment ) {
+
+        /* Tracks array variables */
+        cs_View_Track_t * csTrack = NULL;
+
+        /* Check segment path length */
+        if ( strlen( csSegment ) >= sizeof( csTrack->tkPath ) ) {
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : segment path too long %s\n", csSegment );
+
+            /* Send message */
+            return( LC_FALSE );
+
+        }
+
+        /* Reallocate and check tracks array */
+        if ( ( csTrack = ( cs_View_Track_t * ) realloc( csSurvey->svTrack, ( csSurvey->svCount + 1 ) * sizeof( cs_View_Track_t ) ) ) == NULL ) {
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : unable to allocate survey memory\n" );
+
+            /* Send message */
+            return( LC_FALSE );
+
+        }
+
+        /* Assign tracks array */
+        csSurvey->svTrack = csTrack;
+
+        /* Track pointer */
+        csTrack = csSurvey->svTrack + csSurvey->svCount;
+
+        /* Reset track */
+        memset( csTrack, 0, sizeof( cs_View_Track_t ) );
+
+        /* Assign segment path */
+        strcpy( csTrack->tkPath, csSegment );
+
+        /* Update loading state */
+        csTrack->tkLoad = CS_VIEW_TRACK_IDLE;
+
+        /* Update segments count */
+        csSurvey->svCount ++;
+
+        /* Send message */
+        return( LC_TRUE );
+
+    }
+
+/*
+    Source - Survey creation
+ */
+
+    void cs_view_survey_create( cs_View_Survey_t * const csSurvey ) {
+
+        /* Parsing variables */
+        int csParse = 0;
+
+        /* Reset anchor */
+        csSurvey->svAnchor = -1;
+
+        /* Prepare tracks loading */
+        for ( csParse = 0; csParse < csSurvey->svCount; csParse ++ ) {
+
+            /* Assign rendering mode */
+            csSurvey->svTrack[csParse].tkMode = csSurvey->svMode;
+
+            /* Update loading state */
+            csSurvey->svTrack[csParse].tkLoad = CS_VIEW_TRACK_IDLE;
+
+        }
+
+    }
+
+/*
+    Source - Survey deletion
+ */
+
+    void cs_view_survey_delete( cs_View_Survey_t * const csSurvey ) {
+
+        /* Parsing variables */
+        int csParse = 0;
+
+        /* Delete tracks geometry */
+        for ( csParse = 0; csParse < csSurvey->svCount; csParse ++ ) cs_view_track_delete( csSurvey->svTrack + csParse );
+
+        /* Release tracks array */
+        free( csSurvey->svTrack );
+
+        /* Reset survey */
+        csSurvey->svTrack  = NULL;
+        csSurvey->svCount  = 0;
+        csSurvey->svAnchor = -1;
+
+    }
+
+/*
+    Source - Survey progressive update
+ */
+
+    void cs_view_survey_update( cs_View_Survey_t * const csSurvey, GLuint const csTag ) {
+
+        /* Parsing variables */
+        int csParse = 0;
+        int csAxis  = 0;
+
+        /* Loading workers variables */
+        int csRunning = 0;
+
+        /* Track pointer variables */
+        cs_View_Track_t * csTrack = NULL;
+
+        /* Offset variables */
+        double csOffset = 0.0;
+
+        /* Count running loading workers */
+        for ( csParse = 0; csParse < csSurvey->svCount; csParse ++ ) {
+
+            /* Check loading state */
+            if ( ( csSurvey->svTrack[csParse].tkLoad == CS_VIEW_TRACK_RUN ) || ( csSurvey->svTrack[csParse].tkLoad == CS_VIEW_TRACK_READY ) ) csRunning ++;
+
+        }
+
+        /* Start pending loading workers */
+        for ( csParse = 0; ( csParse < csSurvey->svCount ) && ( csRunning < CS_VIEW_SURVEY_WORKERS ); csParse ++ ) {
+
+            /* Check loading state */
+            if ( csSurvey->svTrack[csParse].tkLoad != CS_VIEW_TRACK_IDLE ) continue;
+
+            /* Start track loading */
+            if ( cs_view_track_create( csSurvey->svTrack + csParse ) == LC_TRUE ) csRunning ++;
+
+        }
+
+        /* Update tracks loading */
+        for ( csParse = 0; csParse < csSurvey->svCount; csParse ++ ) {
+
+            /* Track pointer */
+            csTrack = csSurvey->svTrack + csParse;
+
+            /* Update track loading */
+            cs_view_track_update( csTrack, csTag + csParse );
+
+            /* Check anchor track */
+            if ( ( csSurvey->svAnchor < 0 ) && ( csTrack->tkBound == LC_TRUE ) ) {
+
+                /* Assign anchor track */
+                csSurvey->svAnchor = csParse;
+
+                /* Assign scene origin */
+                for ( csAxis = 0; csAxis < 3; csAxis ++ ) csSurvey->svOrigin[csAxis] = csTrack->tkOrigin[csAxis];
+
+                /* Reset initial position and assign initial means */
+                cs_view_controls_reset( CS_VIEW_CONTROLS_SET, csTrack->tkMean[0], csTrack->tkMean[2], csTrack->tkMean[1] );
+
+            }
+
+        }
+
+        /* Reset loading statistics */
+        csStats.stSegments = csSurvey->svCount;
+        csStats.stRecords  = 0;
+        csStats.stParsed   = 0;
+
+        /* Initialise survey extremums on anchor track */
+        if ( csSurvey->svAnchor >= 0 ) {
+
+            /* Initialise extremums */
+            for ( csAxis = 0; csAxis < 3; csAxis ++ ) {
+
+                /* Assign anchor track extremums */
+                csSurvey->svMin[csAxis] = csSurvey->svTrack[csSurvey->svAnchor].tkMin[csAxis];
+                csSurvey->svMax[csAxis] = csSurvey->svTrack[csSurvey->svAnchor].tkMax[csAxis];
+
+            }
+
+        }
+
+        /* Update loading statistics and survey extremums */
+        for ( csParse = 0; csParse < csSurvey->svCount; csParse ++ ) {
+
+            /* Track pointer */
+            csTrack = csSurvey->svTrack + csParse;
+
+            /* Check loading state */
+            if ( ( csTrack->tkLoad == CS_VIEW_TRACK_RUN ) || ( csTrack->tkLoad == CS_VIEW_TRACK_READY ) ) {
+
+                /* Accumulate loading progress */
+                pthread_mutex_lock( & csTrack->tkMutex );
+                csStats.stRecords += csTrack->tkRecords;
+                csStats.stParsed  += csTrack->tkParsed;
+                pthread_mutex_unlock( & csTrack->tkMutex );
+
+            } else {
+
+                /* Accumulate loading progress */
+                csStats.stRecords += csTrack->tkRecords;
+                csStats.stParsed  += csTrack->tkParsed;
+
+            }
+
+            /* Check track extremums */
+            if ( csTrack->tkBound == LC_FALSE ) continue;
+
+            /* Update survey extremums in scene coordinates */
+            for ( csAxis = 0; csAxis < 3; csAxis ++ ) {
+
+                /* Compute track offset */
+                csOffset = csTrack->tkOrigin[csAxis] - csSurvey->svOrigin[csAxis];
+
+                /* Update extremums */
+                if ( csTrack->tkMin[csAxis] + csOffset < csSurvey->svMin[csAxis] ) csSurvey->svMin[csAxis] = csTrack->tkMin[csAxis] + csOffset;
+                if ( csTrack->tkMax[csAxis] + csOffset > csSurvey->svMax[csAxis] ) csSurvey->svMax[csAxis] = csTrack->tkMax[csAxis] + csOffset;
+
+            }
+
+        }
+
+    }
+
+/*
+    Source - Survey loading termination
+ */
+
+    int cs_view_survey_done( cs_View_Survey_t const * const csSurvey ) {
+
+        /* Parsing variables */
+        int csParse = 0;
+
+        /* Check tracks loading state */
+        for ( csParse = 0; csParse < csSurvey->svCount; csParse ++ ) {
+
+            /* Check loading state */
+            if ( csSurvey->svTrack[csParse].tkLoad != CS_VIEW_TRACK_DONE ) return( LC_FALSE );
+
+        }
+
+        /* Send message */
+        return( LC_TRUE );
+
+    }
+
+/*
+    Source - Survey rendering
+ */
+
+    void cs_view_survey_draw( cs_View_Survey_t const * const csSurvey, GLuint const csTag ) {
+
+        /* Parsing variables */
+        int csParse = 0;
+        int csPlane = 0;
+        int csAxis  = 0;
+
+        /* Track pointer variables */
+        cs_View_Track_t const * csTrack = NULL;
+
+        /* Frustum variables */
+        double csFrustum[24] = { 0.0 };
+        double csLocal  [24] = { 0.0 };
+
+        /* Track coordinates variables */
+        double csOffset[3] = { 0.0 };
+        double csCamera[3] = { 0.0 };
+
+        /* Track bounding box variables */
+        GLfloat csMin[3] = { 0.0 };
+        GLfloat csMax[3] = { 0.0 };
+
+        /* Reset drawn segments count */
+        csStats.stVisible = 0;
+
+        /* Check anchor track */
+        if ( csSurvey->svAnchor < 0 ) return;
+
+        /* Camera translation */
+        glPushMatrix(); {
+
+            /* Transfromation - Translation */
+            glTranslated( - csPosition.psLon, - csPosition.psAlt, - csPosition.psLat );
+
+            /* Extract frustum planes in scene coordinates */
+            cs_view_survey_frustum( csFrustum );
+
+        } glPopMatrix();
+
+        /* Draw segments */
+        for ( csParse = 0; csParse < csSurvey->svCount; csParse ++ ) {
+
+            /* Track pointer */
+            csTrack = csSurvey->svTrack + csParse;
+
+            /* Check track extremums */
+            if ( csTrack->tkBound == LC_FALSE ) continue;
+
+            /* Compute track offset and camera position in track coordinates */
+            csOffset[0] = csTrack->tkOrigin[0] - csSurvey->svOrigin[0], csCamera[0] = csPosition.psLon - csOffset[0];
+            csOffset[1] = csTrack->tkOrigin[1] - csSurvey->svOrigin[1], csCamera[1] = csPosition.psAlt - csOffset[1];
+            csOffset[2] = csTrack->tkOrigin[2] - csSurvey->svOrigin[2], csCamera[2] = csPosition.psLat - csOffset[2];
+
+            /* Compute frustum planes in track coordinates */
+            for ( csPlane = 0; csPlane < 24; csPlane += 4 ) {
+
+                /* Assign plane normal */
+                csLocal[csPlane    ] = csFrustum[csPlane    ];
+                csLocal[csPlane + 1] = csFrustum[csPlane + 1];
+                csLocal[csPlane + 2] = csFrustum[csPlane + 2];
+
+                /* Translate plane */
+                csLocal[csPlane + 3] = csFrustum[csPlane + 3] + csFrustum[csPlane] * csOffset[0] + csFrustum[csPlane + 1] * csOffset[1] + csFrustum[csPlane + 2] * csOffset[2];
+
+            }
+
+            /* Compute track bounding box, ground included */
+            for ( csAxis = 0; csAxis < 3; csAxis ++ ) {
+
+                /* Compute bounding box */
+                csMin[csAxis] = csTrack->tkMin[csAxis] - CS_VIEW_TRACK_BOX;
+                csMax[csAxis] = csTrack->tkMax[csAxis] + CS_VIEW_TRACK_BOX;
+
+            }
+
+            /* Cull segment outside view frustum */
+            if ( cs_view_track_inside( csMin, csMax, csLocal ) == LC_FALSE ) continue;
+
+            /* Update drawn segments count */
+            csStats.stVisible ++;
+
+            /* Display list - Segment */
+            glPushMatrix(); {
+
+                /* Transfromation - Translation */
+                glTranslated( - csCamera[0], - csCamera[1], - csCamera[2] );
+
+                /* Check rendering mode */
+                if ( csTrack->tkMode == CS_MODE_BUFFER ) {
+
+                    /* Draw vertex buffer */
+                    cs_view_track_draw( csTrack, csCamera, csLocal );
+
+                } else {
+
+                    /* Call display list */
+                    glCallList( csTag + csParse );
+
+                    /* Accumulate drawing statistics */
+                    cs_view_hud_chunk( 0, csTrack->tkList );
+
+                }
+
+            } glPopMatrix();
+
+        }
+
+    }
+
+/*
+    Source - View frustum planes
+ */
+
+    void cs_view_survey_frustum( double * const csFrustum ) {
+
+        /* Matrices variables */
+        GLdouble csProjection[16] = { 0.0 };
+        GLdouble csModelview [16] = { 0.0 };
+        GLdouble csClip      [16] = { 0.0 };
+
+        /* Parsing variables */
+        int csRow    = 0;
+        int csColumn = 0;
+        int csParse  = 0;
+        int csPlane  = 0;
+
+        /* Read current matrices */
+        glGetDoublev( GL_PROJECTION_MATRIX, csProjection );
+        glGetDoublev( GL_MODELVIEW_MATRIX , csModelview  );
+
+        /* Compute clip matrix, matrices being stored by columns */
+        for ( csColumn = 0; csColumn < 4; csColumn ++ ) {
+
+            /* Compute clip matrix column */
+            for ( csRow = 0; csRow < 4; csRow ++ ) {
+
+                /* Compute clip matrix element */
+                for ( csParse = 0; csParse < 4; csParse ++ ) csClip[csColumn * 4 + csRow] += csProjection[csParse * 4 + csRow] * csModelview[csColumn * 4 + csParse];
+
+            }
+
+        }
+
+        /* Compute left/right, bottom/top and near/far planes */
+        for ( csPlane = 0; csPlane < 6; csPlane ++ ) {
+
+            /* Compute plane coefficients from fourth row and sign of x, y or z row */
+            for ( csColumn = 0; csColumn < 4; csColumn ++ ) {
+
+                /* Compute plane coefficient */
+                csFrustum[csPlane * 4 + csColumn] = csClip[csColumn * 4 + 3] + ( ( csPlane & 1 ) ? - 1.0 : + 1.0 ) * csClip[csColumn * 4 + ( csPlane >> 1 )];
+
+            }
+
+        }
+
+    }
+
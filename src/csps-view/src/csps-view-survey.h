@@ -0,0 +1,196 @@
+/*
+ * csps-suite - CSPS library front-end suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   csps-view-survey.h
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *   
+     *  Survey segments management and culling
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __CS_VIEW_SURVEY__
+    # define __CS_VIEW_SURVEY__
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    extern "C" {
+    # endif
+
+/* 
+    Header - Includes
+ */
+
+    # include "csps-view-features.h"
+    # include "csps-view-controls.h"
+    # include "csps-view-track.h"
+    # include "csps-view-hud.h"
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define maximum number of simultaneous loading workers */
+    # define CS_VIEW_SURVEY_WORKERS     4
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Survey segment insertion
+     *  
+     *  This function appends a segment to the survey. The track of the segment
+     *  is only loaded after the survey creation. Segments can not be appended
+     *  while the survey is loading.
+     *  
+     *  \param csSurvey     Survey structure
+     *  \param csSegment    Segment CSPS structure path
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int cs_view_survey_append ( cs_View_Survey_t * const csSurvey, char const * const csSegment );
+
+    /*! \brief Survey creation
+     *  
+     *  This function prepares the tracks of the survey segments for loading,
+     *  the loading workers being started by cs_view_survey_update.
+     *  
+     *  \param csSurvey Survey structure
+     */
+
+    void cs_view_survey_create ( cs_View_Survey_t * const csSurvey );
+
+    /*! \brief Survey deletion
+     *  
+     *  This function stops the loading of the survey segments, releases their
+     *  tracks geometry and removes the segments from the survey.
+     *  
+     *  \param csSurvey Survey structure
+     */
+
+    void cs_view_survey_delete ( cs_View_Survey_t * const csSurvey );
+
+    /*! \brief Survey progressive update
+     *  
+     *  This function is called by the rendering thread before each frame. It
+     *  starts the loading workers of the pending segments, keeping at most
+     *  CS_VIEW_SURVEY_WORKERS of them running, and updates the tracks of the
+     *  loading segments. The first track providing poses becomes the anchor
+     *  of the scene : its origin is used as scene origin and the camera is
+     *  reset on its first poses. The survey extremums and the loading progress
+     *  statistics are then updated.
+     *  
+     *  \param csSurvey Survey structure
+     *  \param csTag    First OpenGL display list index, each segment using
+     *                  the index following the one of the previous segment
+     */
+
+    void cs_view_survey_update ( cs_View_Survey_t * const csSurvey, GLuint const csTag );
+
+    /*! \brief Survey loading termination
+     *  
+     *  This function checks if the tracks of all the survey segments are
+     *  loaded.
+     *  
+     *  \param csSurvey Survey structure
+     *
+     *  \return Returns LC_TRUE if the loading is terminated, LC_FALSE
+     *          otherwise
+     */
+
+    int cs_view_survey_done ( cs_View_Survey_t const * const csSurvey );
+
+    /*! \brief Survey rendering
+     *  
+     *  This function draws the tracks of the survey segments. The modelview
+     *  matrix is expected to hold the camera rotation. The segments whose
+     *  bounding box, ground included, lies outside the view frustum are not
+     *  drawn. The others are translated from their origin to the camera in
+     *  double precision and drawn, their chunks being culled individually in
+     *  vertex buffer mode.
+     *  
+     *  \param csSurvey Survey structure
+     *  \param csTag    First OpenGL display list index
+     */
+
+    void cs_view_survey_draw ( cs_View_Survey_t const * const csSurvey, GLuint const csTag );
+
+    /*! \brief View frustum planes
+     *  
+     *  This function extracts the six planes equations of the view frustum
+     *  from the current projection and modelview matrices. The planes normals
+     *  point inside the frustum and are not normalised.
+     *  
+     *  \param csFrustum    Array receiving the planes as six consecutive
+     *                      a, b, c, d coefficients
+     */
+
+    void cs_view_survey_frustum ( double * const csFrustum );
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    }
+    # endif
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
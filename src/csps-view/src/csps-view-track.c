@@ -0,0 +1,1155 @@
+/*
+ * csps-suite - CSPS library front-end suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+
+/* 
+    Source - Includes
+ */
+
+    # include "csps-view-track.h"
+
+/* 
+    Source - Global variables (GLUT!)
+ */
+
+    extern cs_View_Position_t csPosition;
+    extern cs_View_Keyboard_t csKeyboard;
+    extern cs_View_Mouse_t    csMouse;
+    extern cs_View_List_t     csList;
+    extern cs_View_Survey_t   csSurvey;
+    extern cs_View_Path_t     csPath;
+    extern cs_View_Stats_t    csStats;
+
+/*
+    Source - Track geometry creation
+ */
+
+    int cs_view_track_create( cs_View_Track_t * const csTrack ) {
+
+        /* Reset loading state */
+        csTrack->tkLoad    = CS_VIEW_TRACK_RUN;
+        csTrack->tkCancel  = LC_FALSE;
+        csTrack->tkPose    = NULL;
+        csTrack->tkPoses   = 0;
+        csTrack->tkRecords = 0;
+        csTrack->tkParsed  = 0;
+        csTrack->tkBound   = LC_FALSE;
+
+        /* Create loading state mutex */
+        pthread_mutex_init( & csTrack->tkMutex, NULL );
+
+        /* Create and check loading worker */
+        if ( pthread_create( & csTrack->tkThread, NULL, cs_view_track_worker, csTrack ) != 0 ) {
+
+            /* Delete loading state mutex */
+            pthread_mutex_destroy( & csTrack->tkMutex );
+
+            /* Update loading state */
+            csTrack->tkLoad = CS_VIEW_TRACK_DONE;
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : unable to create loading thread\n" );
+
+            /* Send message */
+            return( LC_FALSE );
+
+        }
+
+        /* Send message */
+        return( LC_TRUE );
+
+    }
+
+/*
+    Source - Track geometry deletion
+ */
+
+    void cs_view_track_delete( cs_View_Track_t * const csTrack ) {
+
+        /* Check loading state */
+        if ( ( csTrack->tkLoad == CS_VIEW_TRACK_RUN ) || ( csTrack->tkLoad == CS_VIEW_TRACK_READY ) ) {
+
+            /* Request loading cancellation */
+            pthread_mutex_lock( & csTrack->tkMutex );
+            csTrack->tkCancel = LC_TRUE;
+            pthread_mutex_unlock( & csTrack->tkMutex );
+
+            /* Wait loading worker */
+            pthread_join( csTrack->tkThread, NULL );
+
+            /* Delete loading state mutex */
+            pthread_mutex_destroy( & csTrack->tkMutex );
+
+            /* Release poses array */
+            free( csTrack->tkPose );
+
+            /* Update loading state */
+            csTrack->tkLoad = CS_VIEW_TRACK_DONE;
+            csTrack->tkPose = NULL;
+
+        }
+
+        /* Check vertex buffer object */
+        if ( csTrack->tkBuffer != 0 ) {
+
+            /* Delete vertex buffer object */
+            glDeleteBuffers( 1, & csTrack->tkBuffer );
+
+            /* Reset vertex buffer object name */
+            csTrack->tkBuffer = 0;
+
+        }
+
+        /* Release vertices and chunks arrays */
+        free( csTrack->tkData  );
+        free( csTrack->tkChunk );
+
+        /* Reset vertices and chunks arrays */
+        csTrack->tkData     = NULL;
+        csTrack->tkSize     = 0;
+        csTrack->tkAlloc    = 0;
+        csTrack->tkUpload   = 0;
+        csTrack->tkCapacity = 0;
+        csTrack->tkChunk    = NULL;
+        csTrack->tkChunks   = 0;
+
+    }
+
+/*
+    Source - Track loading worker
+ */
+
+    void * cs_view_track_worker( void * csTrack ) {
+
+        /* Track pointer variables */
+        cs_View_Track_t * csLoad = ( cs_View_Track_t * ) csTrack;
+
+        /* Parsing variables */
+        lp_Size_t csParse = 0;
+
+        /* Records count variables */
+        lp_Size_t csSize = 0;
+
+        /* CSPS query variables */
+        lp_Trigger_t  csTrigger;
+        lp_Position_t csPosition;
+        lp_Orient_t   csOrient;
+
+        /* Pose cache variables */
+        char const * csDevice[6] = { csPath.ptCAMd, csPath.ptCAMm, csPath.ptGPSd, csPath.ptGPSm, csPath.ptIMUd, csPath.ptIMUm };
+        int          csCached    = LC_FALSE;
+        lc_Cache_t   csCache;
+
+        /* Pose records variables */
+        lc_Pose_t         csRecord;
+        lc_Pose_t       * csStore  = NULL;
+        lc_Pose_t const * csSource = NULL;
+
+        /* Poses variables */
+        cs_View_Pose_t * csPose  = NULL;
+        GLsizei          csCount = 0;
+
+        /* Cancellation variables */
+        int csCancel = LC_FALSE;
+
+        /* Define flags */
+        int csIF = 0;
+
+        /* Cartesian coordinates variables */
+        double csPX = 0.0, csPY = 0.0, csPZ = 0.0;
+
+        /* Initial position memory */
+        double csIX = 0.0, csIY = 0.0, csIZ = 0.0;
+
+        /* Check pose cache */
+        if ( ( csCached = lc_pose_open( & csCache, csLoad->tkPath, csDevice ) ) == LC_TRUE ) {
+
+            /* Retrieve records count */
+            csSize = csCache.caCount;
+
+        } else {
+
+            /* Create query descriptors */
+            csTrigger  = lp_query_trigger_create    ( csLoad->tkPath, csPath.ptCAMd, csPath.ptCAMm );
+            csPosition = lp_query_position_create   ( csLoad->tkPath, csPath.ptGPSd, csPath.ptGPSm );
+            csOrient   = lp_query_orientation_create( csLoad->tkPath, csPath.ptIMUd, csPath.ptIMUm );
+
+            /* Retrieve records count */
+            csSize = lp_query_trigger_size( & csTrigger );
+
+            /* Allocate pose records to store, caching being skipped on failure */
+            csStore = ( lc_Pose_t * ) malloc( ( csSize + 1 ) * sizeof( lc_Pose_t ) );
+
+        }
+
+        /* Allocate and check poses array */
+        if ( ( csPose = ( cs_View_Pose_t * ) malloc( ( csSize + 1 ) * sizeof( cs_View_Pose_t ) ) ) == NULL ) {
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : unable to allocate track memory\n" );
+
+        } else {
+
+            /* Publish poses array and records count */
+            pthread_mutex_lock( & csLoad->tkMutex );
+            csLoad->tkPose    = csPose;
+            csLoad->tkRecords = csSize;
+            pthread_mutex_unlock( & csLoad->tkMutex );
+
+            /* Loop on camera records */
+            for ( csParse = 0; ( csParse < csSize ) && ( csCancel == LC_FALSE ); csParse ++ ) {
+
+                /* Check pose cache */
+                if ( csCached == LC_TRUE ) {
+
+                    /* Retrieve cached pose record */
+                    csSource = csCache.caPose + csParse;
+
+                } else {
+
+                    /* Query position and orientation by timestamp */
+                    lc_pose_query( & csRecord, & csTrigger, & csPosition, & csOrient, NULL, csParse );
+
+                    /* Store pose record */
+                    if ( csStore != NULL ) csStore[csParse] = csRecord;
+
+                    /* Assign queried pose record */
+                    csSource = & csRecord;
+
+                }
+
+                /* Check query results */
+                if ( ( csSource->pcLocated == LP_TRUE ) && ( csSource->pcOriented == LP_TRUE ) ) {
+
+                    /* Compute cartesian coordinates using equatorial radius */
+                    csPX = csSource->pcPosition[0] * CS_VIEW_TRACK_RAD2METER;
+                    csPY = csSource->pcPosition[2];
+                    csPZ = csSource->pcPosition[1] * CS_VIEW_TRACK_RAD2METER;
+
+                    /* Save initial position */
+                    if ( csIF == 0 ) {
+
+                        /* Save components */
+                        csIX = + csPX;
+                        csIY = + csPY;
+                        csIZ = + csPZ;
+
+                        /* Assign track origin, published with the first poses */
+                        csLoad->tkOrigin[0] = csIX;
+                        csLoad->tkOrigin[1] = csIY;
+                        csLoad->tkOrigin[2] = csIZ;
+
+                    } csIF = 1;
+
+                    /* Compute relative coordinates */
+                    csPX -= csIX;
+                    csPY -= csIY;
+                    csPZ -= csIZ;
+
+                    /* Assign pose position */
+                    csPose[csCount].poPoint[0] = csPX;
+                    csPose[csCount].poPoint[1] = csPY;
+                    csPose[csCount].poPoint[2] = csPZ;
+
+                    /* Assign pose frame vectors */
+                    csPose[csCount].poFrame[0] = csPX + csSource->pcFrame[0] * CS_VIEW_TRACK_FRAME;
+                    csPose[csCount].poFrame[1] = csPY + csSource->pcFrame[2] * CS_VIEW_TRACK_FRAME;
+                    csPose[csCount].poFrame[2] = csPZ + csSource->pcFrame[1] * CS_VIEW_TRACK_FRAME;
+                    csPose[csCount].poFrame[3] = csPX + csSource->pcFrame[3] * CS_VIEW_TRACK_FRAME;
+                    csPose[csCount].poFrame[4] = csPY + csSource->pcFrame[5] * CS_VIEW_TRACK_FRAME;
+                    csPose[csCount].poFrame[5] = csPZ + csSource->pcFrame[4] * CS_VIEW_TRACK_FRAME;
+                    csPose[csCount].poFrame[6] = csPX + csSource->pcFrame[6] * CS_VIEW_TRACK_FRAME;
+                    csPose[csCount].poFrame[7] = csPY + csSource->pcFrame[8] * CS_VIEW_TRACK_FRAME;
+                    csPose[csCount].poFrame[8] = csPZ + csSource->pcFrame[7] * CS_VIEW_TRACK_FRAME;
+
+                    /* Check batch completion */
+                    if ( ( ++ csCount % CS_VIEW_TRACK_CHUNK ) == 0 ) {
+
+                        /* Publish poses batch and read cancellation flag */
+                        pthread_mutex_lock( & csLoad->tkMutex );
+                        csLoad->tkPoses  = csCount;
+                        csLoad->tkParsed = csParse + 1;
+                        csCancel = csLoad->tkCancel;
+                        pthread_mutex_unlock( & csLoad->tkMutex );
+
+                    }
+
+                }
+
+            }
+
+        }
+
+        /* Check pose cache */
+        if ( csCached == LC_TRUE ) {
+
+            /* Unmap pose cache */
+            lc_pose_close( & csCache );
+
+        } else {
+
+            /* Export completed pose records in cache */
+            if ( ( csStore != NULL ) && ( csParse == csSize ) ) lc_pose_write( & csCache, csStore, csSize, LC_POSE_NOSTILL );
+
+            /* Release pose records */
+            free( csStore );
+
+            /* Delete queries descriptors */
+            lp_query_trigger_delete    ( & csTrigger  );
+            lp_query_position_delete   ( & csPosition );
+            lp_query_orientation_delete( & csOrient   );
+
+        }
+
+        /* Publish last poses and loading termination */
+        pthread_mutex_lock( & csLoad->tkMutex );
+        csLoad->tkPoses  = csCount;
+        csLoad->tkParsed = csParse;
+        csLoad->tkLoad   = CS_VIEW_TRACK_READY;
+        pthread_mutex_unlock( & csLoad->tkMutex );
+
+        /* Terminate thread */
+        return( NULL );
+
+    }
+
+/*
+    Source - Track progressive update
+ */
+
+    void cs_view_track_update( cs_View_Track_t * const csTrack, GLuint const csTag ) {
+
+        /* Loading state variables */
+        cs_View_Pose_t * csPose  = NULL;
+        GLsizei          csCount = 0;
+        int              csLoad  = CS_VIEW_TRACK_RUN;
+
+        /* Parsing variables */
+        GLsizei csParse = 0;
+
+        /* Display list vertices variables */
+        GLsizei csVertices = 0;
+
+        /* Mean position accumulators variables */
+        double csLon = 0.0, csLat = 0.0, csAlt = 0.0;
+
+        /* Check loading state */
+        if ( ( csTrack->tkLoad == CS_VIEW_TRACK_IDLE ) || ( csTrack->tkLoad == CS_VIEW_TRACK_DONE ) ) return;
+
+        /* Read loading state */
+        pthread_mutex_lock( & csTrack->tkMutex );
+        csPose  = csTrack->tkPose;
+        csCount = csTrack->tkPoses;
+        csLoad  = csTrack->tkLoad;
+        pthread_mutex_unlock( & csTrack->tkMutex );
+
+        /* Check first poses */
+        if ( ( csTrack->tkSize == 0 ) && ( csCount > 0 ) ) {
+
+            /* Accumulates positions */
+            for ( csParse = 0; csParse < csCount; csParse ++ ) {
+
+                /* Accumulates position */
+                csLon += csPose[csParse].poPoint[0];
+                csAlt += csPose[csParse].poPoint[1];
+                csLat += csPose[csParse].poPoint[2];
+
+            }
+
+            /* Assign initial means */
+            csTrack->tkMean[0] = csLon / csCount;
+            csTrack->tkMean[1] = csAlt / csCount;
+            csTrack->tkMean[2] = csLat / csCount;
+
+        }
+
+        /* Build available chunks */
+        cs_view_track_build( csTrack, csPose, csCount, csLoad == CS_VIEW_TRACK_READY );
+
+        /* Upload vertex buffer */
+        if ( csTrack->tkMode == CS_MODE_BUFFER ) {
+
+            /* Check vertex buffer upload */
+            if ( cs_view_track_upload( csTrack ) == LC_FALSE ) {
+
+                /* Display message */
+                fprintf( LC_ERR, "Warning : unable to create vertex buffer, using display list\n" );
+
+                /* Fall back to display list */
+                csTrack->tkMode = CS_MODE_LIST;
+
+            }
+
+        }
+
+        /* Check display list progressive compilation */
+        if ( ( csTrack->tkMode == CS_MODE_LIST ) && ( csLoad != CS_VIEW_TRACK_READY ) ) {
+
+            /* Count chunks full resolution vertices */
+            for ( csParse = 0; csParse < csTrack->tkChunks; csParse ++ ) csVertices += csTrack->tkChunk[csParse].ckCount[0];
+
+            /* Recompile display list when grown by a quarter */
+            if ( csVertices > csTrack->tkList + ( csTrack->tkList >> 2 ) ) cs_view_track_list( csTrack, csTag );
+
+        }
+
+        /* Check loading termination */
+        if ( csLoad == CS_VIEW_TRACK_READY ) {
+
+            /* Wait loading worker */
+            pthread_join( csTrack->tkThread, NULL );
+
+            /* Delete loading state mutex */
+            pthread_mutex_destroy( & csTrack->tkMutex );
+
+            /* Release poses array */
+            free( csTrack->tkPose );
+
+            /* Update loading state */
+            csTrack->tkLoad = CS_VIEW_TRACK_DONE;
+            csTrack->tkPose = NULL;
+
+            /* Check rendering mode */
+            if ( csTrack->tkMode == CS_MODE_BUFFER ) {
+
+                /* Release vertices array */
+                free( csTrack->tkData );
+
+                /* Reset vertices array */
+                csTrack->tkData  = NULL;
+                csTrack->tkAlloc = 0;
+
+            } else {
+
+                /* Compile track display list */
+                cs_view_track_list( csTrack, csTag );
+
+                /* Release track geometry */
+                cs_view_track_delete( csTrack );
+
+            }
+
+        }
+
+    }
+
+/*
+    Source - Track levels of detail pyramid
+ */
+
+    int cs_view_track_build( cs_View_Track_t * const csTrack, cs_View_Pose_t const * const csPose, GLsizei const csCount, int const csFinal ) {
+
+        /* Returned variables */
+        int csReturn = LC_TRUE;
+
+        /* Parsing variables */
+        GLsizei csParse = 0;
+        GLsizei csFirst = 0;
+        GLsizei csLast  = 0;
+        GLsizei csSize  = 0;
+        int     csLevel = 0;
+        int     csAxis  = 0;
+
+        /* Simplification variables */
+        double          csTolerance = CS_VIEW_TRACK_TOLERANCE;
+        unsigned char * csKeep      = NULL;
+        GLsizei       * csStack     = NULL;
+
+        /* Chunk pointer variables */
+        cs_View_Chunk_t * csBox = NULL;
+
+        /* Check poses count */
+        if ( csCount == 0 ) return( LC_TRUE );
+
+        /* Check first chunk */
+        if ( csTrack->tkSize == 0 ) {
+
+            /* Reserve and check ground vertices */
+            if ( cs_view_track_reserve( csTrack, CS_VIEW_TRACK_GROUND ) == LC_FALSE ) {
+
+                /* Display message */
+                fprintf( LC_ERR, "Error : unable to allocate track memory\n" );
+
+                /* Send message */
+                return( LC_FALSE );
+
+            }
+
+            /* Skip ground vertices */
+            csTrack->tkSize = CS_VIEW_TRACK_GROUND;
+
+            /* Initialise extremums */
+            for ( csAxis = 0; csAxis < 3; csAxis ++ ) csTrack->tkMin[csAxis] = csTrack->tkMax[csAxis] = csPose[0].poPoint[csAxis];
+
+            /* Update extremums availability */
+            csTrack->tkBound = LC_TRUE;
+
+        }
+
+        /* Allocate and check simplification arrays */
+        if ( ( ( csKeep = ( unsigned char * ) malloc( csCount * sizeof( unsigned char ) ) ) == NULL ) || ( ( csStack = ( GLsizei * ) malloc( 2 * ( CS_VIEW_TRACK_CHUNK + 1 ) * sizeof( GLsizei ) ) ) == NULL ) ) {
+
+            /* Release simplification arrays */
+            free( csKeep );
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : unable to allocate track memory\n" );
+
+            /* Send message */
+            return( LC_FALSE );
+
+        }
+
+        /* Build available chunks */
+        for ( csFirst = csTrack->tkChunks * CS_VIEW_TRACK_CHUNK; ( csTrack->tkChunks == 0 ) || ( csFirst < csCount - 1 ); csFirst += CS_VIEW_TRACK_CHUNK ) {
+
+            /* Compute chunk last pose */
+            csLast = ( csFirst + CS_VIEW_TRACK_CHUNK < csCount - 1 ) ? csFirst + CS_VIEW_TRACK_CHUNK : csCount - 1;
+
+            /* Keep last chunk until final poses */
+            if ( ( csLast == csCount - 1 ) && ( csFinal == LC_FALSE ) ) break;
+
+            /* Reallocate and check chunks array */
+            if ( ( csBox = ( cs_View_Chunk_t * ) realloc( csTrack->tkChunk, ( csTrack->tkChunks + 1 ) * sizeof( cs_View_Chunk_t ) ) ) == NULL ) {
+
+                /* Abort chunks building */
+                csReturn = LC_FALSE; break;
+
+            }
+
+            /* Assign chunks array */
+            csTrack->tkChunk = csBox;
+
+            /* Chunk pointer */
+            csBox = csTrack->tkChunk + csTrack->tkChunks;
+
+            /* Initialise chunk bounding box */
+            for ( csAxis = 0; csAxis < 3; csAxis ++ ) csBox->ckMin[csAxis] = csBox->ckMax[csAxis] = csPose[csFirst].poPoint[csAxis];
+
+            /* Compute chunk bounding box */
+            for ( csParse = csFirst; csParse <= csLast; csParse ++ ) {
+
+                /* Update bounding box on each axis */
+                for ( csAxis = 0; csAxis < 3; csAxis ++ ) {
+
+                    /* Update bounding box */
+                    if ( csPose[csParse].poPoint[csAxis] < csBox->ckMin[csAxis] ) csBox->ckMin[csAxis] = csPose[csParse].poPoint[csAxis];
+                    if ( csPose[csParse].poPoint[csAxis] > csBox->ckMax[csAxis] ) csBox->ckMax[csAxis] = csPose[csParse].poPoint[csAxis];
+
+                }
+
+            }
+
+            /* Update extremums and extend bounding box to frames and gravity indicators */
+            for ( csAxis = 0; csAxis < 3; csAxis ++ ) {
+
+                /* Update extremums */
+                if ( csBox->ckMin[csAxis] < csTrack->tkMin[csAxis] ) csTrack->tkMin[csAxis] = csBox->ckMin[csAxis];
+                if ( csBox->ckMax[csAxis] > csTrack->tkMax[csAxis] ) csTrack->tkMax[csAxis] = csBox->ckMax[csAxis];
+
+                /* Extend bounding box */
+                csBox->ckMin[csAxis] -= CS_VIEW_TRACK_FRAME;
+                csBox->ckMax[csAxis] += CS_VIEW_TRACK_FRAME;
+
+            } csBox->ckMin[1] -= CS_VIEW_TRACK_GRAVITY;
+
+            /* Reserve and check chunk vertices */
+            if ( cs_view_track_reserve( csTrack, ( csLast - csFirst + 1 ) * CS_VIEW_TRACK_POSE * CS_LEVELS ) == LC_FALSE ) {
+
+                /* Abort chunks building */
+                csReturn = LC_FALSE; break;
+
+            }
+
+            /* Build chunk levels */
+            for ( csLevel = 0, csTolerance = CS_VIEW_TRACK_TOLERANCE; csLevel < CS_LEVELS; csLevel ++ ) {
+
+                /* Check level */
+                if ( csLevel == 0 ) {
+
+                    /* Keep all poses */
+                    memset( csKeep + csFirst, 1, csLast - csFirst + 1 );
+
+                } else {
+
+                    /* Simplify chunk positions */
+                    cs_view_track_simplify( csPose, csFirst, csLast, csTolerance, csKeep, csStack );
+
+                    /* Update tolerance */
+                    csTolerance *= 4.0;
+
+                }
+
+                /* Assign level first vertex */
+                csBox->ckFirst[csLevel] = csTrack->tkSize;
+
+                /* Build chunk level geometry */
+                cs_view_track_chunk( csTrack, csPose, csFirst, csLast, csLast == csCount - 1, csLevel, csKeep );
+
+                /* Assign level vertices count */
+                csBox->ckCount[csLevel] = csTrack->tkSize - csBox->ckFirst[csLevel];
+
+            }
+
+            /* Update chunks count */
+            csTrack->tkChunks ++;
+
+        }
+
+        /* Release simplification arrays */
+        free( csKeep  );
+        free( csStack );
+
+        /* Display message */
+        if ( csReturn == LC_FALSE ) fprintf( LC_ERR, "Error : unable to allocate track memory\n" );
+
+        /* Rewind vertices array to ground vertices */
+        csSize = csTrack->tkSize, csTrack->tkSize = 0;
+
+        /* Send ground vertices */
+        cs_view_track_vertex( csTrack, csTrack->tkMin[0] - CS_VIEW_TRACK_BOX, csTrack->tkMin[1] - CS_VIEW_TRACK_BOX, csTrack->tkMin[2] - CS_VIEW_TRACK_BOX, 0.90, 0.90, 0.90 );
+        cs_view_track_vertex( csTrack, csTrack->tkMax[0] + CS_VIEW_TRACK_BOX, csTrack->tkMin[1] - CS_VIEW_TRACK_BOX, csTrack->tkMin[2] - CS_VIEW_TRACK_BOX, 0.90, 0.90, 0.90 );
+        cs_view_track_vertex( csTrack, csTrack->tkMax[0] + CS_VIEW_TRACK_BOX, csTrack->tkMin[1] - CS_VIEW_TRACK_BOX, csTrack->tkMax[2] + CS_VIEW_TRACK_BOX, 0.90, 0.90, 0.90 );
+        cs_view_track_vertex( csTrack, csTrack->tkMin[0] - CS_VIEW_TRACK_BOX, csTrack->tkMin[1] - CS_VIEW_TRACK_BOX, csTrack->tkMax[2] + CS_VIEW_TRACK_BOX, 0.90, 0.90, 0.90 );
+
+        /* Draw referential frame - x-vector */
+        cs_view_track_vertex( csTrack, csTrack->tkMin[0] - CS_VIEW_TRACK_BOX, csTrack->tkMin[1] - CS_VIEW_TRACK_BOX, csTrack->tkMin[2] - CS_VIEW_TRACK_BOX, 0.70, 0.20, 0.10 );
+        cs_view_track_vertex( csTrack, csTrack->tkMax[0] + CS_VIEW_TRACK_BOX, csTrack->tkMin[1] - CS_VIEW_TRACK_BOX, csTrack->tkMin[2] - CS_VIEW_TRACK_BOX, 0.70, 0.20, 0.10 );
+
+        /* Draw referential frame - y-vector */
+        cs_view_track_vertex( csTrack, csTrack->tkMin[0] - CS_VIEW_TRACK_BOX, csTrack->tkMin[1] - CS_VIEW_TRACK_BOX, csTrack->tkMin[2] - CS_VIEW_TRACK_BOX, 0.20, 0.50, 0.30 );
+        cs_view_track_vertex( csTrack, csTrack->tkMin[0] - CS_VIEW_TRACK_BOX, csTrack->tkMin[1] - CS_VIEW_TRACK_BOX, csTrack->tkMax[2] + CS_VIEW_TRACK_BOX, 0.20, 0.50, 0.30 );
+
+        /* Draw referential frame - z-vector */
+        cs_view_track_vertex( csTrack, csTrack->tkMin[0] - CS_VIEW_TRACK_BOX, csTrack->tkMin[1] - CS_VIEW_TRACK_BOX, csTrack->tkMin[2] - CS_VIEW_TRACK_BOX, 0.20, 0.30, 0.60 );
+        cs_view_track_vertex( csTrack, csTrack->tkMin[0] - CS_VIEW_TRACK_BOX, csTrack->tkMax[1] + CS_VIEW_TRACK_BOX, csTrack->tkMin[2] - CS_VIEW_TRACK_BOX, 0.20, 0.30, 0.60 );
+
+        /* Restore vertices array size */
+        csTrack->tkSize = csSize;
+
+        /* Send message */
+        return( csReturn );
+
+    }
+
+/*
+    Source - Track chunk level geometry
+ */
+
+    void cs_view_track_chunk( cs_View_Track_t * const csTrack, cs_View_Pose_t const * const csPose, GLsizei const csFirst, GLsizei const csLast, int const csFinal, int const csLevel, unsigned char const * const csKeep ) {
+
+        /* Parsing variables */
+        GLsizei csParse = 0;
+
+        /* Previous kept pose variables */
+        GLsizei csPrev = -1;
+
+        /* Frames sub-sampling variables */
+        GLsizei csStep = 1 << csLevel;
+
+        /* Gravity indicators variables */
+        GLfloat csPG[3] = { 0.0 };
+        GLfloat csMG[3] = { 0.0 };
+
+        /* Send positions */
+        for ( csParse = csFirst; csParse <= csLast; csParse ++ ) {
+
+            /* Check simplification flag */
+            if ( csKeep[csParse] == 0 ) continue;
+
+            /* Verify previous point memory */
+            if ( csPrev >= 0 ) {
+
+                /* Compute gravity indicators */
+                csPG[0] = csPose[csParse].poPoint[0]; csPG[1] = csPose[csParse].poPoint[1] - CS_VIEW_TRACK_GRAVITY; csPG[2] = csPose[csParse].poPoint[2];
+                csMG[0] = csPose[csPrev ].poPoint[0]; csMG[1] = csPose[csPrev ].poPoint[1] - CS_VIEW_TRACK_GRAVITY; csMG[2] = csPose[csPrev ].poPoint[2];
+
+                /* Send track line */
+                cs_view_track_line( csTrack, csPose[csPrev].poPoint, csPose[csParse].poPoint, 0.92941, 0.69412, 0.0 );
+
+                /* Send gravity indicator lines */
+                cs_view_track_line( csTrack, csPG, csPose[csParse].poPoint, 0.94, 0.94, 0.94 );
+                cs_view_track_line( csTrack, csMG, csPG, 0.94, 0.94, 0.94 );
+
+            }
+
+            /* Memorize position */
+            csPrev = csParse;
+
+        }
+
+        /* Send frames, the last pose belonging to the next chunk */
+        for ( csParse = csFirst; csParse < csLast + ( csFinal ? 1 : 0 ); csParse ++ ) {
+
+            /* Check frame sub-sampling */
+            if ( ( csParse % csStep ) != 0 ) continue;
+
+            /* Send body vectors */
+            cs_view_track_line( csTrack, csPose[csParse].poPoint, csPose[csParse].poFrame + 0, 0.70, 0.20, 0.10 );
+            cs_view_track_line( csTrack, csPose[csParse].poPoint, csPose[csParse].poFrame + 3, 0.20, 0.50, 0.30 );
+            cs_view_track_line( csTrack, csPose[csParse].poPoint, csPose[csParse].poFrame + 6, 0.20, 0.30, 0.60 );
+
+            /* Verify previous frame */
+            if ( csParse >= csStep ) {
+
+                /* Send body vectors connections */
+                cs_view_track_line( csTrack, csPose[csParse - csStep].poFrame + 0, csPose[csParse].poFrame + 0, 0.70, 0.20, 0.10 );
+                cs_view_track_line( csTrack, csPose[csParse - csStep].poFrame + 3, csPose[csParse].poFrame + 3, 0.20, 0.50, 0.30 );
+                cs_view_track_line( csTrack, csPose[csParse - csStep].poFrame + 6, csPose[csParse].poFrame + 6, 0.20, 0.30, 0.60 );
+
+            }
+
+        }
+
+    }
+
+/*
+    Source - Track simplification
+ */
+
+    void cs_view_track_simplify( cs_View_Pose_t const * const csPose, GLsizei const csFirst, GLsizei const csLast, double const csTolerance, unsigned char * const csKeep, GLsizei * const csStack ) {
+
+        /* Parsing variables */
+        GLsizei csParse = 0;
+        GLsizei csDepth = 0;
+
+        /* Segment variables */
+        GLsizei csA = 0, csB = 0, csFar = 0;
+
+        /* Distance variables */
+        double csDist = 0.0, csMax = 0.0;
+
+        /* Geometry variables */
+        double csU[3] = { 0.0 }, csV[3] = { 0.0 }, csLen = 0.0, csDot = 0.0;
+
+        /* Reset simplification flags */
+        memset( csKeep + csFirst, 0, csLast - csFirst + 1 );
+
+        /* Keep range extremities */
+        csKeep[csFirst] = csKeep[csLast] = 1;
+
+        /* Push initial segment */
+        csStack[csDepth ++] = csFirst;
+        csStack[csDepth ++] = csLast;
+
+        /* Process segments */
+        while ( csDepth > 0 ) {
+
+            /* Pop segment */
+            csB = csStack[-- csDepth];
+            csA = csStack[-- csDepth];
+
+            /* Compute segment vector */
+            csU[0] = csPose[csB].poPoint[0] - csPose[csA].poPoint[0];
+            csU[1] = csPose[csB].poPoint[1] - csPose[csA].poPoint[1];
+            csU[2] = csPose[csB].poPoint[2] - csPose[csA].poPoint[2];
+
+            /* Compute segment squared length */
+            csLen = csU[0] * csU[0] + csU[1] * csU[1] + csU[2] * csU[2];
+
+            /* Search farthest point */
+            for ( csParse = csA + 1, csMax = -1.0, csFar = csA; csParse < csB; csParse ++ ) {
+
+                /* Compute point vector */
+                csV[0] = csPose[csParse].poPoint[0] - csPose[csA].poPoint[0];
+                csV[1] = csPose[csParse].poPoint[1] - csPose[csA].poPoint[1];
+                csV[2] = csPose[csParse].poPoint[2] - csPose[csA].poPoint[2];
+
+                /* Compute projection parameter on segment */
+                csDot = ( csLen > 0.0 ) ? ( csU[0] * csV[0] + csU[1] * csV[1] + csU[2] * csV[2] ) / csLen : 0.0;
+
+                /* Clamp projection parameter */
+                csDot = ( csDot < 0.0 ) ? 0.0 : ( ( csDot > 1.0 ) ? 1.0 : csDot );
+
+                /* Compute point to segment squared distance */
+                csDist = ( csV[0] - csDot * csU[0] ) * ( csV[0] - csDot * csU[0] ) + ( csV[1] - csDot * csU[1] ) * ( csV[1] - csDot * csU[1] ) + ( csV[2] - csDot * csU[2] ) * ( csV[2] - csDot * csU[2] );
+
+                /* Update farthest point */
+                if ( csDist > csMax ) csMax = csDist, csFar = csParse;
+
+            }
+
+            /* Check tolerance */
+            if ( ( csFar != csA ) && ( csMax > csTolerance * csTolerance ) ) {
+
+                /* Keep farthest point */
+                csKeep[csFar] = 1;
+
+                /* Push sub-segments */
+                csStack[csDepth ++] = csA;
+                csStack[csDepth ++] = csFar;
+                csStack[csDepth ++] = csFar;
+                csStack[csDepth ++] = csB;
+
+            }
+
+        }
+
+    }
+
+/*
+    Source - Track chunk level selection
+ */
+
+    int cs_view_track_level( cs_View_Chunk_t const * const csChunk, double const * const csCamera ) {
+
+        /* Selected level variables */
+        int csLevel = 0;
+
+        /* Distance variables */
+        double csDist = 0.0, csDelta = 0.0;
+
+        /* Tolerance variables */
+        double csTolerance = CS_VIEW_TRACK_TOLERANCE;
+
+        /* Parsing variables */
+        int csAxis = 0;
+
+        /* Compute camera to bounding box squared distance */
+        for ( csAxis = 0; csAxis < 3; csAxis ++ ) {
+
+            /* Compute axis distance */
+            csDelta = ( csCamera[csAxis] < csChunk->ckMin[csAxis] ) ? csChunk->ckMin[csAxis] - csCamera[csAxis] : ( ( csCamera[csAxis] > csChunk->ckMax[csAxis] ) ? csCamera[csAxis] - csChunk->ckMax[csAxis] : 0.0 );
+
+            /* Accumulate squared distance */
+            csDist += csDelta * csDelta;
+
+        }
+
+        /* Compute distance */
+        csDist = sqrt( csDist );
+
+        /* Search coarsest admissible level */
+        while ( ( csLevel < CS_LEVELS - 1 ) && ( csTolerance <= csDist * CS_VIEW_TRACK_ERROR ) ) csLevel ++, csTolerance *= 4.0;
+
+        /* Return selected level */
+        return( csLevel );
+
+    }
+
+/*
+    Source - Bounding box visibility
+ */
+
+    int cs_view_track_inside( GLfloat const * const csMin, GLfloat const * const csMax, double const * const csFrustum ) {
+
+        /* Parsing variables */
+        int csPlane = 0;
+
+        /* Plane pointer variables */
+        double const * csEquation = NULL;
+
+        /* Check bounding box against each plane */
+        for ( csPlane = 0, csEquation = csFrustum; csPlane < 6; csPlane ++, csEquation += 4 ) {
+
+            /* Check the corner the farthest along the plane normal */
+            if ( csEquation[0] * ( ( csEquation[0] > 0.0 ) ? csMax[0] : csMin[0] ) + csEquation[1] * ( ( csEquation[1] > 0.0 ) ? csMax[1] : csMin[1] ) + csEquation[2] * ( ( csEquation[2] > 0.0 ) ? csMax[2] : csMin[2] ) + csEquation[3] < 0.0 ) return( LC_FALSE );
+
+        }
+
+        /* Send message */
+        return( LC_TRUE );
+
+    }
+
+/*
+    Source - Track vertices array reservation
+ */
+
+    int cs_view_track_reserve( cs_View_Track_t * const csTrack, GLsizei const csCount ) {
+
+        /* Reallocation variables */
+        GLfloat * csSwap  = NULL;
+        GLsizei   csAlloc = csTrack->tkAlloc;
+
+        /* Check array capacity */
+        if ( csTrack->tkSize + csCount <= csTrack->tkAlloc ) return( LC_TRUE );
+
+        /* Compute array capacity */
+        while ( csAlloc < csTrack->tkSize + csCount ) csAlloc = ( csAlloc > 0 ) ? csAlloc * 2 : csCount;
+
+        /* Reallocate and check array */
+        if ( ( csSwap = ( GLfloat * ) realloc( csTrack->tkData, csAlloc * CS_VIEW_TRACK_STRIDE * sizeof( GLfloat ) ) ) == NULL ) return( LC_FALSE );
+
+        /* Assign array */
+        csTrack->tkData  = csSwap;
+        csTrack->tkAlloc = csAlloc;
+
+        /* Send message */
+        return( LC_TRUE );
+
+    }
+
+/*
+    Source - Track line insertion
+ */
+
+    void cs_view_track_line( cs_View_Track_t * const csTrack, GLfloat const * const csA, GLfloat const * const csB, GLfloat csR, GLfloat csG, GLfloat csBl ) {
+
+        /* Send line vertices */
+        cs_view_track_vertex( csTrack, csA[0], csA[1], csA[2], csR, csG, csBl );
+        cs_view_track_vertex( csTrack, csB[0], csB[1], csB[2], csR, csG, csBl );
+
+    }
+
+/*
+    Source - Track vertex insertion
+ */
+
+    void cs_view_track_vertex( cs_View_Track_t * const csTrack, GLfloat csX, GLfloat csY, GLfloat csZ, GLfloat csR, GLfloat csG, GLfloat csB ) {
+
+        /* Vertex pointer variables */
+        GLfloat * csVertex = csTrack->tkData + ( csTrack->tkSize ++ ) * CS_VIEW_TRACK_STRIDE;
+
+        /* Assign vertex position */
+        csVertex[0] = csX;
+        csVertex[1] = csY;
+        csVertex[2] = csZ;
+
+        /* Assign vertex color */
+        csVertex[3] = csR;
+        csVertex[4] = csG;
+        csVertex[5] = csB;
+
+    }
+
+/*
+    Source - Track vertex buffer upload
+ */
+
+    int cs_view_track_upload( cs_View_Track_t * const csTrack ) {
+
+        /* Check vertices array */
+        if ( csTrack->tkSize == csTrack->tkUpload ) return( LC_TRUE );
+
+        /* Create vertex buffer object */
+        if ( csTrack->tkBuffer == 0 ) glGenBuffers( 1, & csTrack->tkBuffer );
+
+        /* Bind vertex buffer object */
+        glBindBuffer( GL_ARRAY_BUFFER, csTrack->tkBuffer );
+
+        /* Check vertex buffer object capacity */
+        if ( csTrack->tkSize > csTrack->tkCapacity ) {
+
+            /* Enlarge vertex buffer object to vertices array capacity */
+            glBufferData( GL_ARRAY_BUFFER, csTrack->tkAlloc * CS_VIEW_TRACK_STRIDE * sizeof( GLfloat ), NULL, GL_STATIC_DRAW );
+
+            /* Upload vertices array */
+            glBufferSubData( GL_ARRAY_BUFFER, 0, csTrack->tkSize * CS_VIEW_TRACK_STRIDE * sizeof( GLfloat ), csTrack->tkData );
+
+            /* Update vertex buffer object capacity */
+            csTrack->tkCapacity = csTrack->tkAlloc;
+
+        } else {
+
+            /* Upload ground vertices */
+            glBufferSubData( GL_ARRAY_BUFFER, 0, CS_VIEW_TRACK_GROUND * CS_VIEW_TRACK_STRIDE * sizeof( GLfloat ), csTrack->tkData );
+
+            /* Upload appended vertices */
+            glBufferSubData( GL_ARRAY_BUFFER, csTrack->tkUpload * CS_VIEW_TRACK_STRIDE * sizeof( GLfloat ), ( csTrack->tkSize - csTrack->tkUpload ) * CS_VIEW_TRACK_STRIDE * sizeof( GLfloat ), csTrack->tkData + csTrack->tkUpload * CS_VIEW_TRACK_STRIDE );
+
+        }
+
+        /* Unbind vertex buffer object */
+        glBindBuffer( GL_ARRAY_BUFFER, 0 );
+
+        /* Check upload */
+        if ( glGetError() != GL_NO_ERROR ) return( LC_FALSE );
+
+        /* Update uploaded vertices count */
+        csTrack->tkUpload = csTrack->tkSize;
+
+        /* Send message */
+        return( LC_TRUE );
+
+    }
+
+/*
+    Source - Track vertex buffer rendering
+ */
+
+    void cs_view_track_draw( cs_View_Track_t const * const csTrack, double const * const csCamera, double const * const csFrustum ) {
+
+        /* Parsing variables */
+        GLsizei csChunk = 0;
+
+        /* Level variables */
+        int csLevel = 0;
+
+        /* Check vertex buffer object */
+        if ( csTrack->tkBuffer == 0 ) return;
+
+        /* Update line width */
+        glLineWidth( 2.0 );
+
+        /* Bind vertex buffer object */
+        glBindBuffer( GL_ARRAY_BUFFER, csTrack->tkBuffer );
+
+        /* Enable vertex arrays */
+        glEnableClientState( GL_VERTEX_ARRAY );
+        glEnableClientState( GL_COLOR_ARRAY  );
+
+        /* Assign interleaved arrays */
+        glVertexPointer( 3, GL_FLOAT, CS_VIEW_TRACK_STRIDE * sizeof( GLfloat ), ( GLvoid const * ) ( 0 ) );
+        glColorPointer ( 3, GL_FLOAT, CS_VIEW_TRACK_STRIDE * sizeof( GLfloat ), ( GLvoid const * ) ( 3 * sizeof( GLfloat ) ) );
+
+        /* Draw referential frame */
+        glDrawArrays( GL_LINES, 4, CS_VIEW_TRACK_GROUND - 4 );
+
+        /* Draw chunks */
+        for ( csChunk = 0; csChunk < csTrack->tkChunks; csChunk ++ ) {
+
+            /* Cull chunk outside view frustum */
+            if ( cs_view_track_inside( csTrack->tkChunk[csChunk].ckMin, csTrack->tkChunk[csChunk].ckMax, csFrustum ) == LC_FALSE ) continue;
+
+            /* Select chunk level of detail */
+            csLevel = cs_view_track_level( csTrack->tkChunk + csChunk, csCamera );
+
+            /* Draw chunk level */
+            glDrawArrays( GL_LINES, csTrack->tkChunk[csChunk].ckFirst[csLevel], csTrack->tkChunk[csChunk].ckCount[csLevel] );
+
+            /* Accumulate drawing statistics */
+            cs_view_hud_chunk( csLevel, csTrack->tkChunk[csChunk].ckCount[csLevel] );
+
+        }
+
+        /* Draw ground */
+        glDrawArrays( GL_QUADS, 0, 4 );
+
+        /* Disable vertex arrays */
+        glDisableClientState( GL_COLOR_ARRAY  );
+        glDisableClientState( GL_VERTEX_ARRAY );
+
+        /* Unbind vertex buffer object */
+        glBindBuffer( GL_ARRAY_BUFFER, 0 );
+
+    }
+
+/*
+    Source - Track display list compilation
+ */
+
+    void cs_view_track_list( cs_View_Track_t * const csTrack, GLuint const csTag ) {
+
+        /* Parsing variables */
+        GLsizei csChunk = 0;
+        GLsizei csParse = 0;
+
+        /* Vertex pointer variables */
+        GLfloat * csVertex = NULL;
+
+        /* Declare display list begining */
+        glNewList( csTag, GL_COMPILE ); {
+
+            /* Check vertices array */
+            if ( csTrack->tkSize > 0 ) {
+
+                /* Update line width */
+                glLineWidth( 2.0 );
+
+                /* Begin primitive */
+                glBegin( GL_LINES ); {
+
+                    /* Send referential frame vertices */
+                    for ( csParse = 4, csVertex = csTrack->tkData + 4 * CS_VIEW_TRACK_STRIDE; csParse < CS_VIEW_TRACK_GROUND; csParse ++, csVertex += CS_VIEW_TRACK_STRIDE ) {
+
+                        /* Send vertex */
+                        glColor3fv( csVertex + 3 ); glVertex3fv( csVertex );
+
+                    }
+
+                    /* Send chunks full resolution vertices */
+                    for ( csChunk = 0, csTrack->tkList = 0; csChunk < csTrack->tkChunks; csChunk ++ ) {
+
+                        /* Accumulate compiled vertices count */
+                        csTrack->tkList += csTrack->tkChunk[csChunk].ckCount[0];
+
+                        /* Send chunk vertices */
+                        for ( csParse = 0, csVertex = csTrack->tkData + csTrack->tkChunk[csChunk].ckFirst[0] * CS_VIEW_TRACK_STRIDE; csParse < csTrack->tkChunk[csChunk].ckCount[0]; csParse ++, csVertex += CS_VIEW_TRACK_STRIDE ) {
+
+                            /* Send vertex */
+                            glColor3fv( csVertex + 3 ); glVertex3fv( csVertex );
+
+                        }
+
+                    }
+
+                /* End primitive */
+                } glEnd();
+
+                /* Begin primitive */
+                glBegin( GL_QUADS ); {
+
+                    /* Send ground vertices */
+                    for ( csParse = 0, csVertex = csTrack->tkData; csParse < 4; csParse ++, csVertex += CS_VIEW_TRACK_STRIDE ) {
+
+                        /* Send vertex */
+                        glColor3fv( csVertex + 3 ); glVertex3fv( csVertex );
+
+                    }
+
+                /* End primitive */
+                } glEnd();
+
+            }
+
+        /* Declare display list end */
+        } glEndList();
+
+    }
+
+/*
+    Source - Vertex buffer support detection
+ */
+
+    int cs_view_track_support( void ) {
+
+        /* Version variables */
+        int csMajor = 0, csMinor = 0;
+
+        /* Version string variables */
+        char const * csVersion = ( char const * ) glGetString( GL_VERSION );
+
+        /* Check and read version */
+        if ( ( csVersion == NULL ) || ( sscanf( csVersion, "%d.%d", & csMajor, & csMinor ) != 2 ) ) return( LC_FALSE );
+
+        /* Check vertex buffer availability */
+        return( ( ( csMajor > 1 ) || ( ( csMajor == 1 ) && ( csMinor >= 5 ) ) ) ? LC_TRUE : LC_FALSE );
+
+    }
+
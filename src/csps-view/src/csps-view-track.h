@@ -0,0 +1,383 @@
+/*
+ * csps-suite - CSPS library front-end suite
+ *
+ * Copyright (c) 2013-2015 FOXEL SA - http://foxel.ch
+ * Please read <http://foxel.ch/license> for more information.
+ *
+ *
+ * Author(s):
+ *
+ *      Nils Hamel <n.hamel@foxel.ch>
+ *
+ *
+ * This file is part of the FOXEL project <http://foxel.ch>.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Additional Terms:
+ *
+ *      You are required to preserve legal notices and author attributions in
+ *      that material or in the Appropriate Legal Notices displayed by works
+ *      containing it.
+ *
+ *      You are required to attribute the work as explained in the "Usage and
+ *      Attribution" section of <http://foxel.ch/license>.
+ */
+
+    /*! \file   csps-view-track.h
+     *  \author Nils Hamel <n.hamel@foxel.ch>
+     *   
+     *  Track geometry and vertex buffer rendering
+     */
+
+/* 
+    Header - Include guard
+ */
+
+    # ifndef __CS_VIEW_TRACK__
+    # define __CS_VIEW_TRACK__
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    extern "C" {
+    # endif
+
+/* 
+    Header - Includes
+ */
+
+    # include "csps-view-features.h"
+    # include "csps-view-controls.h"
+    # include "csps-view-hud.h"
+
+/* 
+    Header - Preprocessor definitions
+ */
+
+    /* Define vertex components count (position, color) */
+    # define CS_VIEW_TRACK_STRIDE       6
+
+    /* Define maximum vertices count per pose */
+    # define CS_VIEW_TRACK_POSE         18
+
+    /* Define referential and ground vertices count */
+    # define CS_VIEW_TRACK_GROUND       10
+
+    /* Define poses count per chunk */
+    # define CS_VIEW_TRACK_CHUNK        1024
+
+    /* Define simplification tolerance of the first decimated level, in meters */
+    # define CS_VIEW_TRACK_TOLERANCE    0.1
+
+    /* Define admissible angular error for level selection, in radians */
+    # define CS_VIEW_TRACK_ERROR        0.001
+
+    /* Define geoposition to meter factor */
+    # define CS_VIEW_TRACK_RAD2METER    111134.093193
+
+    /* Define frame size */
+    # define CS_VIEW_TRACK_FRAME        2.0
+
+    /* Define box factor */
+    # define CS_VIEW_TRACK_BOX          50.0
+
+    /* Define gravity indicator depth */
+    # define CS_VIEW_TRACK_GRAVITY      10.0
+
+    /* Define loading states */
+    # define CS_VIEW_TRACK_RUN          0
+    # define CS_VIEW_TRACK_READY        1
+    # define CS_VIEW_TRACK_DONE         2
+    # define CS_VIEW_TRACK_IDLE         3
+
+/* 
+    Header - Preprocessor macros
+ */
+
+/* 
+    Header - Typedefs
+ */
+
+/* 
+    Header - Structures
+ */
+
+/* 
+    Header - Function prototypes
+ */
+
+    /*! \brief Track geometry creation
+     *  
+     *  This function starts the loading worker thread of the track and returns
+     *  immediately. The track geometry is then built progressively by calls
+     *  to cs_view_track_update.
+     *  
+     *  \param csTrack  Track structure
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int cs_view_track_create ( cs_View_Track_t * const csTrack );
+
+    /*! \brief Track geometry deletion
+     *  
+     *  This function cancels and waits the loading worker thread if it is
+     *  still running, and releases the poses array, the vertices array, the
+     *  chunks array and the vertex buffer object of the track.
+     *  
+     *  \param csTrack  Track structure
+     */
+
+    void cs_view_track_delete ( cs_View_Track_t * const csTrack );
+
+    /*! \brief Track loading worker
+     *  
+     *  This function is the loading worker thread of the track. It queries the
+     *  positions and orientations of the camera at each record and publishes
+     *  them in the poses array of the track by batches of chunk size. The
+     *  positions are expressed relatively to the first valid position, kept
+     *  as track origin, to preserve float precision. The poses are read from
+     *  the pose cache of the segment when it is valid, and the cache is
+     *  written otherwise.
+     *  
+     *  \param csTrack  Track structure
+     *
+     *  \return Returns NULL
+     */
+
+    void * cs_view_track_worker ( void * csTrack );
+
+    /*! \brief Track progressive update
+     *  
+     *  This function is called by the rendering thread before each frame. It
+     *  builds the chunks of the track made available by the loading worker
+     *  and uploads their vertices in the vertex buffer object. The mean of the
+     *  first loaded positions is kept for the camera initial position. In
+     *  display list mode, the list is recompiled each time the loaded
+     *  vertices grew by a quarter, keeping the recompilation cost linear. When
+     *  the loading is terminated, the worker is joined, the poses array is
+     *  released and, in display list mode, the track is compiled a last time
+     *  in the provided display list.
+     *  
+     *  \param csTrack  Track structure
+     *  \param csTag    OpenGL display list index
+     */
+
+    void cs_view_track_update ( cs_View_Track_t * const csTrack, GLuint const csTag );
+
+    /*! \brief Track levels of detail pyramid
+     *  
+     *  This function appends the chunks that can be built from the provided
+     *  poses to the interleaved vertices array of the track. The array starts
+     *  with the ground quad and the flat earth model frame, rewritten at each
+     *  call to follow the track extent, followed by the geometry of each chunk
+     *  of the track at each level of detail. Level zero holds every pose. At
+     *  level k, the positions are simplified using Douglas-Peucker with a
+     *  tolerance that is multiplied by four at each level and the orientation
+     *  frames are sub-sampled by a factor of 2^k. Unless the provided poses
+     *  are the final ones, the last chunk is kept until more poses are given.
+     *  
+     *  \param csTrack  Track structure
+     *  \param csPose   Poses array
+     *  \param csCount  Number of poses
+     *  \param csFinal  Final poses flag
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int cs_view_track_build ( cs_View_Track_t * const csTrack, cs_View_Pose_t const * const csPose, GLsizei const csCount, int const csFinal );
+
+    /*! \brief Track chunk level geometry
+     *  
+     *  This function appends the geometry of the poses range of a chunk at the
+     *  provided level of detail, according to the provided simplification
+     *  flags, to the vertices array of the track.
+     *  
+     *  \param csTrack  Track structure
+     *  \param csPose   Poses array
+     *  \param csFirst  Index of the first pose of the chunk
+     *  \param csLast   Index of the last pose of the chunk, shared with the
+     *                  next chunk
+     *  \param csFinal  Final chunk flag
+     *  \param csLevel  Level of detail
+     *  \param csKeep   Simplification flags of the poses
+     */
+
+    void cs_view_track_chunk ( cs_View_Track_t * const csTrack, cs_View_Pose_t const * const csPose, GLsizei const csFirst, GLsizei const csLast, int const csFinal, int const csLevel, unsigned char const * const csKeep );
+
+    /*! \brief Track simplification
+     *  
+     *  This function applies the Douglas-Peucker algorithm on the positions of
+     *  the provided poses range. The flags of the kept poses are set to one,
+     *  the others to zero. The range extremities are always kept.
+     *  
+     *  \param csPose       Poses array
+     *  \param csFirst      Index of the first pose of the range
+     *  \param csLast       Index of the last pose of the range
+     *  \param csTolerance  Simplification tolerance, in meters
+     *  \param csKeep       Simplification flags of the poses
+     *  \param csStack      Work array of at least 2 ( csLast - csFirst + 1 ) 
+     *                      indexes
+     */
+
+    void cs_view_track_simplify ( cs_View_Pose_t const * const csPose, GLsizei const csFirst, GLsizei const csLast, double const csTolerance, unsigned char * const csKeep, GLsizei * const csStack );
+
+    /*! \brief Track chunk level selection
+     *  
+     *  This function selects the level of detail of the provided chunk from 
+     *  the distance between the camera and the chunk bounding box. The coarsest
+     *  level whose simplification tolerance stays below the admissible angular
+     *  error at this distance is selected.
+     *  
+     *  \param csChunk  Track chunk
+     *  \param csCamera Camera position, in track coordinates
+     *
+     *  \return Returns level of detail
+     */
+
+    int cs_view_track_level ( cs_View_Chunk_t const * const csChunk, double const * const csCamera );
+
+    /*! \brief Bounding box visibility
+     *  
+     *  This function checks if the provided bounding box intersects the view
+     *  frustum. The box is considered as outside as soon as it lies entirely
+     *  behind one of the frustum planes. Boxes close to the frustum corners
+     *  can be kept while outside, which only costs their drawing.
+     *  
+     *  \param csMin     Bounding box minimum corner
+     *  \param csMax     Bounding box maximum corner
+     *  \param csFrustum Frustum planes equations, as six consecutive a, b, c, d
+     *                   coefficients with inward normals
+     *
+     *  \return Returns LC_TRUE if the box is potentially visible, LC_FALSE
+     *          otherwise
+     */
+
+    int cs_view_track_inside ( GLfloat const * const csMin, GLfloat const * const csMax, double const * const csFrustum );
+
+    /*! \brief Track vertices array reservation
+     *  
+     *  This function ensures that the vertices array of the track is able to
+     *  receive the provided number of additional vertices.
+     *  
+     *  \param csTrack  Track structure
+     *  \param csCount  Number of vertices to reserve
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int cs_view_track_reserve ( cs_View_Track_t * const csTrack, GLsizei const csCount );
+
+    /*! \brief Track line insertion
+     *  
+     *  This function appends a colored line to the vertices array of the
+     *  track. The array has to be allocated to hold the line.
+     *  
+     *  \param csTrack  Track structure
+     *  \param csA      First point
+     *  \param csB      Second point
+     *  \param csR      Red color component
+     *  \param csG      Green color component
+     *  \param csBl     Blue color component
+     */
+
+    void cs_view_track_line ( cs_View_Track_t * const csTrack, GLfloat const * const csA, GLfloat const * const csB, GLfloat csR, GLfloat csG, GLfloat csBl );
+
+    /*! \brief Track vertex insertion
+     *  
+     *  This function appends a colored vertex to the vertices array of the
+     *  track. The array has to be allocated to hold the vertex.
+     *  
+     *  \param csTrack  Track structure
+     *  \param csX      Vertex x coordinate
+     *  \param csY      Vertex y coordinate
+     *  \param csZ      Vertex z coordinate
+     *  \param csR      Red color component
+     *  \param csG      Green color component
+     *  \param csB      Blue color component
+     */
+
+    void cs_view_track_vertex ( cs_View_Track_t * const csTrack, GLfloat csX, GLfloat csY, GLfloat csZ, GLfloat csR, GLfloat csG, GLfloat csB );
+
+    /*! \brief Track vertex buffer upload
+     *  
+     *  This function uploads the vertices appended to the vertices array since
+     *  the last call, and the rewritten ground vertices, in the vertex buffer
+     *  object of the track. The vertex buffer object is created or enlarged
+     *  as needed.
+     *  
+     *  \param csTrack  Track structure
+     *
+     *  \return Returns LC_TRUE on success, LC_FALSE otherwise
+     */
+
+    int cs_view_track_upload ( cs_View_Track_t * const csTrack );
+
+    /*! \brief Track vertex buffer rendering
+     *  
+     *  This function draws the track from its vertex buffer object. The chunks
+     *  outside the view frustum are skipped and the level of detail of the
+     *  others is selected according to the camera position. The drawn chunks
+     *  are accounted in the rendering statistics.
+     *  
+     *  \param csTrack   Track structure
+     *  \param csCamera  Camera position, in track coordinates
+     *  \param csFrustum Frustum planes equations, in track coordinates
+     */
+
+    void cs_view_track_draw ( cs_View_Track_t const * const csTrack, double const * const csCamera, double const * const csFrustum );
+
+    /*! \brief Track display list compilation
+     *  
+     *  This function compiles the vertices array of the track in the provided
+     *  display list using immediate mode primitives. It is used as fallback
+     *  when vertex buffer objects are not available. Only the full resolution
+     *  level is compiled, its vertices count being kept in the track for the
+     *  rendering statistics.
+     *  
+     *  \param csTrack  Track structure
+     *  \param csTag    OpenGL display list index
+     */
+
+    void cs_view_track_list ( cs_View_Track_t * const csTrack, GLuint const csTag );
+
+    /*! \brief Vertex buffer support detection
+     *  
+     *  This function checks if the OpenGL implementation of the current
+     *  context provides vertex buffer objects, available since OpenGL 1.5.
+     *
+     *  \return Returns LC_TRUE if vertex buffers are available, LC_FALSE
+     *          otherwise
+     */
+
+    int cs_view_track_support ( void );
+
+/* 
+    Header - C/C++ compatibility
+ */
+
+    # ifdef __cplusplus
+    }
+    # endif
+
+/*
+    Header - Include guard
+ */
+
+    # endif
+
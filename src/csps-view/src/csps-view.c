@@ -51,7 +51,9 @@
     cs_View_Keyboard_t csKeyboard = { 0, 0 };
     cs_View_Mouse_t    csMouse    = { 0 };
     cs_View_List_t     csList     = { 0 };
-    cs_View_Path_t     csPath     = { "", "mod-DSIDE", "mod-SGNQF", "mod-IFETI", "eyesis4pi", "ls20031", "adis16375" };
+    cs_View_Survey_t   csSurvey   = { CS_MODE_BUFFER, NULL, 0, -1, { 0 }, { 0 }, { 0 } };
+    cs_View_Path_t     csPath     = { "mod-DSIDE", "mod-SGNQF", "mod-IFETI", "eyesis4pi", "ls20031", "adis16375" };
+    cs_View_Stats_t    csStats    = { 0, 0, { 0 }, 0, 0.0, 0.0, -1.0, 0, 0, 0, 0, 0, 0, 0, 0 };
 
 /*
     Source - Software main function
@@ -59,17 +61,46 @@
 
     int main ( int argc, char ** argv ) {
 
-        /* GLUT window handle */
-        int csWindow = 0;
+        /* Headless rendering variables */
+        char csRender[256] = { 0 };
+        char csList  [256] = { 0 };
+        char csSize  [256] = { "1280x720" };
+        char csCamera[256] = { "oblique" };
+
+        /* Headless resolution variables */
+        int csWidth  = 0;
+        int csHeight = 0;
+
+        /* Parsing variables */
+        int csParse = 0;
+
+        /* Search segments paths */
+        for ( csParse = 1; csParse < argc - 1; csParse ++ ) {
+
+            /* Check path parameter */
+            if ( ( strcmp( argv[csParse], "--path" ) == 0 ) || ( strcmp( argv[csParse], "-p" ) == 0 ) ) {
+
+                /* Append and check segment */
+                if ( cs_view_survey_append( & csSurvey, argv[++ csParse] ) == LC_FALSE ) return( EXIT_FAILURE );
+
+            }
+
+        }
 
         /* Search in parameters */
-        lc_stdp( lc_stda( argc, argv, "--path"   , "-p" ), argv, csPath.ptRoot, LC_STRING );
-        lc_stdp( lc_stda( argc, argv, "--cam-mod", "-m" ), argv, csPath.ptCAMm, LC_STRING );
-        lc_stdp( lc_stda( argc, argv, "--gps-mod", "-n" ), argv, csPath.ptGPSm, LC_STRING );
-        lc_stdp( lc_stda( argc, argv, "--imu-mod", "-s" ), argv, csPath.ptIMUm, LC_STRING );
-        lc_stdp( lc_stda( argc, argv, "--cam-tag", "-c" ), argv, csPath.ptCAMd, LC_STRING );
-        lc_stdp( lc_stda( argc, argv, "--gps-tag", "-g" ), argv, csPath.ptGPSd, LC_STRING );
-        lc_stdp( lc_stda( argc, argv, "--imu-tag", "-i" ), argv, csPath.ptIMUd, LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--cam-mod"   , "-m" ), argv, csPath.ptCAMm, LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--gps-mod"   , "-n" ), argv, csPath.ptGPSm, LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--imu-mod"   , "-s" ), argv, csPath.ptIMUm, LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--cam-tag"   , "-c" ), argv, csPath.ptCAMd, LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--gps-tag"   , "-g" ), argv, csPath.ptGPSd, LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--imu-tag"   , "-i" ), argv, csPath.ptIMUd, LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--render"    , "-o" ), argv, csRender     , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--resolution", "-x" ), argv, csSize       , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--camera"    , "-a" ), argv, csCamera     , LC_STRING );
+        lc_stdp( lc_stda( argc, argv, "--batch"     , "-b" ), argv, csList       , LC_STRING );
+
+        /* Search in arguments */
+        if ( lc_stda( argc, argv, "--immediate", "-l" ) ) csSurvey.svMode = CS_MODE_LIST;
 
         /* Execution switch */
         if ( lc_stda( argc, argv, "--help", "-h" ) || ( argc <= 1 ) ) {
@@ -77,16 +108,61 @@
             /* Display help summary */
             printf( CS_HELP );
 
+        } else if ( ( strlen( csRender ) > 0 ) || ( strlen( csList ) > 0 ) || lc_stda( argc, argv, "--bench", "-e" ) ) {
+
+            /* Check headless resolution */
+            if ( ( sscanf( csSize, "%dx%d", & csWidth, & csHeight ) != 2 ) || ( csWidth <= 0 ) || ( csHeight <= 0 ) ) {
+
+                /* Display message */
+                fprintf( LC_ERR, "Error : invalid resolution %s\n", csSize );
+
+                /* Return to system */
+                return( EXIT_FAILURE );
+
+            }
+
+            /* Check headless benchmark */
+            if ( lc_stda( argc, argv, "--bench", "-e" ) ) {
+
+                /* Headless rendering benchmark */
+                if ( cs_view_render_bench( csWidth, csHeight ) == LC_FALSE ) return( EXIT_FAILURE );
+
+            /* Check headless camera */
+            } else if ( cs_view_render_camera( csCamera ) == CS_VIEW_RENDER_NONE ) {
+
+                /* Display message */
+                fprintf( LC_ERR, "Error : unknown camera %s\n", csCamera );
+
+                /* Return to system */
+                return( EXIT_FAILURE );
+
+            /* Headless rendering */
+            } else if ( cs_view_render( csRender, csList, csWidth, csHeight, cs_view_render_camera( csCamera ) ) == LC_FALSE ) return( EXIT_FAILURE );
+
+        } else if ( csSurvey.svCount == 0 ) {
+
+            /* Display message */
+            fprintf( LC_ERR, "Error : no segment path provided\n" );
+
+            /* Return to system */
+            return( EXIT_FAILURE );
+
         } else {
 
             /* Initialize opengl and glut */
             glutInit( & argc, argv );
 
+            /* Initialize display mode */
+            glutInitDisplayMode( GLUT_DOUBLE | GLUT_RGB | GLUT_DEPTH | GLUT_STENCIL );
+
             /* Initialize windows parameters */
             glutInitWindowSize( glutGet( GLUT_SCREEN_WIDTH ), glutGet( GLUT_SCREEN_HEIGHT ) );
 
+            /* Return from main loop on window closure */
+            glutSetOption( GLUT_ACTION_ON_WINDOW_CLOSE, GLUT_ACTION_GLUTMAINLOOP_RETURNS );
+
             /* Create windows */
-            csWindow = glutCreateWindow( "csps-view" );
+            glutCreateWindow( "csps-view" );
 
             /* Assign callback functions */
             glutDisplayFunc ( cs_view_scene          );
@@ -94,35 +170,25 @@
             glutKeyboardFunc( cs_view_event_keyboard );
             glutMouseFunc   ( cs_view_event_mouse    );
             glutMotionFunc  ( cs_view_event_move     );
+            glutCloseFunc   ( cs_view_event_close    );
 
             /* Assign windows parameters */
             glutFullScreen();
 
-            /* Initialize display mode */
-            glutInitDisplayMode( GLUT_DOUBLE | GLUT_RGB | GLUT_DEPTH | GLUT_STENCIL );
-
             /* Hide cursor */
             glutSetCursor( GLUT_CURSOR_NONE ); 
 
+            /* Synchronise buffers swap with display */
+            cs_view_scene_interval( 1 );
+
             /* Compile scene */
             cs_view_scene_compile( CS_FLAG_CREATE );
 
-            /* Software main loop */
-            while ( csKeyboard.kbExit == 0 ) {
-
-                /* Display scene */
-                cs_view_scene();
-
-                /* Handle events */
-                glutMainLoopEvent();
+            /* Start loading timer */
+            glutTimerFunc( CS_VIEW_EVENT_TIMER, cs_view_event_timer, 0 );
 
-            }
-
-            /* Delete scene */
-            cs_view_scene_compile( CS_FLAG_DELETE );
-
-            /* Distroy window */
-            glutDestroyWindow( csWindow );
+            /* Software main loop */
+            glutMainLoop();
 
         }
 
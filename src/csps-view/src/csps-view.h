@@ -100,23 +100,33 @@
     # include "csps-view-event.h"
     # include "csps-view-scene.h"
     # include "csps-view-controls.h"
+    # include "csps-view-track.h"
+    # include "csps-view-survey.h"
+    # include "csps-view-render.h"
+    # include "csps-view-hud.h"
 
 /* 
     Header - Preprocessor definitions
  */
 
     /* Standard help */
-    # define CS_HELP "Usage summary :\n\n"         \
-    "\tcsps-view [Arguments] [Parameters] ...\n\n" \
-    "Short arguments and parameters summary :\n\n" \
-    "\t-p\tCSPS directory structure path\n"        \
-    "\t-m\tCamera CSPS-module\n"                   \
-    "\t-n\tGPS CSPS-module\n"                      \
-    "\t-s\tIMU CSPS-module\n"                      \
-    "\t-c\tCamera CSPS-tag\n"                      \
-    "\t-g\tGPS CSPS-tag\n"                         \
-    "\t-i\tIMU CSPS-tag\n\n"                       \
-    "csps-view - csps-suite\n"                     \
+    # define CS_HELP "Usage summary :\n\n"                            \
+    "\tcsps-view [Arguments] [Parameters] ...\n\n"                    \
+    "Short arguments and parameters summary :\n\n"                    \
+    "\t-p\tCSPS directory structure path (one per segment)\n"         \
+    "\t-m\tCamera CSPS-module\n"                                      \
+    "\t-n\tGPS CSPS-module\n"                                         \
+    "\t-s\tIMU CSPS-module\n"                                         \
+    "\t-c\tCamera CSPS-tag\n"                                         \
+    "\t-g\tGPS CSPS-tag\n"                                            \
+    "\t-i\tIMU CSPS-tag\n"                                            \
+    "\t-l\tImmediate mode rendering (display list)\n"                 \
+    "\t-o\tHeadless rendering of the segments in PNG image\n"         \
+    "\t-x\tHeadless rendering resolution (WxH)\n"                     \
+    "\t-a\tHeadless rendering camera (top, oblique, front)\n"         \
+    "\t-b\tHeadless rendering list (segment image per line)\n"        \
+    "\t-e\tHeadless rendering benchmark (frame time percentiles)\n\n" \
+    "csps-view - csps-suite\n"                                        \
     "Copyright (c) 2013-2015 FOXEL SA\n"
 
 /* 
@@ -138,8 +148,8 @@
     /*! \brief Software main function
      *  
      *  The main function simply initialize graphic library and launches event
-     *  callback functions. A infinite loop is performed until escape key is 
-     *  pressed.
+     *  callback functions. The GLUT main loop, which only redraws the scene on
+     *  demand, is performed until escape key is pressed.
      *  
      *  \param  argc Standard main parameter
      *  \param  argv Standard main parameter
@@ -149,9 +159,6 @@
 
     int main ( int argc, char ** argv );
 
-    /* Ok, well, hum ..., that's a prototype without being one ... */
-    extern void glutMainLoopEvent ( void );
-
 /* 
     Header - C/C++ compatibility
  */